@@ -1,6 +1,7 @@
 /* Copyright (c) 2020, Dyssol Development Team. All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
 
 #include "AgglomerationSolver.h"
+#include "MultidimensionalGrid.h"
 #include <cmath>
 
 CAgglomerationSolver::CAgglomerationSolver() : CBaseSolver()
@@ -20,6 +21,23 @@ void CAgglomerationSolver::Initialize(const d_vect_t& _grid, double _beta0, cons
 	Initialize();
 }
 
+void CAgglomerationSolver::SetSecondaryGrid(const CGridDimensionNumeric& _grid, EMixing _mixing)
+{
+	m_grid2  = _grid.Grid();
+	m_mixing = _mixing;
+
+	// checks
+	if (m_grid2.size() < 2)
+		RaiseError("Grid of the secondary property must contain at least one class.");
+	if (m_mixing < static_cast<EMixing>(0) || m_mixing > static_cast<EMixing>(1))
+		RaiseError("Wrong mixing rule. The value must be in the range [0; 1].");
+}
+
+void CAgglomerationSolver::ClearSecondaryGrid()
+{
+	m_grid2.clear();
+}
+
 void CAgglomerationSolver::Initialize()
 {
 }
@@ -35,6 +53,18 @@ std::pair<CAgglomerationSolver::d_vect_t, CAgglomerationSolver::d_vect_t> CAgglo
 	return { std::move(rateB), std::move(rateD) };
 }
 
+void CAgglomerationSolver::Calculate(const d_matr_t& /*_n*/, d_matr_t& /*_rateB*/, d_matr_t& /*_rateD*/)
+{
+	RaiseError("Solver '" + GetName() + "' does not support two-dimensional distributions.");
+}
+
+std::pair<CAgglomerationSolver::d_matr_t, CAgglomerationSolver::d_matr_t> CAgglomerationSolver::Calculate(const d_matr_t& _n)
+{
+	d_matr_t rateB, rateD;
+	Calculate(_n, rateB, rateD);
+	return { std::move(rateB), std::move(rateD) };
+}
+
 double CAgglomerationSolver::Kernel(double _u, double _v) const
 {
 	switch (m_kernel)
@@ -7,6 +7,8 @@
 #include <functional>
 #include <vector>
 
+class CGridDimensionNumeric;
+
 /**
  * \brief Agglomeration solver.
  */
@@ -31,6 +33,15 @@ public:
 		CUSTOM        = 10,	///< Custom kernel.
 	};
 
+	/**
+	 * \brief Rules to calculate the secondary property of an agglomerate from the properties of agglomerating particles.
+	 */
+	enum class EMixing : size_t
+	{
+		ADDITIVE       = 0,	///< Extensive property, e.g. mass of moisture: values of both particles are summed.
+		VOLUME_AVERAGE = 1,	///< Intensive property, e.g. moisture content or porosity: volume-weighted mean of both particles.
+	};
+
 protected:
 	using u_matr_t = std::vector<std::vector<size_t>>; ///< Matrix of size_t.
 	using d_matr_t = std::vector<std::vector<double>>; ///< Matrix of double.
@@ -44,6 +55,8 @@ protected:
 	std::vector<double> m_parameters;			///< Additional parameters.
 	std::vector<double> m_grid;					///< Diameter-related PSD grid.
 	std::function<kernel_t> m_CutomKernel{};	///< Custom kernel function.
+	std::vector<double> m_grid2;				///< Grid of the secondary property. Empty for one-dimensional distributions.
+	EMixing m_mixing{ EMixing::VOLUME_AVERAGE };	///< Rule to calculate the secondary property of agglomerates.
 
 public:
 	/**
@@ -87,6 +100,19 @@ public:
 	 * \param _parameters Additional parameters
 	 */
 	void Initialize(const d_vect_t& _grid, double _beta0, const std::function<kernel_t>& _kernel, const d_vect_t& _parameters = d_vect_t());
+	/**
+	 * \brief Sets the grid of the secondary property for two-dimensional distributions.
+	 * \details Must be called before Initialize(). Call ClearSecondaryGrid() to return to one-dimensional distributions.
+	 * Only solvers that support two-dimensional distributions can be used with it, see Calculate(const d_matr_t&, d_matr_t&, d_matr_t&).
+	 * \param _grid Numeric dimension of the distributions grid for the secondary property, e.g. of moisture content or porosity
+	 * \param _mixing Rule to calculate the secondary property of agglomerates
+	 */
+	void SetSecondaryGrid(const CGridDimensionNumeric& _grid, EMixing _mixing);
+	/**
+	 * \brief Removes the grid of the secondary property to return to one-dimensional distributions.
+	 * \details Must be called before Initialize().
+	 */
+	void ClearSecondaryGrid();
 
 	/**
 	 * \brief Actual initialization of the solver.
@@ -105,6 +131,21 @@ public:
 	 * \return Birth and death rates
 	 */
 	std::pair<d_vect_t, d_vect_t> Calculate(const d_vect_t& _n);
+	/**
+	 * \brief Main calculation function for two-dimensional distributions
+	 * \details The distribution is given over the size classes (first index) and the classes of the secondary property (second index).
+	 * The agglomeration kernel depends only on the sizes of particles. Throws logic_error exception if the solver does not support two-dimensional distributions.
+	 * \param _n Number distribution
+	 * \param _rateB Output matrix for birth rate
+	 * \param _rateD Output matrix for death rate
+	 */
+	virtual void Calculate(const d_matr_t& _n, d_matr_t& _rateB, d_matr_t& _rateD);
+	/**
+	 * \brief Main calculation function for two-dimensional distributions
+	 * \param _n Number distribution
+	 * \return Birth and death rates
+	 */
+	std::pair<d_matr_t, d_matr_t> Calculate(const d_matr_t& _n);
 
 protected:
 	/**
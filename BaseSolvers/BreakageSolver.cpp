@@ -0,0 +1,193 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#include "BreakageSolver.h"
+#include "DyssolDefines.h"
+#include "ThreadPool.h"
+#include <cmath>
+
+CBreakageSolver::CBreakageSolver() : CBaseSolver()
+{
+	m_type = ESolverTypes::SOLVER_BREAKAGE_1;
+}
+
+void CBreakageSolver::Initialize(const d_vect_t& _grid, double _rate, ESelection _selection, EBreakage _breakage, const d_vect_t& _selectionParameters, const d_vect_t& _breakageParameters)
+{
+	SetParameters(_grid, _rate, _selection, _breakage, nullptr, nullptr, _selectionParameters, _breakageParameters);
+	Initialize();
+}
+
+void CBreakageSolver::Initialize(const d_vect_t& _grid, double _rate, const std::function<selection_t>& _selection, const std::function<breakage_t>& _breakage)
+{
+	SetParameters(_grid, _rate, ESelection::CUSTOM, EBreakage::CUSTOM, _selection, _breakage, {}, {});
+	Initialize();
+}
+
+void CBreakageSolver::Initialize()
+{
+}
+
+void CBreakageSolver::Calculate(const d_vect_t& _n, d_vect_t& _rateB, d_vect_t& _rateD)
+{
+	CheckDistribution(_n);
+	_rateB.assign(_n.size(), 0.0);
+	_rateD.assign(_n.size(), 0.0);
+}
+
+std::pair<CBreakageSolver::d_vect_t, CBreakageSolver::d_vect_t> CBreakageSolver::Calculate(const d_vect_t& _n)
+{
+	CheckDistribution(_n);
+	d_vect_t rateB, rateD;
+	Calculate(_n, rateB, rateD);
+	return { std::move(rateB), std::move(rateD) };
+}
+
+void CBreakageSolver::CheckDistribution(const d_vect_t& _n) const
+{
+	if (_n.size() + 1 != m_grid.size())
+		RaiseError("Size of the number distribution (" + std::to_string(_n.size()) + ") does not match the number of classes of the PSD grid (" + std::to_string(m_grid.empty() ? 0 : m_grid.size() - 1) + ").");
+}
+
+double CBreakageSolver::Selection(double _v) const
+{
+	const auto& p = m_selectionParameters;
+	switch (m_selection)
+	{
+	case ESelection::CONSTANT:		return m_rate * p[0];
+	case ESelection::LINEAR:		return m_rate * _v;
+	case ESelection::QUADRATIC:		return m_rate * _v * _v;
+	case ESelection::POWER:			return m_rate * std::pow(_v, p[0]);
+	case ESelection::EXPONENTIAL:	return m_rate * std::exp(p[0] * _v);
+	case ESelection::KING:			return m_rate * (_v <= p[0] ? 0 : _v >= p[1] ? 1 : 1 - std::pow((p[1] - _v) / (p[1] - p[0]), p[2]));
+	case ESelection::AUSTIN:		return m_rate * std::pow(_v / p[0], p[1]);
+	case ESelection::CUSTOM:		return m_rate * m_customSelection(_v);
+	}
+
+	return {};
+}
+
+double CBreakageSolver::Breakage(double _u, double _v) const
+{
+	const auto& p = m_breakageParameters;
+	switch (m_breakage)
+	{
+	case EBreakage::BINARY:
+		return 2. / _v;
+	case EBreakage::DIEMER:
+		return p[0] * std::tgamma(p[1] + (p[1] + 1) * (p[0] - 1) + 1) / (std::tgamma(p[1] + 1) * std::tgamma(p[1] + (p[1] + 1) * (p[0] - 2) + 1))
+			* (std::pow(_u, p[1]) * std::pow(_v - _u, p[1] + (p[1] + 1) * (p[0] - 2)) / std::pow(_v, p[0] * p[1] + p[0] - 1));
+	case EBreakage::VOGEL:
+		if (_v == 0 || _u == 0) return 0;
+		return 0.5 * p[1] / _v * std::pow(_u / _v, p[1] - 2) * (1 + std::tanh((_v - p[0]) / p[0]));
+	case EBreakage::AUSTIN:
+		if (_v == 0 || _u == 0) return 0;
+		return p[0] * p[1] / _v * std::pow(_u / _v, p[1] - 2) + (1 - p[0]) * p[2] / _v * std::pow(_u / _v, p[2] - 2);
+	case EBreakage::CUSTOM:
+		return m_customBreakage(_u, _v);
+	}
+
+	return {};
+}
+
+double CBreakageSolver::BreakageIntegral(double _beg, double _end, double _v, unsigned _moment) const
+{
+	// 5-point Gauss-Legendre quadrature on [-1, 1]
+	static const double nodes[]   = { -0.9061798459386640, -0.5384693101056831, 0.0, 0.5384693101056831, 0.9061798459386640 };
+	static const double weights[] = {  0.2369268850561891,  0.4786286704993665, 0.5688888888888889, 0.4786286704993665, 0.2369268850561891 };
+
+	const auto Integrate = [&](double _a, double _b)
+	{
+		double res = 0.0;
+		for (size_t q = 0; q < 5; ++q)
+		{
+			const double u = (_a + _b) / 2. + (_b - _a) / 2. * nodes[q];
+			res += weights[q] * std::pow(u, _moment) * Breakage(u, _v);
+		}
+		return res * (_b - _a) / 2.;
+	};
+
+	if (_end <= _beg) return 0.0;
+	if (_beg > 0.0) return Integrate(_beg, _end);
+
+	// geometric refinement towards zero, where breakage functions may be singular
+	constexpr size_t levels = 30;
+	double res = 0.0;
+	double b = _end;
+	for (size_t i = 0; i < levels; ++i, b /= 2.)
+		res += Integrate(b / 2., b);
+	return res;
+}
+
+void CBreakageSolver::FixedPivotFragments(d_vect_t& _selection, d_vect_t& _fragments) const
+{
+	const size_t n = m_pivots.size();
+	const d_vect_t& x = m_pivots;
+
+	_selection.resize(n);
+	_fragments.assign(TriangularSize(n), 0.0);
+	ParallelFor(n, [&](size_t k)
+	{
+		_selection[k] = Selection(x[k]);
+		double* row = &_fragments[TriangularIndex(k, 0)];
+		// fragments smaller than the first pivot are assigned to it preserving mass
+		row[0] += BreakageIntegral(0.0, x[0], x[k], 1) / x[0];
+		// fragments between two pivots are split between them preserving number and mass
+		for (size_t i = 0; i < k; ++i)
+		{
+			const double dx = x[i + 1] - x[i];
+			const double m0 = BreakageIntegral(x[i], x[i + 1], x[k], 0);
+			const double m1 = BreakageIntegral(x[i], x[i + 1], x[k], 1);
+			row[i]     += (x[i + 1] * m0 - m1) / dx;
+			row[i + 1] += (m1 - x[i] * m0) / dx;
+		}
+	});
+}
+
+size_t CBreakageSolver::TriangularIndex(size_t _parent, size_t _child)
+{
+	return _parent * (_parent + 1) / 2 + _child;
+}
+
+size_t CBreakageSolver::TriangularSize(size_t _n)
+{
+	return _n * (_n + 1) / 2;
+}
+
+void CBreakageSolver::SetParameters(const d_vect_t& _grid, double _rate, ESelection _selection, EBreakage _breakage, const std::function<selection_t>& _selectionFun, const std::function<breakage_t>& _breakageFun,
+	const d_vect_t& _selectionParameters, const d_vect_t& _breakageParameters)
+{
+	m_grid                = _grid;
+	m_rate                = _rate;
+	m_selection           = _selection;
+	m_breakage            = _breakage;
+	m_customSelection     = _selectionFun;
+	m_customBreakage      = _breakageFun;
+	m_selectionParameters = _selectionParameters;
+	m_breakageParameters  = _breakageParameters;
+
+	// checks
+	if (m_grid.size() < 2)
+		RaiseError("PSD grid is empty.");
+	if (m_selection < static_cast<ESelection>(0) || m_selection > static_cast<ESelection>(7))
+		RaiseError("Wrong selection function. The value must be in the range [0; 7].");
+	if (m_breakage < static_cast<EBreakage>(0) || m_breakage > static_cast<EBreakage>(4))
+		RaiseError("Wrong breakage function. The value must be in the range [0; 4].");
+	if (m_selection == ESelection::CUSTOM && !m_customSelection)
+		RaiseError("A custom selection function is selected, but no custom function was set.");
+	if (m_breakage == EBreakage::CUSTOM && !m_customBreakage)
+		RaiseError("A custom breakage function is selected, but no custom function was set.");
+	static const std::vector<size_t> selectionParamsNumber{ 1, 0, 0, 1, 1, 3, 2, 0 };
+	static const std::vector<size_t> breakageParamsNumber{ 0, 2, 2, 3, 0 };
+	if (m_selectionParameters.size() < selectionParamsNumber[static_cast<size_t>(m_selection)])
+		RaiseError("Not enough parameters for the selected selection function.");
+	if (m_breakageParameters.size() < breakageParamsNumber[static_cast<size_t>(m_breakage)])
+		RaiseError("Not enough parameters for the selected breakage function.");
+
+	// volume-related grid and mean volumes of classes
+	m_volumes.resize(m_grid.size());
+	for (size_t i = 0; i < m_grid.size(); ++i)
+		m_volumes[i] = MATH_PI / 6. * std::pow(m_grid[i], 3);
+	m_pivots.resize(m_grid.size() - 1);
+	for (size_t i = 0; i < m_pivots.size(); ++i)
+		m_pivots[i] = (m_volumes[i] + m_volumes[i + 1]) / 2.;
+}
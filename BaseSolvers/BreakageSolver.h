@@ -0,0 +1,167 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+#include "BaseSolver.h"
+#include <functional>
+#include <vector>
+
+/**
+ * \brief Breakage solver.
+ * \details Calculates birth and death rates of particles due to breakage for the number distribution given on a diameter-related PSD grid.
+ * Breakage of a particle with volume \p v happens with the rate given by the selection function \p S(v) and produces fragments distributed according to the breakage function \p b(u,v).
+ */
+class CBreakageSolver : public CBaseSolver
+{
+public:
+	/**
+	 * \brief Types of selection functions.
+	 */
+	enum class ESelection : size_t
+	{
+		CONSTANT    = 0,	///< Constant: S = P1.
+		LINEAR      = 1,	///< Linear: S = v.
+		QUADRATIC   = 2,	///< Quadratic: S = v<sup>2</sup>.
+		POWER       = 3,	///< Power: S = v<sup>P1</sup>.
+		EXPONENTIAL = 4,	///< Exponential: S = exp(P1 v).
+		KING        = 5,	///< King: S = 1 - ((P2 - v) / (P2 - P1))<sup>P3</sup> for P1 < v < P2.
+		AUSTIN      = 6,	///< Austin: S = (v / P1)<sup>P2</sup>.
+		CUSTOM      = 7,	///< Custom selection function.
+	};
+
+	/**
+	 * \brief Types of breakage functions.
+	 */
+	enum class EBreakage : size_t
+	{
+		BINARY = 0,	///< Binary breakage.
+		DIEMER = 1,	///< Diemer breakage with parameters P1, P2.
+		VOGEL  = 2,	///< Vogel breakage with parameters P1, P2.
+		AUSTIN = 3,	///< Austin breakage with parameters P1, P2, P3.
+		CUSTOM = 4,	///< Custom breakage function.
+	};
+
+protected:
+	using d_matr_t = std::vector<std::vector<double>>; ///< Matrix of double.
+	using d_vect_t = std::vector<double>;			   ///< Vector of double.
+
+	using selection_t = double(double);			///< Type of the selection function.
+	using breakage_t  = double(double, double);	///< Type of the breakage function.
+
+	ESelection m_selection{ ESelection::CONSTANT };	///< Selected selection function.
+	EBreakage m_breakage{ EBreakage::BINARY };		///< Selected breakage function.
+	double m_rate{ 1.0 };							///< Size independent breakage rate, scales the selection function (set zero for no breakage).
+	std::vector<double> m_selectionParameters;		///< Parameters of the selection function.
+	std::vector<double> m_breakageParameters;		///< Parameters of the breakage function.
+	std::vector<double> m_grid;						///< Diameter-related PSD grid.
+	std::vector<double> m_volumes;					///< Volume-related PSD grid.
+	std::vector<double> m_pivots;					///< Mean volumes of size classes.
+	std::function<selection_t> m_customSelection{};	///< Custom selection function.
+	std::function<breakage_t> m_customBreakage{};	///< Custom breakage function.
+
+public:
+	/**
+	 * \private
+	 */
+	CBreakageSolver();
+	/**
+	 * \private
+	 */
+	~CBreakageSolver() override                                = default;
+	/**
+	 * \private
+	 */
+	CBreakageSolver(const CBreakageSolver& _other)             = default;
+	/**
+	 * \private
+	 */
+	CBreakageSolver(CBreakageSolver&& _other)                  = default;
+	/**
+	 * \private
+	 */
+	CBreakageSolver& operator=(const CBreakageSolver& _other)  = default;
+	/**
+	 * \private
+	 */
+	CBreakageSolver& operator=(CBreakageSolver&& _other)       = default;
+
+	/**
+	 * \brief Sets all required parameters and calls Initialize()
+	 * \param _grid Diameter-related PSD grid
+	 * \param _rate Size independent breakage rate
+	 * \param _selection Type of the selection function
+	 * \param _breakage Type of the breakage function
+	 * \param _selectionParameters Parameters of the selection function
+	 * \param _breakageParameters Parameters of the breakage function
+	 */
+	void Initialize(const d_vect_t& _grid, double _rate, ESelection _selection, EBreakage _breakage, const d_vect_t& _selectionParameters = d_vect_t(), const d_vect_t& _breakageParameters = d_vect_t());
+	/**
+	 * \brief Sets all required parameters and calls Initialize()
+	 * \param _grid Diameter-related PSD grid
+	 * \param _rate Size independent breakage rate
+	 * \param _selection Selection function S(v) [1/s]
+	 * \param _breakage Breakage function b(u,v): number density of fragments with volume u produced by breakage of a particle with volume v [1/m<sup>3</sup>]
+	 * Both functions may be called concurrently from several threads during initialization, so they must be thread-safe.
+	 */
+	void Initialize(const d_vect_t& _grid, double _rate, const std::function<selection_t>& _selection, const std::function<breakage_t>& _breakage);
+
+	/**
+	 * \brief Actual initialization of the solver.
+	 */
+	void Initialize() override;
+	/**
+	 * \brief Main calculation function
+	 * \param _n Number distribution
+	 * \param _rateB Output vector for birth rate
+	 * \param _rateD Output vector for death rate
+	 */
+	virtual void Calculate(const d_vect_t& _n, d_vect_t& _rateB, d_vect_t& _rateD);
+	/**
+	 * \brief Main calculation function
+	 * \param _n Number distribution
+	 * \return Birth and death rates
+	 */
+	std::pair<d_vect_t, d_vect_t> Calculate(const d_vect_t& _n);
+
+protected:
+	/**
+	 * Raises an error if the size of the number distribution _n does not match the number of classes of the PSD grid.
+	 */
+	void CheckDistribution(const d_vect_t& _n) const;
+	/**
+	 * Calculates the chosen selection function for particles with volume _v, scaled with the size independent breakage rate.
+	 */
+	[[nodiscard]] double Selection(double _v) const;
+	/**
+	 * Calculates the chosen breakage function for fragments with volume _u produced from particles with volume _v.
+	 */
+	[[nodiscard]] double Breakage(double _u, double _v) const;
+	/**
+	 * Calculates the integral of u<sup>_moment</sup> * b(u,_v) over u in the interval [_beg, _end] with Gauss-Legendre quadrature.
+	 * Integrable singularities at the interval boundaries are allowed, since the boundaries are not evaluated.
+	 */
+	[[nodiscard]] double BreakageIntegral(double _beg, double _end, double _v, unsigned _moment) const;
+	/**
+	 * Calculates the selection function in pivots and the numbers of fragments assigned to each pivot from breakage of one particle of each class.
+	 * Fragments between two pivots are split between them preserving number and mass, fragments smaller than the first pivot are assigned to it preserving mass.
+	 * Fragments are stored in contiguous lower triangular storage [parent][fragment].
+	 */
+	void FixedPivotFragments(d_vect_t& _selection, d_vect_t& _fragments) const;
+	/**
+	 * Returns position of the element (_parent, _child) in contiguous lower triangular storage, _child <= _parent.
+	 */
+	[[nodiscard]] static size_t TriangularIndex(size_t _parent, size_t _child);
+	/**
+	 * Returns size of contiguous lower triangular storage for _n classes.
+	 */
+	[[nodiscard]] static size_t TriangularSize(size_t _n);
+
+private:
+	/**
+	 * Sets all parameters.
+	 */
+	void SetParameters(const d_vect_t& _grid, double _rate, ESelection _selection, EBreakage _breakage, const std::function<selection_t>& _selectionFun, const std::function<breakage_t>& _breakageFun,
+		const d_vect_t& _selectionParameters, const d_vect_t& _breakageParameters);
+};
+
+typedef DECLDIR CBreakageSolver* (*CreateBreakageSolver)();
@@ -1,33 +1,84 @@
-/* Copyright (c) 2020, Dyssol Development Team. All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+/* Copyright (c) 2020, Dyssol Development Team.
+ * Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
 
 #include "PBMSolver.h"
+#include <algorithm>
 
 CPBMSolver::CPBMSolver() : CBaseSolver()
 {
 	m_type = ESolverTypes::SOLVER_PBM_1;
 }
 
-void CPBMSolver::SetInitialHoldup(const CHoldup* _holdup)
+void CPBMSolver::Initialize(const d_vect_t& _grid)
 {
+	if (_grid.size() < 2)
+		RaiseError("PSD grid must contain at least one class.");
+	if (!std::is_sorted(_grid.begin(), _grid.end()) || std::adjacent_find(_grid.begin(), _grid.end()) != _grid.end())
+		RaiseError("PSD grid must be strictly increasing.");
+	if ((m_selection == nullptr) != (m_fragments == nullptr))
+		RaiseError("Both selection and breakage functions must be set for breakage.");
+	m_grid = _grid;
+	Initialize();
+}
 
+void CPBMSolver::SetGrowthRate(const std::function<growth_t>& _growth)
+{
+	m_growth = _growth;
 }
 
-void CPBMSolver::SetInputStream(const CStream* _stream)
+void CPBMSolver::SetAgglomerationSolver(CAgglomerationSolver* _solver)
 {
+	m_agglomeration = _solver;
+}
 
+void CPBMSolver::SetBreakage(const std::function<selection_t>& _selection, const std::function<fragments_t>& _fragments)
+{
+	m_selection = _selection;
+	m_fragments = _fragments;
 }
 
-void CPBMSolver::SetOutputStream(double _massFlow)
+void CPBMSolver::SetBreakageSolver(CBreakageSolver* _solver)
 {
+	m_breakage = _solver;
+}
 
+void CPBMSolver::SetInflow(const d_vect_t& _flows)
+{
+	if (!_flows.empty() && _flows.size() + 1 != m_grid.size())
+		RaiseError("Size of inflow does not match the PSD grid.");
+	m_inflow = _flows;
 }
 
-void CPBMSolver::Calculate(double _timeBeg, double _timeEnd)
+void CPBMSolver::SetOutflow(double _rate)
 {
+	m_outflow.assign(1, _rate);
+}
 
+void CPBMSolver::SetOutflow(const d_vect_t& _rates)
+{
+	if (!_rates.empty() && _rates.size() + 1 != m_grid.size())
+		RaiseError("Size of outflow does not match the PSD grid.");
+	m_outflow = _rates;
+}
+
+void CPBMSolver::SetTolerances(double _rtol, double _atol)
+{
+	m_rtol = _rtol;
+	m_atol = _atol;
+}
+
+void CPBMSolver::Initialize()
+{
+}
+
+void CPBMSolver::Calculate(double /*_timeBeg*/, double /*_timeEnd*/, d_vect_t& /*_n*/)
+{
 }
 
-CHoldup* CPBMSolver::GetResult()
+double CPBMSolver::Outflow(size_t _i) const
 {
-	return nullptr;
+	if (m_outflow.empty()) return 0.0;
+	if (m_outflow.size() == 1) return m_outflow.front();
+	return m_outflow[_i];
 }
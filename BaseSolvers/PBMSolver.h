@@ -1,25 +1,156 @@
-/* Copyright (c) 2020, Dyssol Development Team. All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+/* Copyright (c) 2020, Dyssol Development Team.
+ * Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
 
 #pragma once
 
 #include "BaseSolver.h"
-#include "Holdup.h"
+#include <functional>
+#include <vector>
 
+class CAgglomerationSolver;
+class CBreakageSolver;
+
+/**
+ * \brief Population balance solver.
+ * \details Integrates the population balance of particles in a well-mixed volume over time.
+ * The distribution is given as numbers of particles in each class of a diameter-related PSD grid.
+ * Considered processes are growth, agglomeration, breakage, inflow and outflow of particles.
+ * All processes are optional; the ones not set are not considered.
+ *
+ * \note This interface replaces the previous one, in which all functions were empty placeholders. Solvers written for it must be migrated and rebuilt:
+ * - SetInitialHoldup(holdup): pass the initial numbers of particles in each class as \p _n to Calculate();
+ * - SetInputStream(stream): pass number flows of particles in each class to SetInflow();
+ * - SetOutputStream(massFlow): pass the relative withdrawal rate, i.e. mass flow divided by the mass of the holdup, to SetOutflow();
+ * - Calculate(timeBeg, timeEnd): use Calculate(timeBeg, timeEnd, n);
+ * - GetResult(): read the final numbers of particles from \p _n after Calculate().
+ *
+ * The layout of the class has changed, so solver libraries built against the previous interface are not binary compatible.
+ */
 class CPBMSolver : public CBaseSolver
 {
+protected:
+	using d_matr_t = std::vector<std::vector<double>>; ///< Matrix of double.
+	using d_vect_t = std::vector<double>;			   ///< Vector of double.
+
+	using growth_t    = double(double);				///< Type of the growth rate function.
+	using selection_t = double(double);				///< Type of the breakage selection function.
+	using fragments_t = double(double, double);		///< Type of the breakage function.
+
+	std::vector<double> m_grid;						///< Diameter-related PSD grid.
+	std::function<growth_t> m_growth{};				///< Growth rate function.
+	CAgglomerationSolver* m_agglomeration{};		///< Solver to calculate agglomeration rates.
+	std::function<selection_t> m_selection{};		///< Breakage selection function.
+	std::function<fragments_t> m_fragments{};		///< Breakage function.
+	CBreakageSolver* m_breakage{};					///< Solver to calculate breakage rates.
+	std::vector<double> m_inflow;					///< Number flows of particles entering each class.
+	std::vector<double> m_outflow;					///< Relative withdrawal rates of particles from each class.
+	double m_rtol{ 1e-4 };							///< Relative tolerance.
+	double m_atol{ 1e-8 };							///< Absolute tolerance, relative to the total number of particles.
+
 public:
+	/**
+	 * \private
+	 */
 	CPBMSolver();
+	/**
+	 * \private
+	 */
 	~CPBMSolver() override                          = default;
+	/**
+	 * \private
+	 */
 	CPBMSolver(const CPBMSolver& _other)            = default;
+	/**
+	 * \private
+	 */
 	CPBMSolver(CPBMSolver&& _other)                 = default;
+	/**
+	 * \private
+	 */
 	CPBMSolver& operator=(const CPBMSolver& _other) = default;
+	/**
+	 * \private
+	 */
 	CPBMSolver& operator=(CPBMSolver&& _other)      = default;
 
-	virtual void SetInitialHoldup(const CHoldup* _holdup);
-	virtual void SetInputStream(const CStream* _stream);
-	virtual void SetOutputStream(double _massFlow);
-	virtual void Calculate(double _timeBeg, double _timeEnd);
-	virtual CHoldup* GetResult();
+	/**
+	 * \brief Sets the grid and calls Initialize().
+	 * \details Should be called after breakage functions are set and each time they change.
+	 * \param _grid Diameter-related PSD grid.
+	 */
+	void Initialize(const d_vect_t& _grid);
+
+	/**
+	 * \brief Sets the growth rate.
+	 * \details The growth rate is evaluated on each call of Calculate(), so it can be changed between calls.
+	 * \param _growth Function returning the growth rate of particle diameter [m/s] for the given diameter. Set nullptr to disable growth.
+	 */
+	void SetGrowthRate(const std::function<growth_t>& _growth);
+	/**
+	 * \brief Sets the solver to calculate agglomeration rates.
+	 * \details The solver must be initialized with the same grid.
+	 * \param _solver Pointer to the agglomeration solver. Set nullptr to disable agglomeration.
+	 */
+	void SetAgglomerationSolver(CAgglomerationSolver* _solver);
+	/**
+	 * \brief Sets the breakage functions.
+	 * \details Initialize() should be called after the functions are set.
+	 * The functions are evaluated concurrently from several threads during initialization, so they must be thread-safe.
+	 * \param _selection Function returning the breakage rate [1/s] of particles with the given volume.
+	 * \param _fragments Function returning the number density of fragments with volume \p u [1/m<sup>3</sup>] produced by breakage of a particle with volume \p v: \p b(u,v).
+	 * Set both to nullptr to disable breakage.
+	 */
+	void SetBreakage(const std::function<selection_t>& _selection, const std::function<fragments_t>& _fragments);
+	/**
+	 * \brief Sets the solver to calculate breakage rates.
+	 * \details The solver must be initialized with the same grid. If set, breakage functions set with SetBreakage() are not used.
+	 * \param _solver Pointer to the breakage solver. Set nullptr to disable breakage with a solver.
+	 */
+	void SetBreakageSolver(CBreakageSolver* _solver);
+	/**
+	 * \brief Sets number flows of particles entering the volume.
+	 * \param _flows Number flows of particles [1/s] for each class. Set empty to disable inflow.
+	 */
+	void SetInflow(const d_vect_t& _flows);
+	/**
+	 * \brief Sets the rate of withdrawal of particles, equal for all classes.
+	 * \details For the outflow of a well-mixed volume, the rate is the ratio of the outlet mass flow to the holdup mass.
+	 * \param _rate Relative withdrawal rate [1/s].
+	 */
+	void SetOutflow(double _rate);
+	/**
+	 * \brief Sets the rates of withdrawal of particles for each class, e.g. for classified product removal.
+	 * \param _rates Relative withdrawal rates [1/s] for each class. Set empty to disable outflow.
+	 */
+	void SetOutflow(const d_vect_t& _rates);
+	/**
+	 * \brief Sets tolerances of time integration.
+	 * \param _rtol Relative tolerance.
+	 * \param _atol Absolute tolerance, relative to the total number of particles.
+	 */
+	void SetTolerances(double _rtol, double _atol);
+
+	/**
+	 * \brief Actual initialization of the solver.
+	 */
+	void Initialize() override;
+	/**
+	 * \brief Main calculation function.
+	 * \details Integrates the population balance from \p _timeBeg to \p _timeEnd.
+	 * \param _timeBeg Start of the time interval.
+	 * \param _timeEnd End of the time interval.
+	 * \param _n Number of particles in each class. Initial values on input, final values on output.
+	 */
+	virtual void Calculate(double _timeBeg, double _timeEnd, d_vect_t& _n);
+
+protected:
+	/**
+	 * \brief Returns the withdrawal rate of the given class.
+	 * \param _i Index of the class.
+	 * \return Relative withdrawal rate [1/s].
+	 */
+	[[nodiscard]] double Outflow(size_t _i) const;
 };
 
 typedef DECLDIR CPBMSolver* (*CreatePBMSolver)();
@@ -5,8 +5,14 @@
 #include "ArgumentsParser.h"
 #include "ScriptParser.h"
 #include "ScriptRunner.h"
+#include "ScriptScheduler.h"
+#include "BenchmarkReport.h"
+#include "MaterialsDatabase.h"
 #include "ThreadPool.h"
 #include "DyssolSystemDefines.h"
+#include "DyssolSystemFunctions.h"
+#include <chrono>
+#include <fstream>
 #include <iomanip>
 
 // Prints information about command line arguments.
@@ -73,7 +79,29 @@ void PrintModelsInfo(const std::vector<std::filesystem::path>& _modelPaths)
 	}
 }
 
-bool RunDyssol(const std::filesystem::path& _script)
+// Converts materials database between text and binary formats. The format of the output file is selected by its extension.
+bool ConvertMaterialsDatabase(const std::filesystem::path& _input, std::filesystem::path _output)
+{
+	if (_output.empty())
+		_output = std::filesystem::path{ _input }.replace_extension(CMaterialsDatabase::IsBinaryFile(_input) ? MDBDescriptors::TEXT_MDB_FILE_EXT : MDBDescriptors::BINARY_MDB_FILE_EXT);
+
+	std::cout << "Converting materials database: \n\t" << _input.string() << " -> " << _output.string() << std::endl;
+
+	CMaterialsDatabase database;
+	if (!database.LoadFromFile(_input))
+	{
+		std::cout << "Error: Unable to load materials database: " << _input.string() << std::endl;
+		return false;
+	}
+	if (!database.SaveToFile(_output))
+	{
+		std::cout << "Error: Unable to save materials database: " << _output.string() << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool RunDyssol(const std::filesystem::path& _script, size_t _threads, size_t _sweepThreads)
 {
 	InitializeThreadPool();
 
@@ -82,18 +110,80 @@ bool RunDyssol(const std::filesystem::path& _script)
 	const CScriptParser parser{ _script };
 	std::cout << "Jobs found: \n\t" << parser.JobsCount() << std::endl;
 
+	// run independent jobs in parallel
+	if (_threads > 1 && parser.JobsCount() > 1)
+	{
+		std::cout << StrConst::DyssolC_RunJobs(std::min(_threads, parser.JobsCount())) << std::endl;
+		return CScriptScheduler{ _threads }.Run(parser.Jobs());
+	}
+
 	CScriptRunner runner;
+	runner.SetSweepThreads(_sweepThreads);
 	size_t counter = 0;
 	bool success = true;
 	for (const auto& job : parser.Jobs())
 	{
-		std::cout << " ===== Starting job: " << counter++ + 1 << " ===== " << std::endl;
+		std::cout << StrConst::DyssolC_StartJob(counter++ + 1) << std::endl;
 		success &= runner.RunJob(*job);
 	}
 
 	return success;
 }
 
+// Runs all jobs of the script sequentially the given number of times and writes a report about their performance in JSON format to the file or to the console.
+bool RunBenchmark(const std::filesystem::path& _script, size_t _repetitions, size_t _sweepThreads, const std::filesystem::path& _report)
+{
+	namespace ch = std::chrono;
+
+	InitializeThreadPool();
+
+	std::cout << "Parsing script file: \n\t" << _script.string() << std::endl;
+
+	const CScriptParser parser{ _script };
+	std::cout << "Jobs found: \n\t" << parser.JobsCount() << std::endl;
+
+	CBenchmarkReport report{ _script };
+	bool success = true;
+	for (size_t i = 0; i < _repetitions; ++i)
+	{
+		std::cout << StrConst::DyssolC_StartBenchmarkRun(i + 1, _repetitions) << std::endl;
+		CBenchmarkReport::SRun run;
+		const auto tStart = ch::steady_clock::now();
+		// each run starts from scratch, without models or tear streams of the previous one
+		CScriptRunner runner;
+		runner.SetSweepThreads(_sweepThreads);
+		size_t counter = 0;
+		for (const auto& job : parser.Jobs())
+		{
+			std::cout << StrConst::DyssolC_StartJob(counter++ + 1) << std::endl;
+			const auto tJob = ch::steady_clock::now();
+			auto& jobRun = run.jobs.emplace_back();
+			jobRun.success = runner.RunJob(*job);
+			jobRun.time = ch::duration<double>(ch::steady_clock::now() - tJob).count();
+			jobRun.simulations = runner.GetStatistics();
+			success &= jobRun.success;
+		}
+		run.time = ch::duration<double>(ch::steady_clock::now() - tStart).count();
+		report.AddRun(std::move(run));
+	}
+	report.SetPeakMemory(SystemFunctions::PeakMemoryUsage());
+
+	if (_report.empty())
+	{
+		report.Write(std::cout);
+		return success;
+	}
+	std::cout << StrConst::DyssolC_WriteBenchmark(_report.string()) << std::endl;
+	std::ofstream file{ _report };
+	if (!file)
+	{
+		std::cout << StrConst::DyssolC_ErrorBenchmarkFile() << std::endl;
+		return false;
+	}
+	report.Write(file);
+	return success;
+}
+
 void HandleException(const std::exception_ptr& _exceptionPtr)
 {
 	try
@@ -118,6 +208,11 @@ int main(int argc, const char* argv[])
 			{ { "version"     }, { "v"  }, { "print information about current version"      } },
 			{ { "models"      }, { "m"  }, { "print information about available models"     } },
 			{ { "models_path" }, { "mp" }, { "additional path to look for available models" } },
+			{ { "convert_mdb" }, { "cm" }, { "convert materials database between text and binary formats" } },
+			{ { "output"      }, { "o"  }, { "output file for converted materials database"  } },
+			{ { "jobs"        }, { "j"  }, { "number of independent script jobs or parameter sweep runs to run in parallel, 0 for all available cores" } },
+			{ { "benchmark"   }, { "b"  }, { "run the script the given number of times and report its performance in JSON format" } },
+			{ { "benchmark_output" }, { "bo" }, { "output file for the benchmark report, printed to the console if not set" } },
 			{ { "help"        }, { "h"  }, { "give this help list"                          } },
 		};
 
@@ -138,9 +233,26 @@ int main(int argc, const char* argv[])
 				fsPaths.emplace_back(p);
 			PrintModelsInfo(fsPaths);
 		}
+		if (parser.HasKey("cm"))
+			if (!ConvertMaterialsDatabase(parser.GetValue("cm"), parser.HasKey("o") ? parser.GetValue("o") : ""))
+				return 1;
 		if (parser.HasKey("s"))
-			if (!RunDyssol(parser.GetValue("s")))
+		{
+			size_t threads = parser.HasKey("j") ? std::stoull(parser.GetValue("j")) : 1;
+			if (threads == 0)
+				threads = ThreadPool::CThreadPool::GetAvailableThreadsNumber();
+			// runs of parameter sweeps are always independent, so they use all cores if not limited explicitly
+			const size_t sweepThreads = parser.HasKey("j") ? threads : ThreadPool::CThreadPool::GetAvailableThreadsNumber();
+			if (parser.HasKey("b"))
+			{
+				// jobs are always executed one by one to measure each of them separately
+				const std::string repetitions = parser.GetValue("b");
+				if (!RunBenchmark(parser.GetValue("s"), repetitions.empty() ? 1 : std::max<size_t>(std::stoull(repetitions), 1), sweepThreads, parser.GetValue("bo")))
+					return 1;
+			}
+			else if (!RunDyssol(parser.GetValue("s"), threads, sweepThreads))
 				return 1;
+		}
 	}
 	catch (...)
 	{
@@ -2,6 +2,7 @@
 
 #include "DAEModel.h"
 #include "ContainerFunctions.h"
+#include "ThreadPool.h"
 #include <cfloat>
 
 CDAEModel::CDAEModel( void )
@@ -23,6 +24,10 @@ void CDAEModel::Clear()
 	m_dRTol = DEFAULT_RTOL;
 	m_dATol = DEFAULT_ATOL;
 	m_vATol.clear();
+	m_bAnalyticalJacobian = false;
+	m_vJacobianPattern.clear();
+	m_nResidualBlocks = 0;
+	m_nRoots = 0;
 }
 
 size_t CDAEModel::AddDAEVariable(bool _isDifferentiable, double _variableInit, double _derivativeInit, double _constraint /*= 0.0 */)
@@ -109,6 +114,7 @@ void CDAEModel::ClearVariables()
 {
 	m_vVariables.clear();
 	m_vATol.clear();
+	m_vJacobianPattern.clear();
 }
 
 double CDAEModel::GetVarType(size_t _dIndex)
@@ -162,6 +168,46 @@ std::vector<double> CDAEModel::GetATols() const
 	return std::vector<double>(GetVariablesNumber(), DEFAULT_ATOL);
 }
 
+void CDAEModel::SetResidualBlocksNumber(size_t _number)
+{
+	m_nResidualBlocks = _number;
+}
+
+size_t CDAEModel::GetResidualBlocksNumber() const
+{
+	return m_nResidualBlocks;
+}
+
+void CDAEModel::SetRootsNumber(size_t _number)
+{
+	m_nRoots = _number;
+}
+
+size_t CDAEModel::GetRootsNumber() const
+{
+	return m_nRoots;
+}
+
+void CDAEModel::SetAnalyticalJacobian(bool _flag)
+{
+	m_bAnalyticalJacobian = _flag;
+}
+
+bool CDAEModel::IsAnalyticalJacobian() const
+{
+	return m_bAnalyticalJacobian;
+}
+
+void CDAEModel::SetJacobianPattern(const std::vector<std::vector<size_t>>& _pattern)
+{
+	m_vJacobianPattern = _pattern;
+}
+
+const std::vector<std::vector<size_t>>& CDAEModel::GetJacobianPattern() const
+{
+	return m_vJacobianPattern;
+}
+
 void CDAEModel::SetUserData( void* _pUserData )
 {
 	m_pUserData = _pUserData;
@@ -177,14 +223,41 @@ void CDAEModel::CalculateResiduals( double _dTime, double* _pVars, double* _pDer
 
 }
 
+void CDAEModel::CalculateResidualsBlock(double /*_time*/, double* /*_vars*/, double* /*_ders*/, double* /*_res*/, size_t /*_block*/, void* /*_userData*/)
+{
+
+}
+
+void CDAEModel::CalculateRoots(double /*_time*/, double* /*_vars*/, double* /*_ders*/, double* /*_roots*/, void* /*_userData*/)
+{
+
+}
+
+void CDAEModel::EventHandler(double /*_time*/, double* /*_vars*/, double* /*_ders*/, const int* /*_roots*/, void* /*_userData*/)
+{
+
+}
+
 void CDAEModel::ResultsHandler( double _dTime, double* _pVars, double* _pDerivs, void* _pUserData )
 {
 
 }
 
+bool CDAEModel::CalculateJacobian(double /*_time*/, double* /*_vars*/, double* /*_ders*/, double* /*_res*/, double /*_cj*/, double* /*_jac*/, void* /*_userData*/)
+{
+	return false;
+}
+
 bool CDAEModel::GetResiduals( double _dTime, double* _pVars, double* _pDerivs, double* _pRes )
 {
 	CalculateResiduals( _dTime, _pVars, _pDerivs, _pRes, m_pUserData );
+	if (m_nResidualBlocks == 1)
+		CalculateResidualsBlock(_dTime, _pVars, _pDerivs, _pRes, 0, m_pUserData);
+	else if (m_nResidualBlocks > 1)
+		ParallelFor(m_nResidualBlocks, [&](size_t i)
+		{
+			CalculateResidualsBlock(_dTime, _pVars, _pDerivs, _pRes, i, m_pUserData);
+		});
 	bool bRet = false;
 	if( !m_vVariables.empty() )
 	{
@@ -202,6 +275,21 @@ bool CDAEModel::GetResiduals( double _dTime, double* _pVars, double* _pDerivs, d
 	return bRet;
 }
 
+bool CDAEModel::GetJacobian(double _time, double* _vars, double* _ders, double* _res, double _cj, double* _jac)
+{
+	return CalculateJacobian(_time, _vars, _ders, _res, _cj, _jac, m_pUserData);
+}
+
+void CDAEModel::GetRoots(double _time, double* _vars, double* _ders, double* _roots)
+{
+	CalculateRoots(_time, _vars, _ders, _roots, m_pUserData);
+}
+
+void CDAEModel::HandleEvent(double _time, double* _vars, double* _ders, const int* _roots)
+{
+	EventHandler(_time, _vars, _ders, _roots, m_pUserData);
+}
+
 void CDAEModel::HandleResults( double _dTime, double* _pVars, double* _pDerivs )
 {
 	ResultsHandler( _dTime, _pVars, _pDerivs, m_pUserData );
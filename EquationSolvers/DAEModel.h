@@ -40,6 +40,10 @@ private:
 	double m_dRTol;								///< Relative tolerance
 	double m_dATol;								///< Absolute tolerance
 	std::vector<double> m_vATol;				///< Absolute tolerance for each variable
+	bool m_bAnalyticalJacobian{ false };		///< Whether the Jacobian is calculated by CalculateJacobian.
+	std::vector<std::vector<size_t>> m_vJacobianPattern;	///< Sparsity pattern of the Jacobian: indices of variables each residual depends on.
+	size_t m_nResidualBlocks{ 0 };				///< Number of independent blocks of residuals calculated in parallel.
+	size_t m_nRoots{ 0 };						///< Number of root functions defining events.
 
 public:
 	/**	Basic constructor.*/
@@ -97,7 +101,7 @@ public:
 	 *	\return true There are defined constraints.
 	 *	\return false No defined constraints. */
 	bool IsConstraintsDefined() const;
-	/** Remove all variables*/
+	/** Remove all variables and the sparsity pattern of the Jacobian*/
 	void ClearVariables();
 	/**	Get type of the variable.
 	 *	\param _dIndex Index of variable
@@ -127,6 +131,44 @@ public:
 	 *	\return Vector of absolute tolerances for all variables*/
 	std::vector<double> GetATols() const;
 
+	// ========== Functions to work with parallel residuals
+
+	/**	Set the number of independent blocks of residuals. If not zero, after each call of \a CalculateResiduals,
+	 *	the function \a CalculateResidualsBlock is called in parallel for each block.
+	 *	\param _number Number of blocks*/
+	void SetResidualBlocksNumber(size_t _number);
+	/**	Get the number of independent blocks of residuals.
+	 *	\return Number of blocks*/
+	size_t GetResidualBlocksNumber() const;
+
+	// ========== Functions to work with events
+
+	/**	Set the number of root functions. If not zero, the solver calculates them with \a CalculateRoots,
+	 *	stops exactly at time points where any of them changes its sign, and calls \a EventHandler there.
+	 *	\param _number Number of root functions*/
+	void SetRootsNumber(size_t _number);
+	/**	Get the number of root functions.
+	 *	\return Number of root functions*/
+	size_t GetRootsNumber() const;
+
+	// ========== Functions to work with Jacobian
+
+	/**	Enables or disables calculation of the Jacobian by the overridden function \a CalculateJacobian.
+	 *	If disabled, the Jacobian is calculated by the solver using finite differences.
+	 *	\param _flag Flag to enable analytical Jacobian*/
+	void SetAnalyticalJacobian(bool _flag);
+	/**	Checks if the Jacobian is calculated by the overridden function \a CalculateJacobian.
+	 *	\return Whether analytical Jacobian is enabled.*/
+	bool IsAnalyticalJacobian() const;
+	/**	Set the sparsity pattern of the Jacobian. For each residual, contains indices of all variables whose values or derivatives this residual depends on.
+	 *	If defined and the analytical Jacobian is not enabled, the solver calculates the Jacobian with compressed finite differences,
+	 *	perturbing structurally independent variables simultaneously. Set empty pattern to use dense finite differences.
+	 *	\param _pattern Indices of variables for each residual*/
+	void SetJacobianPattern(const std::vector<std::vector<size_t>>& _pattern);
+	/**	Get the sparsity pattern of the Jacobian.
+	 *	\return Indices of variables for each residual*/
+	const std::vector<std::vector<size_t>>& GetJacobianPattern() const;
+
 	/**	Set pointer to user data. This pointer will be returned with functions \a CalculateResiduals and \a ResultsHandler.
 	 *	\param _pUserData Pointer to user data*/
 	void SetUserData( void* _pUserData );
@@ -143,17 +185,57 @@ public:
 	 *	\param _pRes Output residual vector F(t, y, y')
 	 *	\param _pUserData Pointer to user's data*/
 	virtual void CalculateResiduals( double _dTime, double* _pVars, double* _pDerivs, double* _pRes, void* _pUserData );
+	/** Calculate residuals of one independent block. Called in parallel for all blocks after \a CalculateResiduals, if the number of blocks is set with \a SetResidualBlocksNumber.
+	 *	May read all variables and derivatives and the data prepared in \a CalculateResiduals, but must write only residuals of its own block and not modify any shared data.
+	 *	\param _time Current value of the independent variable
+	 *	\param _vars Current value of the dependent variable vector, y(t)
+	 *	\param _ders Current value of y'(t)
+	 *	\param _res Output residual vector F(t, y, y')
+	 *	\param _block Index of the block
+	 *	\param _userData Pointer to user's data*/
+	virtual void CalculateResidualsBlock(double _time, double* _vars, double* _ders, double* _res, size_t _block, void* _userData);
+	/** Calculate values of root functions. Called only if the number of root functions is set with \a SetRootsNumber.
+	 *	\param _time Current value of the independent variable
+	 *	\param _vars Current value of the dependent variable vector, y(t)
+	 *	\param _ders Current value of y'(t)
+	 *	\param _roots Output values of root functions g(t, y, y')
+	 *	\param _userData Pointer to user's data*/
+	virtual void CalculateRoots(double _time, double* _vars, double* _ders, double* _roots, void* _userData);
+	/** Handle an event: a root of any root function or a discontinuity time point defined in the solver.
+	 *	Variables and derivatives may be changed here, consistent initial conditions are then recalculated by the solver and integration is restarted.
+	 *	\param _time Time point of the event
+	 *	\param _vars Current value of the dependent variable vector, y(t)
+	 *	\param _ders Current value of y'(t)
+	 *	\param _roots For each root function: 1 or -1 if it has a root here and is increasing or decreasing, 0 otherwise. nullptr if the event is a discontinuity time point
+	 *	\param _userData Pointer to user's data*/
+	virtual void EventHandler(double _time, double* _vars, double* _ders, const int* _roots, void* _userData);
 	/** Handle results.
 	 *	\param _dTime Current value of the independent variable
 	 *	\param _pVars Current value of the dependent variable vector, y(t)
 	 *	\param _pDerivs Current value of y'(t)
 	 *	\param _pUserData Pointer to user's data*/
 	virtual void ResultsHandler( double _dTime, double* _pVars, double* _pDerivs, void* _pUserData );
+	/** Calculate the Jacobian J = dF/dy + _cj * dF/dy'. Called only if the analytical Jacobian is enabled with \a SetAnalyticalJacobian.
+	 *	\param _time Current value of the independent variable
+	 *	\param _vars Current value of the dependent variable vector, y(t)
+	 *	\param _ders Current value of y'(t)
+	 *	\param _res Current value of the residual vector F(t, y, y')
+	 *	\param _cj Scalar in the system Jacobian, proportional to the inverse of the step size
+	 *	\param _jac Output Jacobian as a dense matrix stored column-wise: element (i,j) is _jac[i + j * N], where N is the number of variables. Initially filled with zeros
+	 *	\param _userData Pointer to user's data
+	 *	\return false if the Jacobian cannot be calculated*/
+	virtual bool CalculateJacobian(double _time, double* _vars, double* _ders, double* _res, double _cj, double* _jac, void* _userData);
 
 	// ========== Functions for calling from solver
 
-	/** Calculate residuals. Calls CalculateResiduals.*/
+	/** Calculate residuals. Calls CalculateResiduals and CalculateResidualsBlock for each block.*/
 	bool GetResiduals( double _dTime, double* _pVars, double* _pDerivs, double* _pRes );
+	/** Calculate the Jacobian. Calls CalculateJacobian.*/
+	bool GetJacobian(double _time, double* _vars, double* _ders, double* _res, double _cj, double* _jac);
+	/** Calculate root functions. Calls CalculateRoots.*/
+	void GetRoots(double _time, double* _vars, double* _ders, double* _roots);
+	/** Handle event. Calls EventHandler.*/
+	void HandleEvent(double _time, double* _vars, double* _ders, const int* _roots);
 	/** Handle results. Calls ResultsHandler.*/
 	void HandleResults( double _dTime, double* _pVars, double* _pDerivs );
 };
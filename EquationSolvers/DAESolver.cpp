@@ -3,15 +3,13 @@
  * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
 
 #include "DAESolver.h"
-#include "DyssolHelperDefines.h"
 #ifndef SUNDIALS_VERSION_MAJOR
 #define SUNDIALS_VERSION_MAJOR 2
 #define SUNDIALS_VERSION_MINOR 7
 #define SUNDIALS_VERSION_PATCH 0
 #endif
-#define DYSSOL_SUNDIALS_VERSION SUNDIALS_VERSION_MAJOR.SUNDIALS_VERSION_MINOR.SUNDIALS_VERSION_PATCH
 PRAGMA_WARNING_DISABLE
-#include MACRO_CONCAT_STR3(impl/,DYSSOL_SUNDIALS_VERSION,/ida_impl.h)
+#include <ida/ida.h>
 #if SUNDIALS_VERSION_MAJOR <= 2
 #include <ida/ida_dense.h>
 #elif SUNDIALS_VERSION_MAJOR <= 3
@@ -21,7 +19,11 @@ PRAGMA_WARNING_DISABLE
 #include <sunlinsol/sunlinsol_dense.h>
 #endif
 PRAGMA_WARNING_RESTORE
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <cstring>
+#include <limits>
 
 // Macros for convenient adding context to functions depending on the sundials version
 #if SUNDIALS_VERSION_MAJOR >= 6
@@ -42,12 +44,18 @@ bool CDAESolver::SetModel(CDAEModel* _model)
 	Clear();
 	m_model = _model;
 
+	if (!InitJacobianColoring())
+		return false;
 	if (!InitSolverMemory(m_solverMem))
 	{
 		ClearSolverMemory(m_solverMem);
 		return false;
 	}
-	InitStoreMemory(m_solverMem_store);
+	if (!InitStoreMemory(m_solverMem_store))
+	{
+		Clear();
+		return false;
+	}
 
 	SaveState();
 	return true;
@@ -55,6 +63,9 @@ bool CDAESolver::SetModel(CDAEModel* _model)
 
 bool CDAESolver::Calculate(double _time)
 {
+	const auto tStart = std::chrono::steady_clock::now();
+	m_statistics.calls++;
+
 	if (_time == 0.0)
 	{
 		const bool success = CalculateInitialConditions();
@@ -63,12 +74,22 @@ bool CDAESolver::Calculate(double _time)
 	}
 	else
 	{
-		const int res = IDASolve(m_solverMem.idamem, _time, &m_timeLast, m_solverMem.vars, m_solverMem.ders, IDA_NORMAL);
-		if (res < 0)
-			return WriteError("IDA", "IDASolve", "Cannot integrate.");
-		m_model->HandleResults(m_timeLast, N_VGetArrayPointer(m_solverMem.vars), N_VGetArrayPointer(m_solverMem.ders));
+		int res;
+		do
+		{
+			res = IDASolve(m_solverMem.idamem, _time, &m_timeLast, m_solverMem.vars, m_solverMem.ders, IDA_NORMAL);
+			if (res < 0)
+				return WriteError("IDA", "IDASolve", "Cannot integrate.");
+			m_solverMem_store.current = false;
+			m_model->HandleResults(m_timeLast, N_VGetArrayPointer(m_solverMem.vars), N_VGetArrayPointer(m_solverMem.ders));
+			/* restart integration after the event */
+			if (res == IDA_ROOT_RETURN && !HandleEvent(true, _time))
+				return false;
+		} while (res == IDA_ROOT_RETURN && m_timeLast < _time);
 	}
 
+	m_statistics.solverTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+	ReportStatistics();
 	return true;
 }
 
@@ -79,6 +100,9 @@ bool CDAESolver::Calculate(double _timeBeg, double _timeEnd)
 	if (_timeBeg == _timeEnd)
 		return WriteError("IDA", "Calculate", "Start and end time points are equal. Cannot perform calculations for dynamic model.");
 
+	const auto tStart = std::chrono::steady_clock::now();
+	m_statistics.calls++;
+
 	if (_timeBeg == 0.0)
 	{
 		const bool success = CalculateInitialConditions();
@@ -119,6 +143,8 @@ bool CDAESolver::Calculate(double _timeBeg, double _timeEnd)
 			return false;
 	}
 
+	m_statistics.solverTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+	ReportStatistics();
 	return true;
 }
 
@@ -145,19 +171,100 @@ bool CDAESolver::CalculateInitialConditions()
 
 bool CDAESolver::IntegrateUntil(double _time)
 {
-	/* set integration limit */
-	int res = IDASetStopTime(m_solverMem.idamem, _time);
+	int res;
+	/* time of the last internal step */
+	double timePrev;
+	res = IDAGetCurrentTime(m_solverMem.idamem, &timePrev);
+	if (res != IDA_SUCCESS)
+		return WriteError("IDA", "IDAGetCurrentTime", "Cannot read current time.");
+	/* set integration limit: the end of the interval or the next discontinuity */
+	double timeStop = NextStopTime(timePrev, _time);
+	res = IDASetStopTime(m_solverMem.idamem, timeStop);
 	if (res != IDA_SUCCESS)
 		return WriteError("IDA", "IDASetStopTime", "Cannot set integration stop time");
+	/* states for adaptive output: last reported, not yet reported and current */
+	SOutputPoint reported, pending, current;
+	bool hasPending = false;
+	if (m_outputMode == EDAEOutputMode::ADAPTIVE)
+	{
+		StoreCurrentResults(reported);
+		reported.time = timePrev;
+	}
 	/* integrate */
+	bool isFinal;
 	do
 	{
 		/* _time here is not a stop criterion, it only gives the direction of integration. */
 		res = IDASolve(m_solverMem.idamem, _time, &m_timeLast, m_solverMem.vars, m_solverMem.ders, IDA_ONE_STEP);
 		if (res < 0)
 			return WriteError("IDA", "IDASolve", "Cannot integrate.");
-		m_model->HandleResults(m_timeLast, N_VGetArrayPointer(m_solverMem.vars), N_VGetArrayPointer(m_solverMem.ders));
-	} while (res != IDA_TSTOP_RETURN);
+		m_solverMem_store.current = false;
+		const bool isRoot = res == IDA_ROOT_RETURN;
+		isFinal = (res == IDA_TSTOP_RETURN || isRoot) && m_timeLast >= _time;
+		const bool isEvent = isRoot || (res == IDA_TSTOP_RETURN && !isFinal);
+		/* results are always reported at the end of the interval and at events */
+		const bool isBreak = isFinal || isEvent;
+		switch (m_outputMode)
+		{
+		case EDAEOutputMode::EACH_STEP:
+			m_model->HandleResults(m_timeLast, N_VGetArrayPointer(m_solverMem.vars), N_VGetArrayPointer(m_solverMem.ders));
+			break;
+		case EDAEOutputMode::GRID:
+			if (!ReportGridResults(timePrev, m_timeLast))
+				return false;
+			if (isBreak || NextOutputTime(std::nextafter(m_timeLast, -std::numeric_limits<double>::infinity())) == m_timeLast)
+				m_model->HandleResults(m_timeLast, N_VGetArrayPointer(m_solverMem.vars), N_VGetArrayPointer(m_solverMem.ders));
+			break;
+		case EDAEOutputMode::ADAPTIVE:
+		{
+			StoreCurrentResults(current);
+			/* check whether the pending state and the middle of the last step are covered by interpolation from the last reported state */
+			bool accurate = !hasPending || IsInterpolable(reported, current, pending.time, pending.vars.data());
+			if (accurate && !isBreak)
+			{
+				const double timeMid = 0.5 * (timePrev + m_timeLast);
+				res = IDAGetDky(m_solverMem.idamem, timeMid, 0, m_solverMem.outVars);
+				if (res != IDA_SUCCESS)
+					return WriteError("IDA", "IDAGetDky", "Cannot interpolate solution.");
+				accurate = IsInterpolable(reported, current, timeMid, N_VGetArrayPointer(m_solverMem.outVars));
+			}
+			if (!accurate && hasPending)
+			{
+				ReportResults(pending);
+				std::swap(reported, pending);
+				hasPending = false;
+			}
+			if (isBreak)
+			{
+				ReportResults(current);
+				std::swap(reported, current);
+			}
+			else
+			{
+				std::swap(pending, current);
+				hasPending = true;
+			}
+			break;
+		}
+		}
+		if (isEvent)
+		{
+			/* restart integration with consistent conditions after the event */
+			if (!HandleEvent(isRoot, _time))
+				return false;
+			if (m_outputMode == EDAEOutputMode::ADAPTIVE)
+				StoreCurrentResults(reported);
+			if (!isFinal)
+			{
+				timeStop = NextStopTime(m_timeLast, _time);
+				res = IDASetStopTime(m_solverMem.idamem, timeStop);
+				if (res != IDA_SUCCESS)
+					return WriteError("IDA", "IDASetStopTime", "Cannot set integration stop time");
+			}
+		}
+		timePrev = m_timeLast;
+	} while (!isFinal);
+	ReportStatistics();
 	return true;
 }
 
@@ -165,43 +272,53 @@ void CDAESolver::SaveState()
 {
 	if (!m_model) return;
 	if (!m_solverMem.idamem) return;
-
-	const size_t len = m_model->GetVariablesNumber();
-	const auto* src = static_cast<IDAMem>(m_solverMem.idamem);
-
-	std::memcpy(m_solverMem_store.vars.data(), N_VGetArrayPointer(m_solverMem.vars), sizeof(double) * len);
-	std::memcpy(m_solverMem_store.ders.data(), N_VGetArrayPointer(m_solverMem.ders), sizeof(double) * len);
-
-	for (size_t i = 0; i < MXORDP1; ++i)
-		std::memcpy(m_solverMem_store.ida_phi[i].data(), N_VGetArrayPointer(src->ida_phi[i]), sizeof(double) * len);
-	std::memcpy(m_solverMem_store.ida_psi.data(), src->ida_psi, sizeof(double) * MXORDP1);
-	m_solverMem_store.ida_kused = src->ida_kused;
-	m_solverMem_store.ida_ns    = src->ida_ns;
-	m_solverMem_store.ida_hh    = src->ida_hh;
-	m_solverMem_store.ida_tn    = src->ida_tn;
-	m_solverMem_store.ida_cj    = src->ida_cj;
-	m_solverMem_store.ida_nst   = src->ida_nst;
+	if (m_solverMem_store.current) return;
+
+	/* the solution is kept by exchanging vectors, since the vectors of the solver are only used to receive new results */
+	std::swap(m_solverMem.vars, m_solverMem_store.vars);
+	std::swap(m_solverMem.ders, m_solverMem_store.ders);
+	m_solverMem_store.time = m_timeLast;
+	if (IDAGetCurrentStep(m_solverMem.idamem, &m_solverMem_store.step) != IDA_SUCCESS)
+		m_solverMem_store.step = 0.0;
+	m_solverMem_store.current = true;
 }
 
-void CDAESolver::LoadState() const
+void CDAESolver::LoadState()
 {
 	if (!m_model) return;
+	if (!m_solverMem.idamem) return;
+
+	/* counters of IDA are reset on reinitialization */
+	m_statistics += GetIDAStatistics();
+	/* restart from the stored solution with the stored step size instead of the initial estimate */
+	if (IDASetInitStep(m_solverMem.idamem, m_solverMem_store.step) != IDA_SUCCESS)
+		WriteError("IDA", "IDASetInitStep", "Cannot set initial step size.");
+	if (IDAReInit(m_solverMem.idamem, m_solverMem_store.time, m_solverMem_store.vars, m_solverMem_store.ders) != IDA_SUCCESS)
+		WriteError("IDA", "IDAReInit", "Cannot reinitialize solver with the saved state.");
 
 	const size_t len = m_model->GetVariablesNumber();
-	auto* dst = static_cast<IDAMem>(m_solverMem.idamem);
+	std::memcpy(N_VGetArrayPointer(m_solverMem.vars), N_VGetArrayPointer(m_solverMem_store.vars), sizeof(double) * len);
+	std::memcpy(N_VGetArrayPointer(m_solverMem.ders), N_VGetArrayPointer(m_solverMem_store.ders), sizeof(double) * len);
+	m_timeLast = m_solverMem_store.time;
+	m_solverMem_store.current = true;
+}
 
-	std::memcpy(N_VGetArrayPointer(m_solverMem.vars), m_solverMem_store.vars.data(), sizeof(double) * len);
-	std::memcpy(N_VGetArrayPointer(m_solverMem.ders), m_solverMem_store.ders.data(), sizeof(double) * len);
+SSolverStatistics CDAESolver::GetStatistics() const
+{
+	SSolverStatistics res = m_statistics;
+	if (m_solverMem.idamem)
+		res += GetIDAStatistics();
+	return res;
+}
 
-	for (size_t i = 0; i < MXORDP1; ++i)
-		std::memcpy(N_VGetArrayPointer(dst->ida_phi[i]), m_solverMem_store.ida_phi[i].data(), sizeof(double) * len);
-	std::memcpy(dst->ida_psi, m_solverMem_store.ida_psi.data(), sizeof(double) * MXORDP1);
-	dst->ida_kused = m_solverMem_store.ida_kused;
-	dst->ida_ns    = m_solverMem_store.ida_ns;
-	dst->ida_hh    = m_solverMem_store.ida_hh;
-	dst->ida_tn    = m_solverMem_store.ida_tn;
-	dst->ida_cj    = m_solverMem_store.ida_cj;
-	dst->ida_nst   = m_solverMem_store.ida_nst;
+void CDAESolver::SetStatisticsHandler(const std::function<void(const SSolverStatistics&)>& _handler)
+{
+	m_statisticsHandler = _handler;
+}
+
+bool CDAESolver::IsUserJacobianSupported()
+{
+	return SUNDIALS_VERSION_MAJOR > 2;
 }
 
 std::string CDAESolver::GetError() const
@@ -229,6 +346,50 @@ void CDAESolver::SetMaxStep(double _step)
 	m_maxStep = _step;
 }
 
+EDAEOutputMode CDAESolver::GetOutputMode() const
+{
+	return m_outputMode;
+}
+
+void CDAESolver::SetOutputMode(EDAEOutputMode _mode)
+{
+	m_outputMode = _mode;
+}
+
+double CDAESolver::GetOutputStep() const
+{
+	return m_outputStep;
+}
+
+void CDAESolver::SetOutputStep(double _step)
+{
+	m_outputStep = _step > 0.0 ? _step : 0.0;
+}
+
+std::vector<double> CDAESolver::GetOutputTimes() const
+{
+	return m_outputTimes;
+}
+
+void CDAESolver::SetOutputTimes(const std::vector<double>& _times)
+{
+	m_outputTimes = _times;
+	std::sort(m_outputTimes.begin(), m_outputTimes.end());
+	m_outputTimes.erase(std::unique(m_outputTimes.begin(), m_outputTimes.end()), m_outputTimes.end());
+}
+
+std::vector<double> CDAESolver::GetDiscontinuityTimes() const
+{
+	return m_discontinuityTimes;
+}
+
+void CDAESolver::SetDiscontinuityTimes(const std::vector<double>& _times)
+{
+	m_discontinuityTimes = _times;
+	std::sort(m_discontinuityTimes.begin(), m_discontinuityTimes.end());
+	m_discontinuityTimes.erase(std::unique(m_discontinuityTimes.begin(), m_discontinuityTimes.end()), m_discontinuityTimes.end());
+}
+
 bool CDAESolver::InitSolverMemory(SSolverMemory& _mem)
 {
 	int res; // return value
@@ -252,7 +413,9 @@ bool CDAESolver::InitSolverMemory(SSolverMemory& _mem)
 	_mem.atols  = N_VNew_Serial(len MAYBE_COMMA_CONTEXT(m_solverMem));
 	_mem.types  = N_VNew_Serial(len MAYBE_COMMA_CONTEXT(m_solverMem));
 	_mem.constr = N_VNew_Serial(len MAYBE_COMMA_CONTEXT(m_solverMem));
-	if (!_mem.vars || !_mem.ders || !_mem.atols || !_mem.types || !_mem.constr)
+	_mem.outVars = N_VNew_Serial(len MAYBE_COMMA_CONTEXT(m_solverMem));
+	_mem.outDers = N_VNew_Serial(len MAYBE_COMMA_CONTEXT(m_solverMem));
+	if (!_mem.vars || !_mem.ders || !_mem.atols || !_mem.types || !_mem.constr || !_mem.outVars || !_mem.outDers)
 		return WriteError("IDA", "N_VNew_Serial", "Cannot create vectors.");
 
 	// initialize vectors
@@ -304,6 +467,28 @@ bool CDAESolver::InitSolverMemory(SSolverMemory& _mem)
 	if (res != IDA_SUCCESS)
 		return WriteError("IDA", "IDASetLinearSolver", "Cannot set linear solver.");
 
+	// set root functions
+	if (m_model->GetRootsNumber() != 0)
+	{
+		res = IDARootInit(_mem.idamem, static_cast<int>(m_model->GetRootsNumber()), &CDAESolver::RootFunction);
+		if (res != IDA_SUCCESS)
+			return WriteError("IDA", "IDARootInit", "Cannot initialize root functions.");
+	}
+
+	// set Jacobian function
+#if SUNDIALS_VERSION_MAJOR > 2
+	if (m_model->IsAnalyticalJacobian() || !m_jacColors.empty())
+	{
+#if SUNDIALS_VERSION_MAJOR <= 3
+		res = IDADlsSetJacFn(_mem.idamem, &CDAESolver::JacobianFunction);
+#else
+		res = IDASetJacFn(_mem.idamem, &CDAESolver::JacobianFunction);
+#endif
+		if (res != IDA_SUCCESS)
+			return WriteError("IDA", "IDASetJacFn", "Cannot set Jacobian function.");
+	}
+#endif
+
 	// set optional inputs
 	// set error handler function
 #if SUNDIALS_VERSION_MAJOR < 7
@@ -315,8 +500,8 @@ bool CDAESolver::InitSolverMemory(SSolverMemory& _mem)
 	if (res != IDA_SUCCESS)
 		return WriteError("IDA", "SUNContext_PushErrHandler", "Cannot setup error handler function.");
 #endif
-	// set model as user data
-	res = IDASetUserData(_mem.idamem, m_model);
+	// set solver as user data
+	res = IDASetUserData(_mem.idamem, this);
 	if (res != IDA_SUCCESS)
 		return WriteError("IDA", "IDASetUserData", "Cannot set user data.");
 	// set max number of iteration steps
@@ -342,6 +527,8 @@ void CDAESolver::ClearSolverMemory(SSolverMemory& _mem)
 	if (_mem.atols)  N_VDestroy_Serial(_mem.atols);  _mem.atols  = nullptr;
 	if (_mem.types)  N_VDestroy_Serial(_mem.types);  _mem.types  = nullptr;
 	if (_mem.constr) N_VDestroy_Serial(_mem.constr); _mem.constr = nullptr;
+	if (_mem.outVars) N_VDestroy_Serial(_mem.outVars); _mem.outVars = nullptr;
+	if (_mem.outDers) N_VDestroy_Serial(_mem.outDers); _mem.outDers = nullptr;
 #if SUNDIALS_VERSION_MAJOR > 2
 	SUNMatDestroy(_mem.sunmatr);    _mem.sunmatr = nullptr;
 	SUNLinSolFree(_mem.linsol);     _mem.linsol  = nullptr;
@@ -352,32 +539,310 @@ void CDAESolver::ClearSolverMemory(SSolverMemory& _mem)
 #endif
 }
 
-void CDAESolver::InitStoreMemory(SStoreMemory& _mem) const
+bool CDAESolver::InitStoreMemory(SStoreMemory& _mem)
 {
 	const auto len = m_model->GetVariablesNumber();
-	_mem.vars.resize(len);
-	_mem.ders.resize(len);
-	_mem.ida_phi.resize(MXORDP1, std::vector<double>(len));
-	_mem.ida_psi.resize(MXORDP1);
+	_mem.vars = N_VNew_Serial(len MAYBE_COMMA_CONTEXT(m_solverMem));
+	_mem.ders = N_VNew_Serial(len MAYBE_COMMA_CONTEXT(m_solverMem));
+	if (!_mem.vars || !_mem.ders)
+		return WriteError("IDA", "N_VNew_Serial", "Cannot create vectors.");
+	_mem.time = 0.0;
+	_mem.step = 0.0;
+	_mem.current = false;
+	return true;
+}
+
+void CDAESolver::ClearStoreMemory(SStoreMemory& _mem)
+{
+	if (_mem.vars) N_VDestroy_Serial(_mem.vars); _mem.vars = nullptr;
+	if (_mem.ders) N_VDestroy_Serial(_mem.ders); _mem.ders = nullptr;
+	_mem.current = false;
 }
 
 void CDAESolver::Clear()
 {
 	m_model = nullptr;
 	m_errorMessage.clear();
+	m_jacColors.clear();
+	m_jacColumns.clear();
+	m_statistics = {};
+	m_timeLast = 0.0;
 
+	ClearStoreMemory(m_solverMem_store);
 	ClearSolverMemory(m_solverMem);
 }
 
-int CDAESolver::ResidualFunction(double _time, N_Vector _vals, N_Vector _ders, N_Vector _ress, void* _model)
+SSolverStatistics CDAESolver::GetIDAStatistics() const
+{
+	long steps{}, jacEvals{}, setups{}, iters{}, convFails{}, testFails{};
+	double step{};
+	IDAGetNumSteps(m_solverMem.idamem, &steps);
+#if SUNDIALS_VERSION_MAJOR <= 3
+	IDADlsGetNumJacEvals(m_solverMem.idamem, &jacEvals);
+#else
+	IDAGetNumJacEvals(m_solverMem.idamem, &jacEvals);
+#endif
+	IDAGetNumLinSolvSetups(m_solverMem.idamem, &setups);
+	IDAGetNumNonlinSolvIters(m_solverMem.idamem, &iters);
+	IDAGetNumNonlinSolvConvFails(m_solverMem.idamem, &convFails);
+	IDAGetNumErrTestFails(m_solverMem.idamem, &testFails);
+	IDAGetLastStep(m_solverMem.idamem, &step);
+
+	SSolverStatistics res;
+	res.steps               = static_cast<size_t>(steps);
+	res.jacobianEvaluations = static_cast<size_t>(jacEvals);
+	res.linearSolverSetups  = static_cast<size_t>(setups);
+	res.nonlinearIterations = static_cast<size_t>(iters);
+	res.nonlinearFailures   = static_cast<size_t>(convFails);
+	res.errorTestFailures   = static_cast<size_t>(testFails);
+	res.lastStep            = step;
+	return res;
+}
+
+double CDAESolver::NextStopTime(double _time, double _timeEnd) const
+{
+	const auto it = std::upper_bound(m_discontinuityTimes.begin(), m_discontinuityTimes.end(), _time);
+	return it != m_discontinuityTimes.end() ? std::min(*it, _timeEnd) : _timeEnd;
+}
+
+bool CDAESolver::HandleEvent(bool _isRoot, double _timeEnd)
+{
+	std::vector<int> roots;
+	if (_isRoot)
+	{
+		roots.resize(m_model->GetRootsNumber());
+		if (IDAGetRootInfo(m_solverMem.idamem, roots.data()) != IDA_SUCCESS)
+			return WriteError("IDA", "IDAGetRootInfo", "Cannot obtain information about found roots.");
+	}
+	m_model->HandleEvent(m_timeLast, N_VGetArrayPointer(m_solverMem.vars), N_VGetArrayPointer(m_solverMem.ders), _isRoot ? roots.data() : nullptr);
+
+	/* the next requested time point, needed to calculate consistent conditions */
+	double timeNext = _timeEnd;
+	if (timeNext <= m_timeLast)
+	{
+		double step;
+		if (IDAGetLastStep(m_solverMem.idamem, &step) != IDA_SUCCESS)
+			return WriteError("IDA", "IDAGetLastStep", "Cannot read last time step.");
+		timeNext = m_timeLast + step;
+	}
+
+	/* counters of IDA are reset on reinitialization */
+	m_statistics += GetIDAStatistics();
+	/* estimate the initial step anew, since the solution may change abruptly */
+	if (IDASetInitStep(m_solverMem.idamem, 0.0) != IDA_SUCCESS)
+		return WriteError("IDA", "IDASetInitStep", "Cannot reset initial step size.");
+	if (IDAReInit(m_solverMem.idamem, m_timeLast, m_solverMem.vars, m_solverMem.ders) != IDA_SUCCESS)
+		return WriteError("IDA", "IDAReInit", "Cannot reinitialize solver after event.");
+	if (IDACalcIC(m_solverMem.idamem, IDA_YA_YDP_INIT, timeNext) != IDA_SUCCESS)
+		return WriteError("IDA", "IDACalcIC", "Cannot calculate consistent conditions after event.");
+	if (IDAGetConsistentIC(m_solverMem.idamem, m_solverMem.vars, m_solverMem.ders) != IDA_SUCCESS)
+		return WriteError("IDA", "IDAGetConsistentIC", "Cannot obtain consistent conditions after event.");
+	return true;
+}
+
+bool CDAESolver::ReportGridResults(double _timeBeg, double _timeEnd)
+{
+	for (double time = NextOutputTime(_timeBeg); time < _timeEnd; time = NextOutputTime(time))
+	{
+		if (IDAGetDky(m_solverMem.idamem, time, 0, m_solverMem.outVars) != IDA_SUCCESS || IDAGetDky(m_solverMem.idamem, time, 1, m_solverMem.outDers) != IDA_SUCCESS)
+			return WriteError("IDA", "IDAGetDky", "Cannot interpolate solution.");
+		m_model->HandleResults(time, N_VGetArrayPointer(m_solverMem.outVars), N_VGetArrayPointer(m_solverMem.outDers));
+	}
+	return true;
+}
+
+double CDAESolver::NextOutputTime(double _time) const
+{
+	double res = std::numeric_limits<double>::infinity();
+	if (m_outputStep > 0.0)
+	{
+		res = (std::floor(_time / m_outputStep) + 1.0) * m_outputStep;
+		if (res <= _time) // rounding errors
+			res += m_outputStep;
+	}
+	const auto it = std::upper_bound(m_outputTimes.begin(), m_outputTimes.end(), _time);
+	if (it != m_outputTimes.end())
+		res = std::min(res, *it);
+	return res;
+}
+
+bool CDAESolver::IsInterpolable(const SOutputPoint& _beg, const SOutputPoint& _end, double _time, const double* _vars) const
+{
+	if (_end.time == _beg.time) return true;
+	const double rtol = m_model->GetRTol();
+	const double* atols = N_VGetArrayPointer(m_solverMem.atols);
+	const double factor = (_time - _beg.time) / (_end.time - _beg.time);
+	for (size_t i = 0; i < _beg.vars.size(); ++i)
+	{
+		const double interpolated = _beg.vars[i] + (_end.vars[i] - _beg.vars[i]) * factor;
+		if (std::abs(_vars[i] - interpolated) > rtol * std::abs(_vars[i]) + atols[i])
+			return false;
+	}
+	return true;
+}
+
+void CDAESolver::StoreCurrentResults(SOutputPoint& _point) const
+{
+	const size_t len = m_model->GetVariablesNumber();
+	/* right after saving or loading, the current solution is in the stored vectors */
+	const double* vars = N_VGetArrayPointer(m_solverMem_store.current ? m_solverMem_store.vars : m_solverMem.vars);
+	const double* ders = N_VGetArrayPointer(m_solverMem_store.current ? m_solverMem_store.ders : m_solverMem.ders);
+	_point.time = m_timeLast;
+	_point.vars.assign(vars, vars + len);
+	_point.ders.assign(ders, ders + len);
+}
+
+void CDAESolver::ReportResults(SOutputPoint& _point) const
+{
+	m_model->HandleResults(_point.time, _point.vars.data(), _point.ders.data());
+}
+
+bool CDAESolver::InitJacobianColoring()
+{
+	m_jacColors.clear();
+	m_jacColumns.clear();
+	const auto& pattern = m_model->GetJacobianPattern();
+	if (!IsUserJacobianSupported() && (!pattern.empty() || m_model->IsAnalyticalJacobian()))
+		return WriteError("IDA", "SetModel", "Analytical Jacobian and Jacobian sparsity pattern require SUNDIALS 3 or newer.");
+	if (pattern.empty() || m_model->IsAnalyticalJacobian()) return true;
+
+	const size_t len = m_model->GetVariablesNumber();
+	if (pattern.size() != len)
+		return WriteError("IDA", "SetModel", "Wrong size of the Jacobian sparsity pattern.");
+
+	// residuals depending on each variable
+	m_jacColumns.resize(len);
+	for (size_t i = 0; i < len; ++i)
+		for (const size_t j : pattern[i])
+		{
+			if (j >= len)
+				return WriteError("IDA", "SetModel", "Wrong index of variable in the Jacobian sparsity pattern.");
+			if (m_jacColumns[j].empty() || m_jacColumns[j].back() != i)
+				m_jacColumns[j].push_back(i);
+		}
+
+	// greedy coloring: a variable gets the smallest color not used by any variable sharing a residual with it
+	std::vector<size_t> colors(len);
+	std::vector<size_t> usedBy; // for each color, the last variable that found it occupied
+	for (size_t j = 0; j < len; ++j)
+	{
+		for (const size_t i : m_jacColumns[j])
+			for (const size_t k : pattern[i])
+				if (k < j)
+					usedBy[colors[k]] = j;
+		size_t color = 0;
+		while (color < usedBy.size() && usedBy[color] == j)
+			++color;
+		if (color == usedBy.size())
+		{
+			usedBy.push_back(len);
+			m_jacColors.emplace_back();
+		}
+		colors[j] = color;
+		m_jacColors[color].push_back(j);
+	}
+
+	// no gain compared to dense finite differences
+	if (m_jacColors.size() == len)
+	{
+		m_jacColors.clear();
+		m_jacColumns.clear();
+	}
+
+	return true;
+}
+
+bool CDAESolver::CalculateResiduals(double _time, double* _vals, double* _ders, double* _ress)
+{
+	const auto tStart = std::chrono::steady_clock::now();
+	const bool res = m_model->GetResiduals(_time, _vals, _ders, _ress);
+	m_statistics.residualTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+	m_statistics.residualEvaluations++;
+	return res;
+}
+
+int CDAESolver::ResidualFunction(double _time, N_Vector _vals, N_Vector _ders, N_Vector _ress, void* _solver)
 {
 	double* vals = N_VGetArrayPointer(_vals);
 	double* ders = N_VGetArrayPointer(_ders);
 	double* ress = N_VGetArrayPointer(_ress);
-	const bool res = static_cast<CDAEModel*>(_model)->GetResiduals(_time, vals, ders, ress);
+	const bool res = static_cast<CDAESolver*>(_solver)->CalculateResiduals(_time, vals, ders, ress);
 	return res ? 0 : -1;
 }
 
+int CDAESolver::RootFunction(double _time, N_Vector _vals, N_Vector _ders, double* _roots, void* _solver)
+{
+	static_cast<CDAESolver*>(_solver)->m_model->GetRoots(_time, N_VGetArrayPointer(_vals), N_VGetArrayPointer(_ders), _roots);
+	return 0;
+}
+
+#if SUNDIALS_VERSION_MAJOR > 2
+int CDAESolver::JacobianFunction(double _time, double _cj, N_Vector _vals, N_Vector _ders, N_Vector _ress, SUNMatrix _jac, void* _solver, N_Vector _tmp1, N_Vector _tmp2, N_Vector _tmp3)
+{
+	auto* solver = static_cast<CDAESolver*>(_solver);
+	if (solver->m_model->IsAnalyticalJacobian())
+	{
+		SUNMatZero(_jac);
+		const bool res = solver->m_model->GetJacobian(_time, N_VGetArrayPointer(_vals), N_VGetArrayPointer(_ders), N_VGetArrayPointer(_ress), _cj, SUNDenseMatrix_Data(_jac));
+		return res ? 0 : -1;
+	}
+	return solver->CalculateColoredJacobian(_time, _cj, _vals, _ders, _ress, _jac, _tmp1, _tmp2, _tmp3);
+}
+
+int CDAESolver::CalculateColoredJacobian(double _time, double _cj, N_Vector _vals, N_Vector _ders, N_Vector _ress, SUNMatrix _jac, N_Vector _tmpVals, N_Vector _tmpDers, N_Vector _tmpRess)
+{
+	const size_t len = m_model->GetVariablesNumber();
+	const double* vals = N_VGetArrayPointer(_vals);
+	const double* ders = N_VGetArrayPointer(_ders);
+	const double* ress = N_VGetArrayPointer(_ress);
+	const double* atols = N_VGetArrayPointer(m_solverMem.atols);
+	double* tmpVals = N_VGetArrayPointer(_tmpVals);
+	double* tmpDers = N_VGetArrayPointer(_tmpDers);
+	double* tmpRess = N_VGetArrayPointer(_tmpRess);
+	const double rtol = m_model->GetRTol();
+
+	double step;
+	if (IDAGetCurrentStep(m_solverMem.idamem, &step) != IDA_SUCCESS)
+		return -1;
+
+	SUNMatZero(_jac);
+	std::memcpy(tmpVals, vals, sizeof(double) * len);
+	std::memcpy(tmpDers, ders, sizeof(double) * len);
+	std::vector<double> increments(len);
+	const double srur = std::sqrt(std::numeric_limits<double>::epsilon());
+
+	for (const auto& color : m_jacColors)
+	{
+		// perturb all variables of the color, using the same increments as the internal finite differences of IDA
+		for (const size_t j : color)
+		{
+			double inc = std::max(srur * std::max(std::abs(vals[j]), std::abs(step * ders[j])), rtol * std::abs(vals[j]) + atols[j]);
+			if (step * ders[j] < 0.0)
+				inc = -inc;
+			inc = vals[j] + inc - vals[j];
+			increments[j] = inc;
+			tmpVals[j] += inc;
+			tmpDers[j] += _cj * inc;
+		}
+
+		if (!CalculateResiduals(_time, tmpVals, tmpDers, tmpRess))
+			return 1; // recoverable error
+
+		// each residual is influenced by at most one variable of the color
+		for (const size_t j : color)
+		{
+			double* column = SUNDenseMatrix_Column(_jac, static_cast<sunindextype>(j));
+			for (const size_t i : m_jacColumns[j])
+				column[i] = (tmpRess[i] - ress[i]) / increments[j];
+			tmpVals[j] = vals[j];
+			tmpDers[j] = ders[j];
+		}
+	}
+
+	return 0;
+}
+#endif
+
 #if SUNDIALS_VERSION_MAJOR < 7
 void CDAESolver::ErrorHandler(int _errorCode, const char* _module, const char* _function, char* _message, void* _outString)
 {
@@ -411,5 +876,13 @@ void CDAESolver::AppendMessage(const std::string& _module, const std::string& _f
 bool CDAESolver::WriteError(const std::string& _module, const std::string& _function, const std::string& _message)
 {
 	AppendMessage(_module, _function, _message, m_errorMessage);
+	/* failed calls are reported as well */
+	ReportStatistics();
 	return false;
 }
+
+void CDAESolver::ReportStatistics() const
+{
+	if (m_statisticsHandler)
+		m_statisticsHandler(GetStatistics());
+}
@@ -5,6 +5,8 @@
 #pragma once
 
 #include "DAEModel.h"
+#include "SolverStatistics.h"
+#include <functional>
 #include <string>
 #include "DisableWarningHelper.h"
 PRAGMA_WARNING_DISABLE
@@ -15,6 +17,14 @@ PRAGMA_WARNING_DISABLE
 #endif
 PRAGMA_WARNING_RESTORE
 
+/** Mode of reporting results of integration to the model. */
+enum class EDAEOutputMode
+{
+	EACH_STEP,	///< Results are reported after each internal step of the solver.
+	GRID,		///< Results are reported at requested output time points, interpolated between internal steps of the solver.
+	ADAPTIVE	///< Results are reported only when linear interpolation between reported time points would exceed the tolerances of the model.
+};
+
 /**
  * Solver of differential algebraic equations. Uses IDA solver from SUNDIALS package.
  */
@@ -36,21 +46,27 @@ class CDAESolver
 		N_Vector atols{};         ///< Vector of absolute tolerances.
 		N_Vector types{};         ///< Vector of variables' types: algebraic/differential.
 		N_Vector constr{};        ///< Vector of variables' constraints.
+		N_Vector outVars{};       ///< Vector of interpolated variables for output.
+		N_Vector outDers{};       ///< Vector of interpolated derivatives for output.
+	};
+
+	/** A single state of the model reported or pending to be reported in adaptive output mode. */
+	struct SOutputPoint
+	{
+		double time{};            ///< Time point.
+		std::vector<double> vars; ///< Values of variables.
+		std::vector<double> ders; ///< Values of derivatives.
 	};
 
-	/** Data field from IDA memory needed to be temporary stored. */
+	/** State of the solver stored to restart integration from it.
+	 *  Vectors are exchanged with the vectors of the solver on saving, so the saving does not copy any data. */
 	struct SStoreMemory
 	{
-		std::vector<double> vars;
-		std::vector<double> ders;
-		std::vector<std::vector<double>> ida_phi;
-		std::vector<double> ida_psi;
-		int ida_kused;
-		int ida_ns;
-		double ida_hh;
-		double ida_tn;
-		double ida_cj;
-		long int ida_nst;
+		N_Vector vars{};          ///< Vector of variables.
+		N_Vector ders{};          ///< Vector of derivatives.
+		double time{};            ///< Time point of the stored state.
+		double step{};            ///< Size of the next internal time step at the stored state.
+		bool current{};           ///< Whether the stored state is the current state of the solver, i.e. the solver has not integrated since the last saving or loading.
 	};
 
 	CDAEModel* m_model{};	          ///< Pointer to a DAE model.
@@ -62,6 +78,17 @@ class CDAESolver
 	double m_maxStep{};               ///< Maximum iteration time step.
 	size_t m_maxNumSteps{ 500 };      ///< Maximum number of allowed solver iterations.
 
+	EDAEOutputMode m_outputMode{ EDAEOutputMode::EACH_STEP }; ///< Mode of reporting results to the model.
+	double m_outputStep{};            ///< Step of the regular output grid in GRID mode. 0 to disable.
+	std::vector<double> m_outputTimes;///< Sorted additional output time points in GRID mode.
+	std::vector<double> m_discontinuityTimes; ///< Sorted time points, at which integration is stopped and restarted.
+
+	std::vector<std::vector<size_t>> m_jacColors;  ///< Groups of structurally independent variables, perturbed simultaneously in colored finite differences.
+	std::vector<std::vector<size_t>> m_jacColumns; ///< Indices of residuals depending on each variable, according to the sparsity pattern of the model.
+
+	SSolverStatistics m_statistics{}; ///< Own counters of the solver and counters of IDA accumulated before its last reinitialization.
+	std::function<void(const SSolverStatistics&)> m_statisticsHandler; ///< Function receiving statistics of the solver after each call.
+
 	std::string m_errorMessage;	      ///< Text description of the occurred errors.
 
 public:
@@ -97,8 +124,21 @@ public:
 	*	Should be called during saving of unit. */
 	void SaveState();
 	/** Load current state of solver.
+	*	Integration is restarted from the saved variables and derivatives with the saved step size.
+	*	IDA has no public setter for the order of the method, so the restarted integration begins at first order.
 	*	Should be called during loading of unit. */
-	void LoadState() const;
+	void LoadState();
+
+	/** Returns statistics of the solver, accumulated since the model was set.
+	 *	\return Solver statistics. */
+	[[nodiscard]] SSolverStatistics GetStatistics() const;
+	/** Sets a function receiving statistics of the solver, accumulated since the model was set, after each call of the solver.
+	 *	\param _handler Function receiving statistics. */
+	void SetStatisticsHandler(const std::function<void(const SSolverStatistics&)>& _handler);
+
+	/** Checks whether user-defined Jacobians, i.e. the analytical Jacobian or the sparsity pattern of the model, can be used with the linked version of SUNDIALS.
+	 *	\return Whether user-defined Jacobians are supported. */
+	[[nodiscard]] static bool IsUserJacobianSupported();
 
 	/** Returns error description.
 	 *	\return Current error description. */
@@ -117,6 +157,35 @@ public:
 	 *	\param _step Time step. */
 	void SetMaxStep(double _step);
 
+	/** Returns the mode of reporting results to the model.
+	 *	\return Output mode. */
+	[[nodiscard]] EDAEOutputMode GetOutputMode() const;
+	/** Sets the mode of reporting results to the model.
+	 *	In all modes, results are reported at the end of each integration interval.
+	 *	\param _mode Output mode. */
+	void SetOutputMode(EDAEOutputMode _mode);
+	/** Returns the step of the regular output grid used in EDAEOutputMode::GRID mode.
+	 *	\return Output step. */
+	[[nodiscard]] double GetOutputStep() const;
+	/** Sets the step of the regular output grid used in EDAEOutputMode::GRID mode.
+	 *	Results are reported at all multiples of the step. Set 0 to use only the explicitly given output time points.
+	 *	\param _step Output step. */
+	void SetOutputStep(double _step);
+	/** Returns additional output time points used in EDAEOutputMode::GRID mode.
+	 *	\return Output time points. */
+	[[nodiscard]] std::vector<double> GetOutputTimes() const;
+	/** Sets additional output time points used in EDAEOutputMode::GRID mode.
+	 *	\param _times Output time points. */
+	void SetOutputTimes(const std::vector<double>& _times);
+
+	/** Returns time points of known discontinuities.
+	 *	\return Discontinuity time points. */
+	[[nodiscard]] std::vector<double> GetDiscontinuityTimes() const;
+	/** Sets time points of known discontinuities, e.g. step changes of inputs.
+	 *	The solver stops exactly at these time points within IntegrateUntil, calls the event handler of the model and restarts integration with consistent conditions.
+	 *	\param _times Discontinuity time points. */
+	void SetDiscontinuityTimes(const std::vector<double>& _times);
+
 private:
 	/** Allocates and initializes memory required for solver.
 	 *	\param _mem Reference to the memory struct.
@@ -126,21 +195,109 @@ private:
 	 *	\param _mem Reference to the memory struct. */
 	static void ClearSolverMemory(SSolverMemory& _mem);
 	/** Initializes memory required for storing solver data.
+	 *	\param _mem Reference to the memory struct.
+	 *	\retval true No errors occurred. */
+	bool InitStoreMemory(SStoreMemory& _mem);
+	/** Clear allocated memory for storing solver data.
 	 *	\param _mem Reference to the memory struct. */
-	void InitStoreMemory(SStoreMemory& _mem) const;
+	static void ClearStoreMemory(SStoreMemory& _mem);
 
 	/** De-allocates and clears all internal data. */
 	void Clear();
 
+	/** Groups variables of the model into colors according to the sparsity pattern of the Jacobian,
+	 *	so that no two variables of the same color influence the same residual.
+	 *	\retval true No errors occurred. */
+	bool InitJacobianColoring();
+
+	/** Returns the time point where integration must be stopped: the next discontinuity after the given time point or the end of the interval.
+	 *	\param _time Time point.
+	 *	\param _timeEnd End of the integration interval.
+	 *	\return Stop time point. */
+	[[nodiscard]] double NextStopTime(double _time, double _timeEnd) const;
+	/** Returns current counters of IDA, which are reset on its reinitialization.
+	 *	\return Statistics with the counters of IDA. */
+	[[nodiscard]] SSolverStatistics GetIDAStatistics() const;
+	/** Passes the event at the current time point to the model and restarts integration with consistent conditions.
+	 *	\param _isRoot Whether the event is a root of root functions or a discontinuity time point.
+	 *	\param _timeEnd End of the integration interval.
+	 *	\retval true No errors occurred. */
+	bool HandleEvent(bool _isRoot, double _timeEnd);
+	/** Reports results to the model at all output grid points within the interval (_timeBeg, _timeEnd), interpolating between internal steps.
+	 *	\param _timeBeg Beginning of the interval.
+	 *	\param _timeEnd End of the interval.
+	 *	\retval true No errors occurred. */
+	bool ReportGridResults(double _timeBeg, double _timeEnd);
+	/** Returns the first output grid point after the given time point.
+	 *	\param _time Time point.
+	 *	\return Next output time point or infinity if there are no more output time points. */
+	[[nodiscard]] double NextOutputTime(double _time) const;
+	/** Checks whether the state at a given time point can be obtained with the required accuracy by linear interpolation between two points.
+	 *	\param _beg First point of the interpolation.
+	 *	\param _end Last point of the interpolation.
+	 *	\param _time Time of the checked state.
+	 *	\param _vars Variables of the checked state.
+	 *	\return Whether the interpolation is accurate enough. */
+	[[nodiscard]] bool IsInterpolable(const SOutputPoint& _beg, const SOutputPoint& _end, double _time, const double* _vars) const;
+	/** Copies the current solution of the solver into the output point.
+	 *	\param _point Output point. */
+	void StoreCurrentResults(SOutputPoint& _point) const;
+	/** Reports the given output point to the model.
+	 *	\param _point Output point. */
+	void ReportResults(SOutputPoint& _point) const;
+
 	/** A callback function called to calculate the problem residuals.
 	*   The function computes residual for given values of the independent variables, state vectors, and derivatives.
 	*	\param _time Current value of the independent variable.
 	*	\param _vals Current value of the dependent variable vector, y(t).
 	*	\param _ders Current value of derivative y'(t).
 	*	\param _ress Output residual vector F(t, y, y').
-	*	\param _model Pointer to a DAE model.
+	*	\param _solver Pointer to the solver.
+	*	\return Error code. */
+	static int ResidualFunction(double _time, N_Vector _vals, N_Vector _ders, N_Vector _ress, void *_solver);
+	/** Calculates residuals of the model and updates the statistics.
+	*	\param _time Current value of the independent variable.
+	*	\param _vals Current value of the dependent variable vector, y(t).
+	*	\param _ders Current value of derivative y'(t).
+	*	\param _ress Output residual vector F(t, y, y').
+	*	\retval true No errors occurred. */
+	bool CalculateResiduals(double _time, double* _vals, double* _ders, double* _ress);
+	/** A callback function called to calculate root functions of the model.
+	*	\param _time Current value of the independent variable.
+	*	\param _vals Current value of the dependent variable vector, y(t).
+	*	\param _ders Current value of derivative y'(t).
+	*	\param _roots Output values of root functions.
+	*	\param _solver Pointer to the solver.
 	*	\return Error code. */
-	static int ResidualFunction(double _time, N_Vector _vals, N_Vector _ders, N_Vector _ress, void *_model);
+	static int RootFunction(double _time, N_Vector _vals, N_Vector _ders, double* _roots, void* _solver);
+#if SUNDIALS_VERSION_MAJOR > 2
+	/** A callback function called to calculate the Jacobian J = dF/dy + _cj * dF/dy'.
+	*	Uses analytical Jacobian of the model if available, otherwise colored finite differences.
+	*	\param _time Current value of the independent variable.
+	*	\param _cj Scalar in the system Jacobian, proportional to the inverse of the step size.
+	*	\param _vals Current value of the dependent variable vector, y(t).
+	*	\param _ders Current value of derivative y'(t).
+	*	\param _ress Current residual vector F(t, y, y').
+	*	\param _jac Output Jacobian matrix.
+	*	\param _solver Pointer to the solver.
+	*	\param _tmp1 Temporary vector.
+	*	\param _tmp2 Temporary vector.
+	*	\param _tmp3 Temporary vector.
+	*	\return Error code. */
+	static int JacobianFunction(double _time, double _cj, N_Vector _vals, N_Vector _ders, N_Vector _ress, SUNMatrix _jac, void* _solver, N_Vector _tmp1, N_Vector _tmp2, N_Vector _tmp3);
+	/** Calculates the Jacobian with finite differences, perturbing all variables of the same color at once.
+	*	\param _time Current value of the independent variable.
+	*	\param _cj Scalar in the system Jacobian, proportional to the inverse of the step size.
+	*	\param _vals Current value of the dependent variable vector, y(t).
+	*	\param _ders Current value of derivative y'(t).
+	*	\param _ress Current residual vector F(t, y, y').
+	*	\param _jac Output Jacobian matrix.
+	*	\param _tmpVals Temporary vector for perturbed variables.
+	*	\param _tmpDers Temporary vector for perturbed derivatives.
+	*	\param _tmpRess Temporary vector for perturbed residuals.
+	*	\return Error code. */
+	int CalculateColoredJacobian(double _time, double _cj, N_Vector _vals, N_Vector _ders, N_Vector _ress, SUNMatrix _jac, N_Vector _tmpVals, N_Vector _tmpDers, N_Vector _tmpRess);
+#endif
 
 #if SUNDIALS_VERSION_MAJOR < 7
 	/** A callback function called by the solver to handle internal errors.
@@ -182,4 +339,6 @@ private:
 	*	\param _message The error message
 	*	\return false */
 	bool WriteError(const std::string& _module, const std::string& _function, const std::string& _message);
+	/** Passes current statistics of the solver to the statistics handler, if it is set. */
+	void ReportStatistics() const;
 };
@@ -91,9 +91,30 @@ void CNLModel::ResultsHandler(double _dTime, double* _pVars, void* _pUserData)
 
 }
 
+void CNLModel::CalculateSystemFunctions(size_t /*_system*/, double* _pVars, double* _pFunc, void* _pUserData)
+{
+	CalculateFunctions(_pVars, _pFunc, _pUserData);
+}
+
+void CNLModel::SystemResultsHandler(size_t /*_system*/, double* /*_pVars*/, void* /*_pUserData*/)
+{
+
+}
+
 bool CNLModel::GetFunctions(double* _pVars, double* _pFunc)
 {
 	CalculateFunctions(_pVars, _pFunc, m_pUserData );
+	return FinalizeFunctions(_pVars, _pFunc);
+}
+
+bool CNLModel::GetSystemFunctions(size_t _system, double* _pVars, double* _pFunc)
+{
+	CalculateSystemFunctions(_system, _pVars, _pFunc, m_pUserData);
+	return FinalizeFunctions(_pVars, _pFunc);
+}
+
+bool CNLModel::FinalizeFunctions(double* _pVars, double* _pFunc) const
+{
 	bool bRet = false;
 	if( !m_vVariables.empty() )
 	{
@@ -113,3 +134,8 @@ void CNLModel::HandleResults( double _dTime, double* _pVars )
 {
 	ResultsHandler( _dTime, _pVars, m_pUserData );
 }
+
+void CNLModel::HandleSystemResults(size_t _system, double* _pVars)
+{
+	SystemResultsHandler(_system, _pVars, m_pUserData);
+}
@@ -103,6 +103,20 @@ public:
 	 *	\param _pVars Current value of the dependent variable vector, u(t)
 	 *	\param _pUserData Pointer to user's data*/
 	virtual void ResultsHandler(double _dTime, double* _pVars, void* _pUserData);
+	/** Calculate nonlinear functions of one of the independent systems solved with CNLSolver::CalculateBatch.
+	 *	Called in parallel for different systems, so it must not modify any data shared between systems.
+	 *	By default, calls \a CalculateFunctions.
+	 *	\param _system Index of the system
+	 *	\param _pVars Current value of the dependent variable vector, u(t)
+	 *	\param _pFunc Output function vector F(u)
+	 *	\param _pUserData Pointer to user's data*/
+	virtual void CalculateSystemFunctions(size_t _system, double* _pVars, double* _pFunc, void* _pUserData);
+	/** Handle results of one of the independent systems solved with CNLSolver::CalculateBatch.
+	 *	Called sequentially for all systems after all of them are solved.
+	 *	\param _system Index of the system
+	 *	\param _pVars Solution of the system
+	 *	\param _pUserData Pointer to user's data*/
+	virtual void SystemResultsHandler(size_t _system, double* _pVars, void* _pUserData);
 
 	// ========== Functions for calling from solver
 
@@ -110,4 +124,13 @@ public:
 	bool GetFunctions(double* _pVars, double* _pFunc);
 	/** Handle results. Calls ResultsHandler.*/
 	void HandleResults( double _dTime, double* _pVars );
+	/** Calculate functions of the given system. Calls CalculateSystemFunctions.*/
+	bool GetSystemFunctions(size_t _system, double* _pVars, double* _pFunc);
+	/** Handle results of the given system. Calls SystemResultsHandler.*/
+	void HandleSystemResults(size_t _system, double* _pVars);
+
+private:
+	/** Check calculated functions and bring them to the form required by the solver strategy.
+	 *	\retval true Functions are valid*/
+	bool FinalizeFunctions(double* _pVars, double* _pFunc) const;
 };
@@ -4,6 +4,7 @@
 
 #include "NLSolver.h"
 #include "DyssolUtilities.h"
+#include "ThreadPool.h"
 PRAGMA_WARNING_DISABLE
 #include <kinsol/kinsol.h>
 #if SUNDIALS_VERSION_MAJOR <= 3
@@ -13,6 +14,8 @@ PRAGMA_WARNING_DISABLE
 #include <sunlinsol/sunlinsol_dense.h>
 #endif
 PRAGMA_WARNING_RESTORE
+#include <algorithm>
+#include <chrono>
 #include <cstring>
 
 // Macros for convenient adding context to functions depending on the sundials version
@@ -66,6 +69,7 @@ CNLSolver::~CNLSolver()
 void CNLSolver::SetStrategy(ENLSolverStrategy _eStrategy)
 {
 	m_eStrategy = _eStrategy;
+	m_batchSolvers.clear(); // recreated with new settings on demand
 }
 
 ENLSolverStrategy CNLSolver::GetStrategy()
@@ -76,6 +80,7 @@ ENLSolverStrategy CNLSolver::GetStrategy()
 void CNLSolver::SetMaxIter(size_t _nMaxIter)
 {
 	m_nMaxIter = static_cast<long>(_nMaxIter);
+	m_batchSolvers.clear(); // recreated with new settings on demand
 }
 
 bool CNLSolver::SetNewtonSolverParameters(unsigned _nMaxSet, unsigned _nMaxSubSet)
@@ -84,6 +89,7 @@ bool CNLSolver::SetNewtonSolverParameters(unsigned _nMaxSet, unsigned _nMaxSubSe
 	{
 		m_nMaxSet = static_cast<long>(_nMaxSet);
 		m_nMaxSubSet = static_cast<long>(_nMaxSubSet);
+		m_batchSolvers.clear(); // recreated with new settings on demand
 		return true;
 	}
 	else
@@ -97,6 +103,7 @@ bool CNLSolver::SetFixedPointSolverParameters(size_t _nMAA, double _dDampingAA,
 		m_nMAA = static_cast<long>(_nMAA);
 		m_dDampingAA = _dDampingAA;
 		m_dDamping = _dDamping;
+		m_batchSolvers.clear(); // recreated with new settings on demand
 		return true;
 	}
 	else
@@ -113,6 +120,8 @@ void CNLSolver::SetSolverMaxIter(size_t _nMaxIter)
 	m_nMaxIter = static_cast<long>(_nMaxIter);
 	if (m_pKINmem)
 		KINSetNumMaxIters(m_pKINmem, m_nMaxIter);
+	for (auto& solver : m_batchSolvers)
+		solver->SetSolverMaxIter(_nMaxIter);
 }
 
 unsigned CNLSolver::GetSolverIter()
@@ -219,7 +228,7 @@ bool CNLSolver::SetModel(CNLModel* _pModel)
 		return false;
 
 	// Set model as user data
-	if( KINSetUserData( m_pKINmem, m_pModel) != KIN_SUCCESS)
+	if( KINSetUserData( m_pKINmem, this) != KIN_SUCCESS)
 		return false;
 
 #if SUNDIALS_VERSION_MAJOR > 2
@@ -247,16 +256,128 @@ bool CNLSolver::SetModel(CNLModel* _pModel)
 
 bool CNLSolver::Calculate(double _dTime)
 {
-	const int ret = KINSol(m_pKINmem, m_vectorVars, (int)E2I(m_eStrategy), m_vectorUScales, m_vectorFScales);
+	const bool success = Solve();
+	ReportStatistics();
+	if (!success)
+		return false;
 
-	if (ret == KIN_SUCCESS || ret == KIN_INITIAL_GUESS_OK || ret ==  KIN_STEP_LT_STPTOL)
-		m_pModel->HandleResults(_dTime, NV_DATA_S(m_vectorVars));
-	else
+	m_pModel->HandleResults(_dTime, NV_DATA_S(m_vectorVars));
+
+	return true;
+}
+
+bool CNLSolver::CalculateBatch(size_t _systemsNumber)
+{
+	if (!m_pModel || !m_pKINmem)
+		return WriteError("KIN", "CalculateBatch", "Model is not set.");
+	if (_systemsNumber == 0)
+		return true;
+
+	const auto nVars = static_cast<size_t>(NV_LENGTH_S(m_vectorVars));
+	const size_t nRanges = std::min(_systemsNumber, std::max<size_t>(getThreadPool().GetThreadsNumber(), 1));
+
+	// prepare solvers sequentially, since their initialization accesses the model
+	std::vector<CNLSolver*> solvers(nRanges);
+	for (size_t i = 0; i < nRanges; ++i)
+	{
+		solvers[i] = GetBatchSolver(i);
+		if (!solvers[i])
+			return false;
+	}
+
+	std::vector<double> solutions(_systemsNumber * nVars);	// solutions of all systems
+	std::vector<size_t> failed(nRanges, _systemsNumber);	// index of the failed system in each range
+	ParallelFor(nRanges, [&](size_t i)
+	{
+		CNLSolver* solver = solvers[i];
+		solver->m_statistics = {};
+		solver->m_errorMessage.clear();
+		// start from the last solution of this solver
+		CopyNVector(solver->m_vectorVars, m_vectorVars);
+		const size_t iBeg = i * _systemsNumber / nRanges;
+		const size_t iEnd = (i + 1) * _systemsNumber / nRanges;
+		for (size_t j = iBeg; j < iEnd; ++j)
+		{
+			// the solution of the previous system remains in the vector of variables as an initial guess
+			solver->m_batchSystem = j;
+			if (!solver->Solve())
+			{
+				failed[i] = j;
+				return;
+			}
+			std::memcpy(solutions.data() + j * nVars, NV_DATA_S(solver->m_vectorVars), sizeof(double) * nVars);
+		}
+	});
+
+	bool success = true;
+	for (size_t i = 0; i < nRanges; ++i)
+	{
+		m_statistics += solvers[i]->m_statistics;
+		if (failed[i] == _systemsNumber) continue;
+		success = WriteError("KIN", "CalculateBatch", "Cannot solve system " + std::to_string(failed[i]) + ".");
+		if (!solvers[i]->m_errorMessage.empty())
+			m_errorMessage += "\n" + solvers[i]->m_errorMessage;
+	}
+	ReportStatistics();
+	if (!success)
 		return false;
 
+	for (size_t j = 0; j < _systemsNumber; ++j)
+		m_pModel->HandleSystemResults(j, solutions.data() + j * nVars);
+
+	// keep the last solution as an initial guess for the next calls
+	std::memcpy(NV_DATA_S(m_vectorVars), solutions.data() + (_systemsNumber - 1) * nVars, sizeof(double) * nVars);
+
 	return true;
 }
 
+bool CNLSolver::Solve()
+{
+	const auto tStart = std::chrono::steady_clock::now();
+	const int ret = KINSol(m_pKINmem, m_vectorVars, (int)E2I(m_eStrategy), m_vectorUScales, m_vectorFScales);
+	m_statistics.solverTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+
+	// counters of KINSOL are reset on each call
+	long nIter{}, nJacEvals{}, nFails{};
+	KINGetNumNonlinSolvIters(m_pKINmem, &nIter);
+#if SUNDIALS_VERSION_MAJOR <= 3
+	KINDlsGetNumJacEvals(m_pKINmem, &nJacEvals);
+#else
+	KINGetNumJacEvals(m_pKINmem, &nJacEvals);
+#endif
+	KINGetNumBetaCondFails(m_pKINmem, &nFails);
+	m_statistics.calls++;
+	m_statistics.nonlinearIterations += static_cast<size_t>(nIter);
+	m_statistics.jacobianEvaluations += static_cast<size_t>(nJacEvals);
+	m_statistics.nonlinearFailures += static_cast<size_t>(nFails) + (ret < 0 ? 1 : 0);
+
+	return ret == KIN_SUCCESS || ret == KIN_INITIAL_GUESS_OK || ret == KIN_STEP_LT_STPTOL;
+}
+
+CNLSolver* CNLSolver::GetBatchSolver(size_t _index)
+{
+	while (m_batchSolvers.size() <= _index)
+	{
+		auto solver = std::make_unique<CNLSolver>(m_eStrategy);
+		solver->m_nMaxIter      = m_nMaxIter;
+		solver->m_nMaxSet       = m_nMaxSet;
+		solver->m_nMaxSubSet    = m_nMaxSubSet;
+		solver->m_nMAA          = m_nMAA;
+		solver->m_dDampingAA    = m_dDampingAA;
+		solver->m_dDamping      = m_dDamping;
+		solver->m_isBatchSolver = true;
+		if (!solver->SetModel(m_pModel))
+		{
+			WriteError("KIN", "CalculateBatch", "Cannot initialize solver for independent systems.");
+			if (!solver->m_errorMessage.empty())
+				m_errorMessage += "\n" + solver->m_errorMessage;
+			return nullptr;
+		}
+		m_batchSolvers.push_back(std::move(solver));
+	}
+	return m_batchSolvers[_index].get();
+}
+
 void CNLSolver::SaveState()
 {
 	CopyNVector(m_StoreVectorVars, m_vectorVars);
@@ -272,12 +393,26 @@ std::string CNLSolver::GetError() const
 	return m_errorMessage;
 }
 
-int CNLSolver::ResidualFunction(N_Vector _value, N_Vector _func, void *_pModel)
+SSolverStatistics CNLSolver::GetStatistics() const
+{
+	return m_statistics;
+}
+
+void CNLSolver::SetStatisticsHandler(const std::function<void(const SSolverStatistics&)>& _handler)
+{
+	m_statisticsHandler = _handler;
+}
+
+int CNLSolver::ResidualFunction(N_Vector _value, N_Vector _func, void *_pSolver)
 {
 	double* pValue = NV_DATA_S(_value);
 	double* pFunc = NV_DATA_S(_func);
 
-	const bool bRes = static_cast<CNLModel*>(_pModel)->GetFunctions(pValue, pFunc);
+	auto* pSolver = static_cast<CNLSolver*>(_pSolver);
+	const auto tStart = std::chrono::steady_clock::now();
+	const bool bRes = pSolver->m_isBatchSolver ? pSolver->m_pModel->GetSystemFunctions(pSolver->m_batchSystem, pValue, pFunc) : pSolver->m_pModel->GetFunctions(pValue, pFunc);
+	pSolver->m_statistics.residualTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+	pSolver->m_statistics.residualEvaluations++;
 
 	return bRes ? 0 : -1;
 }
@@ -285,6 +420,8 @@ int CNLSolver::ResidualFunction(N_Vector _value, N_Vector _func, void *_pModel)
 void CNLSolver::ClearMemory()
 {
 	m_errorMessage.clear();
+	m_statistics = {};
+	m_batchSolvers.clear();
 
 #if SUNDIALS_VERSION_MAJOR > 2
 	// free memory associates with the KINDls system solver interface.
@@ -349,3 +486,9 @@ bool CNLSolver::WriteError(const std::string& _module, const std::string& _funct
 	AppendMessage(_module, _function, _message, m_errorMessage);
 	return false;
 }
+
+void CNLSolver::ReportStatistics() const
+{
+	if (m_statisticsHandler)
+		m_statisticsHandler(m_statistics);
+}
@@ -5,7 +5,11 @@
 #pragma once
 
 #include "NLModel.h"
+#include "SolverStatistics.h"
+#include <functional>
+#include <memory>
 #include <string>
+#include <vector>
 #include "DisableWarningHelper.h"
 PRAGMA_WARNING_DISABLE
 #include <nvector/nvector_serial.h>
@@ -34,6 +38,9 @@ private:
 
 	std::string m_errorMessage;	        ///< Text description of the last occurred error
 
+	SSolverStatistics m_statistics{};	///< Statistics of the solver accumulated over all calls.
+	std::function<void(const SSolverStatistics&)> m_statisticsHandler;	///< Function receiving statistics of the solver after each call.
+
 	// Variables for storing
 	N_Vector m_StoreVectorVars;			///< Memory for storing of vector of variables
 
@@ -56,6 +63,11 @@ private:
 	SUNContext m_sunctx{};              ///< SUNDIALS simulation context.
 #endif
 
+	// Batch solution
+	std::vector<std::unique_ptr<CNLSolver>> m_batchSolvers;	///< Solvers with own KINSOL memory, used by parallel threads to solve independent systems.
+	bool m_isBatchSolver{ false };		///< Whether this solver is used to solve one of the independent systems of a batch.
+	size_t m_batchSystem{ 0 };			///< Index of the currently solved system of a batch.
+
 public:
 	/**	Basic constructor.*/
 	CNLSolver();
@@ -96,6 +108,13 @@ public:
 	 *	\param _dTime Time point
 	 *	\retval true No errors occurred*/
 	bool Calculate(double _dTime);
+	/** Solve a batch of independent systems, which share the structure of the model, e.g. one system per time point or per size class.
+	 *	Systems are split into contiguous ranges, which are solved in parallel, each by a separate instance of KINSOL.
+	 *	Each system is started from the solution of the previous one in its range, and the first system of each range from the last solution of this solver.
+	 *	Functions are calculated with CNLModel::CalculateSystemFunctions; after all systems are solved, CNLModel::SystemResultsHandler is called for each of them in order.
+	 *	\param _systemsNumber Number of systems
+	 *	\retval true No errors occurred*/
+	bool CalculateBatch(size_t _systemsNumber);
 
 	/** Save current state of solver. Should be called during saving of unit.*/
 	void SaveState();
@@ -105,13 +124,29 @@ public:
 	/** Return error description.*/
 	std::string GetError() const;
 
+	/** Returns statistics of the solver, accumulated since the model was set.
+	 *	\return Solver statistics.*/
+	SSolverStatistics GetStatistics() const;
+	/** Sets a function receiving statistics of the solver, accumulated since the model was set, after each call of the solver.
+	 *	\param _handler Function receiving statistics.*/
+	void SetStatisticsHandler(const std::function<void(const SSolverStatistics&)>& _handler);
+
 private:
 	/** Calculate residuals. Function computes residual for given values of the independent variable and the function value.
 	 *	\param _value Current value of the dependent variable vector, y
 	 *	\param _func  Current function value of value, f(y)
-	 *	\param _pModel Pointer to a DAE model
+	 *	\param _pSolver Pointer to the solver
 	 *	\return Error code*/
-	static int ResidualFunction(N_Vector _value, N_Vector _func, void *_pModel);
+	static int ResidualFunction(N_Vector _value, N_Vector _func, void *_pSolver);
+
+	/** Run KINSOL on the current values of variables and update statistics.
+	 *	\retval true No errors occurred*/
+	bool Solve();
+
+	/** Returns a solver to solve the given range of systems of a batch. Creates the solver if it does not exist yet.
+	 *	\param _index Index of the range
+	 *	\return Pointer to the solver or nullptr on error*/
+	CNLSolver* GetBatchSolver(size_t _index);
 
 	/** Clear all allocated memory.*/
 	void ClearMemory();
@@ -161,6 +196,8 @@ private:
 	*	\param _message The error message
 	*	\return false */
 	bool WriteError(const std::string& _module, const std::string& _function, const std::string& _message);
+	/** Passes current statistics of the solver to the statistics handler, if it is set.*/
+	void ReportStatistics() const;
 
 public:
 	// ========== Functions to work with solver settings
@@ -0,0 +1,41 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+
+#include <cstddef>
+
+/** Performance counters of an equation solver, accumulated since the model was set to the solver. */
+struct SSolverStatistics
+{
+	size_t calls{};                ///< Number of calls of the solver.
+	size_t steps{};                ///< Number of internal time steps.
+	size_t residualEvaluations{};  ///< Number of evaluations of residuals, including those for finite-difference Jacobians.
+	size_t jacobianEvaluations{};  ///< Number of evaluations of the Jacobian.
+	size_t linearSolverSetups{};   ///< Number of setups of the linear solver.
+	size_t nonlinearIterations{};  ///< Number of nonlinear iterations.
+	size_t nonlinearFailures{};    ///< Number of convergence failures of the nonlinear solver.
+	size_t errorTestFailures{};    ///< Number of local error test failures.
+	double lastStep{};             ///< Size of the last internal time step.
+	double solverTime{};           ///< Total wall-clock time spent in the solver [s].
+	double residualTime{};         ///< Wall-clock time spent in evaluation of residuals [s]. The rest of the solver time is mostly spent in linear algebra.
+
+	/** Adds counters of other statistics.
+	 *	\param _other Other statistics.
+	 *	\return Reference to this. */
+	SSolverStatistics& operator+=(const SSolverStatistics& _other)
+	{
+		calls               += _other.calls;
+		steps               += _other.steps;
+		residualEvaluations += _other.residualEvaluations;
+		jacobianEvaluations += _other.jacobianEvaluations;
+		linearSolverSetups  += _other.linearSolverSetups;
+		nonlinearIterations += _other.nonlinearIterations;
+		nonlinearFailures   += _other.nonlinearFailures;
+		errorTestFailures   += _other.errorTestFailures;
+		lastStep             = _other.lastStep;
+		solverTime          += _other.solverTime;
+		residualTime        += _other.residualTime;
+		return *this;
+	}
+};
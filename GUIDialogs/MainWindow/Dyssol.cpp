@@ -68,6 +68,9 @@ Dyssol::Dyssol(QWidget *parent /*= 0*/, Qt::WindowFlags flags /*= {}*/)
 	// create config file
 	m_pSettings = new QSettings(currConfigFile, QSettings::IniFormat, this);
 
+	// store descriptors of found models next to the config file
+	m_ModelsManager.SetCacheFile(std::filesystem::path{ settingsPath.toStdWString() } / StrConst::MM_CacheFileName);
+
 	// configure cache parameters
 	SetupCache();
 
@@ -411,6 +414,7 @@ void Dyssol::CreateMenu()
 	AddHelpAction(menuUnits, "Inlet Flow"  , "003_models/unit_inletflow.html"   , "Inlet flow model");
 	AddHelpAction(menuUnits, "Mixer"       , "003_models/unit_mixer.html"       , "Mixer model");
 	AddHelpAction(menuUnits, "Outlet Flow" , "003_models/unit_outletflow.html"  , "Outlet flow model");
+	AddHelpAction(menuUnits, "Population Balance", "003_models/unit_populationbalance.html", "Population balance model");
 	AddHelpAction(menuUnits, "Screen"      , "003_models/unit_screen.html"      , "Screen model");
 	AddHelpAction(menuUnits, "Splitter"    , "003_models/unit_splitter.html"    , "Splitter model");
 	AddHelpAction(menuUnits, "Time Delay"  , "003_models/unit_timedelay.html"   , "Time delay model");
@@ -420,6 +424,11 @@ void Dyssol::CreateMenu()
 	AddHelpAction(menuSolvers, "Agglomeration Cell Average", "003_models/solver_cellaverage.html", "Cell average agglomeration solver");
 	AddHelpAction(menuSolvers, "Agglomeration Fixed Pivot" , "003_models/solver_fixedpivot.html" , "Fixed pivot agglomeration solver");
 	AddHelpAction(menuSolvers, "Agglomeration FFT"         , "003_models/solver_fft.html"        , "FFT agglomeration solver");
+	AddHelpAction(menuSolvers, "Agglomeration Fixed Pivot 2D", "003_models/solver_fixedpivot2d.html", "Two-dimensional fixed pivot agglomeration solver");
+	AddHelpAction(menuSolvers, "Breakage Cell Average"     , "003_models/solver_breakage_cellaverage.html", "Cell average breakage solver");
+	AddHelpAction(menuSolvers, "Breakage Fixed Pivot"      , "003_models/solver_breakage_fixedpivot.html" , "Fixed pivot breakage solver");
+	AddHelpAction(menuSolvers, "Breakage Weighted Matrix"  , "003_models/solver_breakage_matrix.html"     , "Weighted matrix breakage solver");
+	AddHelpAction(menuSolvers, "PBM Finite Volume"         , "003_models/solver_pbmfinitevolume.html"     , "Finite volume population balance solver");
 
 	// Development
 	QMenu* menuDevelopment = ui.menuDocumentation->addMenu("Development");
@@ -486,6 +495,7 @@ void Dyssol::LoadFromFile(const QString& _sFileName) const
 	m_pLoadingWindow->raise();
 
 	m_pLoadingThread->SetFileName(_sFileName);
+	m_pLoadingThread->SetLazyLoading(m_pSettings->value(StrConst::Dyssol_ConfigLazyLoadingFlag).toBool());
 	m_pLoadingThread->Run();
 }
 
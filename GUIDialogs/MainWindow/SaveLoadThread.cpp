@@ -17,6 +17,11 @@ void CSaveLoadThread::SetFileName(const QString& _fileName)
 	m_fileName = _fileName;
 }
 
+void CSaveLoadThread::SetLazyLoading(bool _flag)
+{
+	m_fileHandler.SetLazyLoading(_flag);
+}
+
 QString CSaveLoadThread::GetFileName() const
 {
 	return m_fileName;
@@ -23,6 +23,7 @@ class CSaveLoadThread : public CBasicThread
 public:
 	CSaveLoadThread(const SSaveLoadData& _data, bool _saver, QObject* _parent = nullptr);
 	void SetFileName(const QString& _fileName);
+	void SetLazyLoading(bool _flag);                // Sets whether distributions should be loaded from file only on demand.
 	[[nodiscard]] QString GetFileName() const;
 	[[nodiscard]] QString GetFinalFileName() const; // Returns possibly transformed file name that was really used during saving/loading.
 	[[nodiscard]] bool IsSuccess() const;           // Returns true if saving/loading operation succeed.
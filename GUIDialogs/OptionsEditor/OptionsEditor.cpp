@@ -71,6 +71,12 @@ void COptionsEditor::UpdateWholeView()
 	ui.checkBoxCacheHoldupsFlag->setChecked(m_pParams->cacheFlagHoldupsAfterReload);
 	ui.checkBoxCacheInternalFlag->setChecked(m_pParams->cacheFlagInternalAfterReload);
 	ui.checkBoxSplitFile->setChecked(!m_pParams->fileSingleFlag);
+	ShowValueAndLabel(ui.lineEditFileCompression, ui.labelFileCompression, m_pParams->fileCompression);
+	ShowValueAndLabel(ui.lineEditFileChunkSize  , ui.labelFileChunkSize  , m_pParams->fileChunkSize  );
+	ShowValueAndLabel(ui.lineEditFileCacheSize  , ui.labelFileCacheSize  , m_pParams->fileCacheSize  );
+	ui.checkBoxFileShuffle->setChecked(m_pParams->fileShuffleFlag);
+	ui.checkBoxFileChecksum->setChecked(m_pParams->fileChecksumFlag);
+	ui.checkBoxFileIncremental->setChecked(m_pParams->fileIncrementalFlag);
 
 	UpdateCacheWindowVisible();
 	UpdateWarningsVisible();
@@ -196,6 +202,12 @@ void COptionsEditor::ApplyChanges()
 	m_pParams->CacheFlagHoldupsAfterReload(ui.checkBoxCacheHoldupsFlag->isChecked());
 	m_pParams->CacheFlagInternalAfterReload(ui.checkBoxCacheInternalFlag->isChecked());
 	m_pParams->FileSingleFlag(!ui.checkBoxSplitFile->isChecked());
+	m_pParams->FileCompression(static_cast<uint32_t>(ReadValue(ui.lineEditFileCompression)));
+	m_pParams->FileChunkSize(static_cast<uint32_t>(ReadValue(ui.lineEditFileChunkSize)));
+	m_pParams->FileCacheSize(static_cast<uint32_t>(ReadValue(ui.lineEditFileCacheSize)));
+	m_pParams->FileShuffleFlag(ui.checkBoxFileShuffle->isChecked());
+	m_pParams->FileChecksumFlag(ui.checkBoxFileChecksum->isChecked());
+	m_pParams->FileIncrementalFlag(ui.checkBoxFileIncremental->isChecked());
 
 	m_pFlowsheet->UpdateToleranceSettings();
 	m_pFlowsheet->UpdateThermodynamicsSettings();
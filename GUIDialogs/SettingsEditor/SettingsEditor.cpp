@@ -40,6 +40,7 @@ void CSettingsEditor::InitializeConnections() const
 void CSettingsEditor::UpdateWholeView()
 {
 	ui.checkBoxLoadLast->setChecked(m_settings->value(StrConst::Dyssol_ConfigLoadLastFlag).toBool());
+	ui.checkBoxLazyLoading->setChecked(m_settings->value(StrConst::Dyssol_ConfigLazyLoadingFlag).toBool());
 	ui.lineEditCachePath->setText(m_settings->value(StrConst::Dyssol_ConfigCachePath).toString());
 
 	UpdateWarningsVisible();
@@ -100,6 +101,7 @@ void CSettingsEditor::ClearCacheClicked()
 void CSettingsEditor::ApplyChanges()
 {
 	m_settings->setValue(StrConst::Dyssol_ConfigLoadLastFlag, ui.checkBoxLoadLast->isChecked());
+	m_settings->setValue(StrConst::Dyssol_ConfigLazyLoadingFlag, ui.checkBoxLazyLoading->isChecked());
 	m_settings->setValue(StrConst::Dyssol_ConfigCachePath, ui.lineEditCachePath->text());
 
 	QDialog::accept();
@@ -7,6 +7,7 @@
 #include "PacketTable.h"
 #include "StringFunctions.h"
 
+#include <mutex>
 #include <regex>
 
 namespace
@@ -19,21 +20,61 @@ namespace
 	const std::string FILE_EXT_MULT        = "[[" + FILE_EXT_SPEC + "]]";
 	const std::string DOT_FILE_EXT_MULT    = "." + FILE_EXT_MULT;
 
-	H5::FileAccPropList CreateFileAccPropList(bool _isSingleFile)
+	const std::string ROWS_SUFFIX          = "Rows";
+
+	constexpr size_t DEFAULT_CHUNK_BYTES = 64 * 1024;	// target size of automatically defined chunks, in bytes
+
+	// Returns the mutex serializing all calls to the HDF5 library, since it is not built thread-safe.
+	std::recursive_mutex& LibraryMutex()
+	{
+		static std::recursive_mutex mutex;
+		return mutex;
+	}
+
+	// Returns the smallest prime number not less than _n.
+	size_t NextPrime(size_t _n)
+	{
+		const auto IsPrime = [](size_t _v)
+		{
+			if (_v < 2) return false;
+			for (size_t d = 2; d * d <= _v; ++d)
+				if (_v % d == 0) return false;
+			return true;
+		};
+		while (!IsPrime(_n))
+			++_n;
+		return _n;
+	}
+
+	H5::FileAccPropList CreateFileAccPropList(bool _isSingleFile, const SH5StorageSettings& _storage)
 	{
-		constexpr hsize_t CHUNK_SIZE = 500;
-		constexpr hsize_t CACHE_SIZE = 1024 * 1024 * 50;		// in bytes
 		constexpr hsize_t MAX_H5FILE_SIZE = 1024 * 1024 * 2000;	// in bytes
 
+		// the number of slots in the chunk cache should be a prime number about 100 times larger than the number of chunks that fit into the cache
+		const size_t cacheSize = static_cast<size_t>(_storage.cacheSize) * 1024 * 1024;	// in bytes
+		const size_t chunkSize = _storage.chunkSize != 0 ? _storage.chunkSize * sizeof(double) : DEFAULT_CHUNK_BYTES;	// in bytes
+		const size_t slotsNumber = NextPrime(std::max<size_t>(100 * cacheSize / chunkSize, 521));
+
 		H5::FileAccPropList h5AccPropList;
 		if (!_isSingleFile)
 			h5AccPropList.setFamily(MAX_H5FILE_SIZE, H5P_DEFAULT);
 		h5AccPropList.setFcloseDegree(H5F_CLOSE_STRONG);
-		h5AccPropList.setCache(CHUNK_SIZE, CHUNK_SIZE, CACHE_SIZE, 0.5);
+		h5AccPropList.setCache(0, slotsNumber, cacheSize, 0.75);
 
 		return h5AccPropList;
 	}
 
+	H5::FileCreatPropList CreateFileCreatPropList(const SH5StorageSettings& _storage)
+	{
+		H5::FileCreatPropList h5CreatPropList;
+#if H5_VERSION_GE(1, 10, 1) == true
+		// space released by replaced datasets is tracked across sessions and reused when appending to the file
+		if (_storage.extendible)
+			H5Pset_file_space_strategy(h5CreatPropList.getId(), H5F_FSPACE_STRATEGY_FSM_AGGR, 1, 1);
+#endif
+		return h5CreatPropList;
+	}
+
 	// Returns results of the regex search.
 	std::smatch FindSuffix(const std::filesystem::path& _str, const std::string_view& _regexStr)
 	{
@@ -109,6 +150,7 @@ namespace
 
 CH5Handler::CH5Handler()
 {
+	const std::lock_guard lock{ LibraryMutex() };
 	H5::Exception::dontPrint();
 }
 
@@ -119,6 +161,7 @@ CH5Handler::~CH5Handler()
 
 void CH5Handler::Create(const std::filesystem::path& _fileName, bool _isSingleFile /*= true*/)
 {
+	const std::lock_guard lock{ LibraryMutex() };
 	H5::Exception::dontPrint();
 
 	OpenH5File(_fileName, false, _isSingleFile);
@@ -126,20 +169,91 @@ void CH5Handler::Create(const std::filesystem::path& _fileName, bool _isSingleFi
 
 void CH5Handler::Open(const std::filesystem::path& _fileName)
 {
+	const std::lock_guard lock{ LibraryMutex() };
 	H5::Exception::dontPrint();
 
 	OpenH5File(_fileName, true, !m_isFileValid);
 }
 
+void CH5Handler::OpenForAppend(const std::filesystem::path& _fileName)
+{
+	const std::lock_guard lock{ LibraryMutex() };
+	H5::Exception::dontPrint();
+
+	OpenH5File(_fileName, true, true, true);
+	m_isAppending = m_isFileValid;
+}
+
 void CH5Handler::Close()
 {
+	if (m_deferred)
+	{
+		m_deferred.reset();
+		m_isFileValid = false;
+	}
+
+	// objects loaded lazily keep their own handler of the file
+	m_shared.reset();
+
 	if (!m_h5File)
 		return;
 
+	const std::lock_guard lock{ LibraryMutex() };
 	m_h5File->close();
 	delete m_h5File;
 	m_h5File = nullptr;
 	m_isFileValid = false;
+	m_isAppending = false;
+}
+
+void CH5Handler::CreateDeferred()
+{
+	Close();
+
+	m_fileName.clear();
+	m_deferred = std::make_unique<std::vector<SDeferredOperation>>();
+	m_isFileValid = true;
+}
+
+void CH5Handler::WriteDeferred(CH5Handler& _deferred)
+{
+	if (!_deferred.m_deferred) return;
+
+	const std::lock_guard lock{ LibraryMutex() };
+	for (auto& op : *_deferred.m_deferred)
+	{
+		switch (op.type)
+		{
+		case EDeferred::GROUP:
+		{
+			[[maybe_unused]] const auto group = CreateGroup(op.path, op.name);
+			break;
+		}
+		case EDeferred::ATTRIBUTE:
+			WriteAttribute(op.path, op.name, op.attribute);
+			break;
+		case EDeferred::VALUES:
+			WriteValue(op.path, op.name, op.size, op.dataType(), op.bytes.data());
+			break;
+		case EDeferred::STRINGS:
+		{
+			std::vector<const char*> strings(op.strings.size());
+			std::transform(op.strings.begin(), op.strings.end(), strings.begin(), [](const auto& _str) { return _str.c_str(); });
+			WriteValue(op.path, op.name, strings.size(), GetType<std::string>(), strings.data());
+			break;
+		}
+		case EDeferred::ROWS:
+			WriteData(op.path, op.name, op.rows);
+			break;
+		case EDeferred::EXTENDIBLE:
+			WriteExtendible(op.path, op.name, op.rows.front(), op.size);
+			break;
+		}
+		// release memory as soon as possible
+		op = SDeferredOperation{};
+	}
+
+	_deferred.Close();
 }
 
 std::filesystem::path CH5Handler::FileName() const
@@ -147,15 +261,75 @@ std::filesystem::path CH5Handler::FileName() const
 	return m_fileName;
 }
 
+bool CH5Handler::IsAppending() const
+{
+	return m_isAppending;
+}
+
+void CH5Handler::SetStorageSettings(const SH5StorageSettings& _settings)
+{
+	m_storage = _settings;
+	m_storage.compression = std::min(m_storage.compression, 9u);
+	m_storage.cacheSize = std::max(m_storage.cacheSize, 1u);
+}
+
+SH5StorageSettings CH5Handler::GetStorageSettings() const
+{
+	return m_storage;
+}
+
+void CH5Handler::SetLazyLoading(bool _flag)
+{
+	m_lazyLoading = _flag;
+}
+
+bool CH5Handler::IsLazyLoading() const
+{
+	return m_lazyLoading;
+}
+
+void CH5Handler::SetFlatRowsLayout(bool _flag)
+{
+	m_flatRows = _flag;
+}
+
+bool CH5Handler::IsFlatRowsLayout() const
+{
+	return m_flatRows;
+}
+
+std::shared_ptr<const CH5Handler> CH5Handler::Share() const
+{
+	if (!m_shared && m_h5File)
+	{
+		auto shared = std::make_shared<CH5Handler>();
+		shared->SetStorageSettings(m_storage);
+		shared->SetFlatRowsLayout(m_flatRows);
+		shared->Open(m_fileName);
+		if (shared->IsValid())
+			m_shared = shared;
+	}
+	return m_shared;
+}
+
 std::string CH5Handler::CreateGroup(const std::string& _path, const std::string& _groupName) const
 {
 	if (!m_isFileValid)
 		return "";
 
 	const std::string& path = _path + "/" + _groupName;
+	if (m_deferred)
+	{
+		m_deferred->emplace_back(SDeferredOperation{ EDeferred::GROUP, _path, _groupName });
+		return path;
+	}
+	const std::lock_guard lock{ LibraryMutex() };
 	try
 	{
-		m_h5File->createGroup(path);
+		if (m_isAppending && H5Lexists(m_h5File->getId(), path.c_str(), H5P_DEFAULT) > 0)
+			m_h5File->openGroup(path);
+		else
+			m_h5File->createGroup(path);
 	}
 	catch (...)
 	{
@@ -167,9 +341,10 @@ std::string CH5Handler::CreateGroup(const std::string& _path, const std::string&
 
 std::string CH5Handler::OpenGroup(const std::string& _path, const std::string& _groupName) const
 {
-	if (!m_isFileValid)
+	if (!m_isFileValid || !m_h5File)
 		return "";
 
+	const std::lock_guard lock{ LibraryMutex() };
 	const std::string& path = _path + "/" + _groupName;
 	try
 	{
@@ -183,12 +358,58 @@ std::string CH5Handler::OpenGroup(const std::string& _path, const std::string& _
 	return path;
 }
 
+void CH5Handler::ClearGroup(const std::string& _path) const
+{
+	if (!m_isAppending || !m_h5File) return;
+
+	const std::lock_guard lock{ LibraryMutex() };
+	try
+	{
+		H5::Group h5Group(m_h5File->openGroup(_path));
+		std::vector<std::string> names;
+		for (hsize_t i = 0; i < h5Group.getNumObjs(); ++i)
+			names.push_back(h5Group.getObjnameByIdx(i));
+		for (const auto& name : names)
+			h5Group.unlink(name);
+		h5Group.close();
+	}
+	catch (...)
+	{
+	}
+}
+
+void CH5Handler::RemoveData(const std::string& _path, const std::string& _dataset) const
+{
+	if (!m_isAppending || !m_h5File) return;
+
+	const std::lock_guard lock{ LibraryMutex() };
+	try
+	{
+		H5::Group h5Group(m_h5File->openGroup(_path));
+		Unlink(h5Group, _dataset);
+		Unlink(h5Group, _dataset + ROWS_SUFFIX);
+		h5Group.close();
+	}
+	catch (...)
+	{
+	}
+}
+
 void CH5Handler::WriteAttribute(const std::string& _path, const std::string& _attrName, int _value) const
 {
 	if (!m_isFileValid) return;
 
+	if (m_deferred)
+	{
+		m_deferred->emplace_back(SDeferredOperation{ EDeferred::ATTRIBUTE, _path, _attrName, _value });
+		return;
+	}
+
+	const std::lock_guard lock{ LibraryMutex() };
 	H5::DataSpace h5Dataspace(H5S_SCALAR);
 	H5::Group h5Group(m_h5File->openGroup(_path));
+	if (m_isAppending && h5Group.attrExists(_attrName))
+		h5Group.removeAttr(_attrName);
 	H5::Attribute h5Attribute(h5Group.createAttribute(_attrName, H5::PredType::NATIVE_INT, h5Dataspace, H5::PropList::DEFAULT));
 
 	h5Attribute.write(H5::PredType::NATIVE_INT, &_value);
@@ -200,8 +421,9 @@ void CH5Handler::WriteAttribute(const std::string& _path, const std::string& _at
 
 int CH5Handler::ReadAttribute(const std::string& _path, const std::string& _attrName) const
 {
-	if (!m_isFileValid) return 0;
+	if (!m_isFileValid || !m_h5File) return 0;
 
+	const std::lock_guard lock{ LibraryMutex() };
 	int attrValue;
 	try
 	{
@@ -225,7 +447,45 @@ int CH5Handler::ReadAttribute(const std::string& _path, const std::string& _attr
 void CH5Handler::WriteData(const std::string& _path, const std::string& _dataset, const std::vector<std::vector<double>>& _data) const
 {
 	if (!m_isFileValid) return;
-	if (_data.empty()) return;
+	if (_data.empty())
+	{
+		RemoveData(_path, _dataset);
+		return;
+	}
+
+	if (m_deferred)
+	{
+		m_deferred->emplace_back(SDeferredOperation{ EDeferred::ROWS, _path, _dataset }).rows = _data;
+		return;
+	}
+
+	// the layout of replaced data may differ
+	const std::lock_guard lock{ LibraryMutex() };
+	RemoveData(_path, _dataset);
+
+	if (m_storage.IsFiltered() && m_flatRows)
+	{
+		// filters cannot be applied to variable-length data, so rows are stored as a flat array of values and an array of their lengths
+		std::vector<uint64_t> lengths(_data.size());
+		size_t total{ 0 }, longest{ 1 };
+		for (size_t i = 0; i < _data.size(); ++i)
+		{
+			lengths[i] = _data[i].size();
+			total += _data[i].size();
+			longest = std::max(longest, _data[i].size());
+		}
+		std::vector<double> values;
+		values.reserve(total);
+		for (const auto& row : _data)
+			values.insert(values.end(), row.begin(), row.end());
+
+		// each chunk contains whole rows, e.g. a block of time points for several cells of a distribution
+		const size_t target = m_storage.chunkSize != 0 ? m_storage.chunkSize : DEFAULT_CHUNK_BYTES / sizeof(double);
+		WriteValue(_path, _dataset + ROWS_SUFFIX, lengths.size(), GetType<uint64_t>(), lengths.data());
+		if (!values.empty())
+			WriteValue(_path, _dataset, values.size(), GetType<double>(), values.data(), longest * std::max<size_t>(target / longest, 1));
+		return;
+	}
 
 	const hsize_t size{ _data.size() };
 
@@ -250,9 +510,105 @@ void CH5Handler::WriteData(const std::string& _path, const std::string& _dataset
 	h5Group.close();
 }
 
-void CH5Handler::ReadData(const std::string& _path, const std::string& _dataset, std::vector<std::vector<double>>& _data) const
+void CH5Handler::WriteExtendible(const std::string& _path, const std::string& _dataset, const std::vector<double>& _data, size_t _unchanged /*= 0*/) const
 {
 	if (!m_isFileValid) return;
+	if (_data.empty())
+	{
+		RemoveData(_path, _dataset);
+		return;
+	}
+
+	if (m_deferred)
+	{
+		SDeferredOperation& op = m_deferred->emplace_back(SDeferredOperation{ EDeferred::EXTENDIBLE, _path, _dataset });
+		op.size = _unchanged;
+		op.rows.push_back(_data);
+		return;
+	}
+
+	if (!m_storage.extendible)
+	{
+		WriteValue(_path, _dataset, _data.size(), GetType<double>(), _data.data());
+		return;
+	}
+
+	if (!m_h5File) return;
+
+	const std::lock_guard lock{ LibraryMutex() };
+	const hsize_t size{ _data.size() };
+	H5::Group h5Group(m_h5File->openGroup(_path));
+
+	// extend the existing dataset, writing only new values
+	if (m_isAppending && H5Lexists(h5Group.getId(), _dataset.c_str(), H5P_DEFAULT) > 0)
+	{
+		H5::DataSet h5Dataset = h5Group.openDataSet(_dataset);
+		H5::DataSpace h5Dataspace = h5Dataset.getSpace();
+		hsize_t dims{ 0 }, maxDims{ 0 };
+		const bool extendible = h5Dataspace.getSimpleExtentNdims() == 1 && h5Dataspace.getSimpleExtentDims(&dims, &maxDims) == 1 && maxDims == H5S_UNLIMITED;
+		h5Dataspace.close();
+		if (extendible && dims >= _unchanged && size >= _unchanged)
+		{
+			h5Dataset.extend(&size);
+			if (size > _unchanged)
+			{
+				const hsize_t start{ _unchanged };
+				const hsize_t count{ size - _unchanged };
+				H5::DataSpace h5FileSpace = h5Dataset.getSpace();
+				h5FileSpace.selectHyperslab(H5S_SELECT_SET, &count, &start);
+				H5::DataSpace h5MemSpace(1, &count);
+				h5Dataset.write(_data.data() + _unchanged, H5::PredType::NATIVE_DOUBLE, h5MemSpace, h5FileSpace);
+				h5MemSpace.close();
+				h5FileSpace.close();
+			}
+			h5Dataset.close();
+			h5Group.close();
+			return;
+		}
+		h5Dataset.close();
+		Unlink(h5Group, _dataset);
+	}
+
+	// create a chunked dataset of unlimited size
+	constexpr size_t MIN_CHUNK_SIZE = 256;
+	const hsize_t maxSize{ H5S_UNLIMITED };
+	const hsize_t chunkDims{ m_storage.chunkSize != 0 ? m_storage.chunkSize : std::clamp<size_t>(_data.size(), MIN_CHUNK_SIZE, DEFAULT_CHUNK_BYTES / sizeof(double)) };
+	H5::DataSpace h5Dataspace(1, &size, &maxSize);
+	H5::DSetCreatPropList h5PropList;
+	h5PropList.setChunk(1, &chunkDims);
+	ApplyFilters(h5PropList);
+	H5::DataSet h5Dataset = h5Group.createDataSet(_dataset, H5::PredType::NATIVE_DOUBLE, h5Dataspace, h5PropList);
+
+	h5Dataset.write(_data.data(), H5::PredType::NATIVE_DOUBLE);
+
+	h5Dataset.close();
+	h5PropList.close();
+	h5Dataspace.close();
+	h5Group.close();
+}
+
+void CH5Handler::ReadData(const std::string& _path, const std::string& _dataset, std::vector<std::vector<double>>& _data) const
+{
+	if (!m_isFileValid || !m_h5File) return;
+
+	const std::lock_guard lock{ LibraryMutex() };
+	// flat layout of filtered data
+	if (m_flatRows && ReadSize(_path, _dataset + ROWS_SUFFIX) != 0)
+	{
+		std::vector<uint64_t> lengths;
+		std::vector<double> values;
+		ReadData(_path, _dataset + ROWS_SUFFIX, lengths);
+		ReadData(_path, _dataset, values);
+		_data.resize(lengths.size());
+		auto it = values.begin();
+		for (size_t i = 0; i < lengths.size(); ++i)
+		{
+			const auto length = std::min(static_cast<ptrdiff_t>(lengths[i]), std::distance(it, values.end()));
+			_data[i].assign(it, it + length);
+			it += length;
+		}
+		return;
+	}
 
 	try
 	{
@@ -293,8 +649,9 @@ void CH5Handler::ReadData(const std::string& _path, const std::string& _dataset,
 
 void CH5Handler::ReadDataOld(const std::string& _path, const std::string& _dataset, std::vector<std::vector<double>>& _data) const
 {
-	if (!m_isFileValid) return;
+	if (!m_isFileValid || !m_h5File) return;
 
+	const std::lock_guard lock{ LibraryMutex() };
 	try
 	{
 		H5::Group h5Group(m_h5File->openGroup(_path));
@@ -344,25 +701,75 @@ bool CH5Handler::IsValid() const
 	return m_isFileValid;
 }
 
-void CH5Handler::WriteValue(const std::string& _path, const std::string& _dataset, size_t _size, const H5::DataType& _type, const void* _value) const
+void CH5Handler::WriteStrings(const std::string& _path, const std::string& _dataset, size_t _size, const char* const* _values) const
 {
-	if (!m_isFileValid) return;
+	if (m_deferred)
+		m_deferred->emplace_back(SDeferredOperation{ EDeferred::STRINGS, _path, _dataset }).strings.assign(_values, _values + _size);
+	else
+		WriteValue(_path, _dataset, _size, GetType<std::string>(), _values);
+}
 
+void CH5Handler::WriteValue(const std::string& _path, const std::string& _dataset, size_t _size, const H5::DataType& _type, const void* _value, size_t _chunk /*= 0*/) const
+{
+	if (!m_isFileValid || !m_h5File) return;
+
+	const std::lock_guard lock{ LibraryMutex() };
 	H5::Group h5Group(m_h5File->openGroup(_path));
+	Unlink(h5Group, _dataset);
 	H5::DataSpace h5Dataspace(1, &static_cast<const hsize_t&>(_size));
-	H5::DataSet h5Dataset = h5Group.createDataSet(_dataset, _type, h5Dataspace);
+	H5::DSetCreatPropList h5PropList = CreateDataSetPropList(_size, _type, _chunk);
+	H5::DataSet h5Dataset = h5Group.createDataSet(_dataset, _type, h5Dataspace, h5PropList);
 
 	h5Dataset.write(_value, _type);
 
 	h5Dataset.close();
+	h5PropList.close();
 	h5Dataspace.close();
 	h5Group.close();
 }
 
+H5::DSetCreatPropList CH5Handler::CreateDataSetPropList(size_t _size, const H5::DataType& _type, size_t _chunk) const
+{
+	constexpr size_t MIN_CHUNKED_SIZE = 256;	// smaller datasets are stored contiguously, since filters would only add overhead
+
+	H5::DSetCreatPropList h5PropList;
+
+	// variable-length data are stored in the global heap and cannot be filtered
+	const H5T_class_t typeClass = _type.getClass();
+	if (!m_storage.IsFiltered() || _size < MIN_CHUNKED_SIZE || typeClass == H5T_STRING || typeClass == H5T_VLEN)
+		return h5PropList;
+
+	const size_t chunk = _chunk != 0 ? _chunk : m_storage.chunkSize != 0 ? m_storage.chunkSize : std::max<size_t>(DEFAULT_CHUNK_BYTES / _type.getSize(), 1);
+	const hsize_t chunkDims{ std::min(chunk, _size) };
+	h5PropList.setChunk(1, &chunkDims);
+	ApplyFilters(h5PropList);
+
+	return h5PropList;
+}
+
+void CH5Handler::ApplyFilters(H5::DSetCreatPropList& _propList) const
+{
+	if (m_storage.compression != 0 && H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0)
+	{
+		if (m_storage.shuffle)
+			_propList.setShuffle();
+		_propList.setDeflate(static_cast<int>(m_storage.compression));
+	}
+	if (m_storage.checksum)
+		_propList.setFletcher32();
+}
+
+void CH5Handler::Unlink(const H5::Group& _group, const std::string& _name) const
+{
+	if (m_isAppending && H5Lexists(_group.getId(), _name.c_str(), H5P_DEFAULT) > 0)
+		_group.unlink(_name);
+}
+
 size_t CH5Handler::ReadSize(const std::string& _path, const std::string& _dataset) const
 {
-	if (!m_isFileValid) return 0;
+	if (!m_isFileValid || !m_h5File) return 0;
 
+	const std::lock_guard lock{ LibraryMutex() };
 	try
 	{
 		H5::Group h5Group(m_h5File->openGroup(_path));
@@ -390,8 +797,9 @@ size_t CH5Handler::ReadSize(const std::string& _path, const std::string& _datase
 
 bool CH5Handler::ReadValue(const std::string& _path, const std::string& _dataset, const H5::DataType& _type, void* _value) const
 {
-	if (!m_isFileValid) return false;
+	if (!m_isFileValid || !m_h5File) return false;
 
+	const std::lock_guard lock{ LibraryMutex() };
 	try
 	{
 		H5::Group h5Group(m_h5File->openGroup(_path));
@@ -410,22 +818,27 @@ bool CH5Handler::ReadValue(const std::string& _path, const std::string& _dataset
 	}
 }
 
-void CH5Handler::OpenH5File(const std::filesystem::path& _fileName, bool _isOpen, bool _isSingleFile)
+void CH5Handler::OpenH5File(const std::filesystem::path& _fileName, bool _isOpen, bool _isSingleFile, bool _isWritable /*= false*/)
 {
 	Close();
 
 	m_fileName = ConvertFileName(_fileName, _isOpen, _isSingleFile);
 	if (m_h5File || m_fileName.empty()) return;
 
-	H5::FileAccPropList h5AccPropList = CreateFileAccPropList(_isSingleFile);
+	H5::FileAccPropList h5AccPropList = CreateFileAccPropList(_isSingleFile, m_storage);
+	H5::FileCreatPropList h5CreatPropList = CreateFileCreatPropList(m_storage);
 	try
 	{
-		m_h5File = new H5::H5File(_fileName.string(), _isOpen ? H5F_ACC_RDONLY : H5F_ACC_TRUNC, H5P_DEFAULT, h5AccPropList);
+		if (_isOpen)
+			m_h5File = new H5::H5File(_fileName.string(), _isWritable ? H5F_ACC_RDWR : H5F_ACC_RDONLY, H5::FileCreatPropList::DEFAULT, h5AccPropList);
+		else
+			m_h5File = new H5::H5File(_fileName.string(), H5F_ACC_TRUNC, h5CreatPropList, h5AccPropList);
 	}
 	catch (...)
 	{
 		m_h5File = nullptr;
 	}
+	h5CreatPropList.close();
 	h5AccPropList.close();
 
 	if (m_h5File && m_h5File->getId() != -1)
@@ -11,6 +11,7 @@
 
 #include <algorithm>
 #include <map>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -31,43 +32,41 @@ template<> inline const H5::DataType& GetType<bool>()     { return H5::PredType:
 template<>
 inline const H5::DataType& GetType<CPoint>()
 {
-	static std::unique_ptr<H5::CompType> type{};
-
-	if (!type)
+	// initialization of function-local statics is thread-safe
+	static const H5::CompType type = []
 	{
-		type = std::make_unique<H5::CompType>(sizeof(CPoint));
-		type->insertMember("x", HOFFSET(CPoint, x), H5::PredType::NATIVE_DOUBLE);
-		type->insertMember("y", HOFFSET(CPoint, y), H5::PredType::NATIVE_DOUBLE);
-	}
-	return *type;
+		H5::CompType res(sizeof(CPoint));
+		res.insertMember("x", HOFFSET(CPoint, x), H5::PredType::NATIVE_DOUBLE);
+		res.insertMember("y", HOFFSET(CPoint, y), H5::PredType::NATIVE_DOUBLE);
+		return res;
+	}();
+	return type;
 }
 
 template<>
 inline const H5::DataType& GetType<STDValue>()
 {
-	static std::unique_ptr<H5::CompType> type{};
-
-	if (!type)
+	static const H5::CompType type = []
 	{
-		type = std::make_unique<H5::CompType>(sizeof(STDValue));
-		type->insertMember("time", HOFFSET(STDValue, time), H5::PredType::NATIVE_DOUBLE);
-		type->insertMember("value", HOFFSET(STDValue, value), H5::PredType::NATIVE_DOUBLE);
-	}
-	return *type;
+		H5::CompType res(sizeof(STDValue));
+		res.insertMember("time", HOFFSET(STDValue, time), H5::PredType::NATIVE_DOUBLE);
+		res.insertMember("value", HOFFSET(STDValue, value), H5::PredType::NATIVE_DOUBLE);
+		return res;
+	}();
+	return type;
 }
 
 template<>
 inline const H5::DataType& GetType<SInterval>()
 {
-	static std::unique_ptr<H5::CompType> type{};
-
-	if (!type)
+	static const H5::CompType type = []
 	{
-		type = std::make_unique<H5::CompType>(sizeof(SInterval));
-		type->insertMember("min", HOFFSET(SInterval, min), H5::PredType::NATIVE_DOUBLE);
-		type->insertMember("max", HOFFSET(SInterval, max), H5::PredType::NATIVE_DOUBLE);
-	}
-	return *type;
+		H5::CompType res(sizeof(SInterval));
+		res.insertMember("min", HOFFSET(SInterval, min), H5::PredType::NATIVE_DOUBLE);
+		res.insertMember("max", HOFFSET(SInterval, max), H5::PredType::NATIVE_DOUBLE);
+		return res;
+	}();
+	return type;
 }
 
 template<>
@@ -78,16 +77,59 @@ inline const H5::DataType& GetType<std::string>()
 	return type;
 }
 
+/**
+ * Settings of the storage layout of numeric datasets in HDF5 files.
+ */
+struct SH5StorageSettings
+{
+	uint32_t compression{ DEFAULT_FILE_COMPRESSION };	///< Level of deflate compression [0..9]. 0 - no compression.
+	bool shuffle{ DEFAULT_FILE_SHUFFLE_FLAG };			///< Whether to shuffle bytes of values before compression.
+	bool checksum{ DEFAULT_FILE_CHECKSUM_FLAG };		///< Whether to store Fletcher32 checksums of chunks.
+	uint32_t chunkSize{ DEFAULT_FILE_CHUNK_SIZE };		///< Number of values in one chunk, rounded to whole rows for two-dimensional data. 0 - automatic.
+	uint32_t cacheSize{ DEFAULT_FILE_CACHE_SIZE };		///< Size of the chunk cache [MB].
+	bool extendible{ DEFAULT_FILE_INCREMENTAL };		///< Whether time series are stored in datasets of unlimited size, so that new values can be appended to them.
+
+	/// Whether filters must be applied to numeric datasets.
+	[[nodiscard]] bool IsFiltered() const { return compression != 0 || checksum; }
+};
+
 /**
  *	IO with HDF5 files. Two modes:
  *	1. Single file: all data stored in a single file.
  *	2. Multi file: the file is split into parts of 2000 Mb each.
+ *	Additionally, write operations can be recorded in memory without a file (deferred mode), to be written to a file later.
+ *	An existing file can be opened for appending: existing groups are reused, existing datasets and attributes are replaced, and extendible datasets are only extended.
+ *	For loading, objects may keep a shared handler of the file to read their data later on demand (lazy loading).
+ *	All calls to the HDF5 library are serialized, so different handlers can be used from different threads at the same time.
  */
 class CH5Handler
 {
+	// Types of write operations recorded in deferred mode.
+	enum class EDeferred { GROUP, ATTRIBUTE, VALUES, STRINGS, ROWS, EXTENDIBLE };
+
+	// Write operation recorded in deferred mode.
+	struct SDeferredOperation
+	{
+		EDeferred type{};									// Type of the operation.
+		std::string path{};									// Path to the group.
+		std::string name{};									// Name of the group, attribute or dataset.
+		int attribute{};									// Value of the attribute.
+		const H5::DataType& (*dataType)() {};				// Function returning the data type of values.
+		size_t size{};										// Number of values or of unchanged values of an extendible dataset.
+		std::vector<uint8_t> bytes{};						// Values.
+		std::vector<std::string> strings{};					// String values.
+		std::vector<std::vector<double>> rows{};			// Rows of two-dimensional data.
+	};
+
 	std::filesystem::path m_fileName{};
 	bool m_isFileValid{ false };
+	bool m_isAppending{ false };									// Whether an existing file is opened to append data.
 	H5::H5File* m_h5File{ nullptr };
+	SH5StorageSettings m_storage{};
+	std::unique_ptr<std::vector<SDeferredOperation>> m_deferred{};	// Operations recorded in deferred mode.
+	bool m_lazyLoading{ false };									// Whether large data should be loaded from the file on demand.
+	bool m_flatRows{ true };										// Whether two-dimensional data of filtered files are stored as flat arrays of values and row lengths.
+	mutable std::shared_ptr<const CH5Handler> m_shared{};			// Handler of the same file that may outlive this one.
 
 	template <typename T>
 	struct is_vector : std::false_type {};
@@ -117,11 +159,26 @@ public:
 
 	void Create(const std::filesystem::path& _fileName, bool _isSingleFile = true);	///< Create new file with truncation.
 	void Open(const std::filesystem::path& _fileName);								///< Open existing file.
+	void OpenForAppend(const std::filesystem::path& _fileName);						///< Open existing file to replace or append data in it.
 	void Close();																	///< Close current file.
+	void CreateDeferred();															///< Start recording of write operations in memory, without calls to HDF5, so that several handlers can record in parallel.
+	void WriteDeferred(CH5Handler& _deferred);										///< Write all operations recorded by _deferred into the current file in the order of recording and clear them.
 	[[nodiscard]] std::filesystem::path FileName() const;							///< Returns current file name.
+	[[nodiscard]] bool IsAppending() const;											///< Returns whether an existing file is opened to append data.
+
+	void SetStorageSettings(const SH5StorageSettings& _settings);					///< Sets layout of numeric datasets for files created afterwards.
+	[[nodiscard]] SH5StorageSettings GetStorageSettings() const;					///< Returns layout of numeric datasets.
+
+	void SetLazyLoading(bool _flag);												///< Sets whether objects should load their large data from the file only on demand.
+	[[nodiscard]] bool IsLazyLoading() const;										///< Returns whether objects should load their large data from the file only on demand.
+	void SetFlatRowsLayout(bool _flag);												///< Sets whether filtered two-dimensional data are stored as flat arrays of values and row lengths. Must be disabled for files of older versions, which do not have this layout.
+	[[nodiscard]] bool IsFlatRowsLayout() const;									///< Returns whether filtered two-dimensional data are stored as flat arrays of values and row lengths.
+	[[nodiscard]] std::shared_ptr<const CH5Handler> Share() const;					///< Returns a read-only handler of the currently opened file, that stays open as long as it is used. The same handler is returned until the file is closed.
 
 	[[nodiscard]] std::string CreateGroup(const std::string& _path, const std::string& _groupName) const;
 	[[nodiscard]] std::string OpenGroup(const std::string& _path, const std::string& _groupName) const;
+	void ClearGroup(const std::string& _path) const;								///< Removes all objects from the group, if the file is opened for appending.
+	void RemoveData(const std::string& _path, const std::string& _dataset) const;	///< Removes the dataset, if the file is opened for appending.
 
 	void WriteAttribute(const std::string& _path, const std::string& _attrName, int _value) const;
 	[[nodiscard]] int ReadAttribute(const std::string& _path, const std::string& _attrName) const;
@@ -132,16 +189,16 @@ public:
 		if constexpr (std::is_convertible_v<T, std::string_view>)
 		{
 			const char* value = _data.c_str();
-			WriteValue(_path, _dataset, 1, GetType<std::string>(), &value);
+			WriteStrings(_path, _dataset, 1, &value);
 		}
 		else if constexpr (std::is_enum_v<T>)
 		{
 			auto value = static_cast<int64_t>(_data);
-			WriteValue(_path, _dataset, 1, GetType<decltype(value)>(), &value);
+			WriteValues(_path, _dataset, 1, &value);
 		}
 		else
 		{
-			WriteValue(_path, _dataset, 1, GetType<T>(), &_data);
+			WriteValues(_path, _dataset, 1, &_data);
 		}
 	}
 
@@ -149,17 +206,20 @@ public:
 	void WriteData(const std::string& _path, const std::string& _dataset, const std::vector<T>& _data) const
 	{
 		if (_data.empty())
+		{
+			RemoveData(_path, _dataset);
 			return;
+		}
 
 		if constexpr (std::is_convertible_v<T, std::string_view>)
 		{
 			std::vector<const char*> strings(_data.size());
 			std::transform(_data.begin(), _data.end(), strings.begin(), [](const auto& _str) { return _str.c_str(); });
-			WriteValue(_path, _dataset, strings.size(), GetType<std::string>(), &strings.front());
+			WriteStrings(_path, _dataset, strings.size(), &strings.front());
 		}
 		else
 		{
-			WriteValue(_path, _dataset, _data.size(), GetType<T>(), &_data.front());
+			WriteValues(_path, _dataset, _data.size(), &_data.front());
 		}
 	}
 
@@ -197,6 +257,16 @@ public:
 
 	void WriteData(const std::string& _path, const std::string& _dataset, const std::vector<std::vector<double>>& _data) const;
 
+	/**
+	 * Writes a time series. If extendible storage is set, the dataset is chunked with unlimited size.
+	 * If the file is opened for appending and such dataset already exists, only values starting from _unchanged are written and the dataset is resized.
+	 * \param _path Path to the group.
+	 * \param _dataset Name of the dataset.
+	 * \param _data Values.
+	 * \param _unchanged Number of first values that are already stored in the file.
+	 */
+	void WriteExtendible(const std::string& _path, const std::string& _dataset, const std::vector<double>& _data, size_t _unchanged = 0) const;
+
 	template<typename T>
 	void ReadData(const std::string& _path, const std::string& _dataset, T& _data) const
 	{
@@ -282,15 +352,38 @@ public:
 	void ReadDataOld(const std::string& _path, const std::string& _dataset, std::vector<std::vector<double>>& _data) const;
 
 	[[nodiscard]] bool IsValid() const;
+	[[nodiscard]] size_t ReadSize(const std::string& _path, const std::string& _dataset) const;	///< Returns the number of elements in the dataset, 0 if it does not exist.
 
 	// Returns displayable file name in form "path/FileName.dflw", removing all [[%d]] and [[N]] from it
 	static std::filesystem::path DisplayFileName(std::filesystem::path _fileName);
 
 private:
-	void WriteValue(const std::string& _path, const std::string& _dataset, size_t _size, const H5::DataType& _type, const void* _value) const;
-	// Read element count
-	[[nodiscard]] size_t ReadSize(const std::string& _path, const std::string& _dataset) const;
+	// Writes _size values of type T, or records them in deferred mode.
+	template<typename T>
+	void WriteValues(const std::string& _path, const std::string& _dataset, size_t _size, const T* _values) const
+	{
+		if (m_deferred)
+		{
+			const auto* bytes = reinterpret_cast<const uint8_t*>(_values);
+			SDeferredOperation& op = m_deferred->emplace_back(SDeferredOperation{ EDeferred::VALUES, _path, _dataset });
+			op.dataType = &GetType<T>;
+			op.size = _size;
+			op.bytes.assign(bytes, bytes + _size * sizeof(T));
+		}
+		else
+			WriteValue(_path, _dataset, _size, GetType<T>(), _values);
+	}
+	// Writes _size strings, or records them in deferred mode.
+	void WriteStrings(const std::string& _path, const std::string& _dataset, size_t _size, const char* const* _values) const;
+	// Writes _size values of type _type. Numeric datasets are chunked with the given number of values per chunk and filtered according to storage settings.
+	void WriteValue(const std::string& _path, const std::string& _dataset, size_t _size, const H5::DataType& _type, const void* _value, size_t _chunk = 0) const;
+	// Creates properties of a dataset with _size values of type _type, applying chunking and filters if needed.
+	[[nodiscard]] H5::DSetCreatPropList CreateDataSetPropList(size_t _size, const H5::DataType& _type, size_t _chunk) const;
+	// Adds filters to properties of a chunked dataset according to storage settings.
+	void ApplyFilters(H5::DSetCreatPropList& _propList) const;
+	// Removes the link to the object from the group, if it exists and the file is opened for appending.
+	void Unlink(const H5::Group& _group, const std::string& _name) const;
 	bool ReadValue(const std::string& _path, const std::string& _dataset, const H5::DataType& _type, void* _value) const;
 
-	void OpenH5File(const std::filesystem::path& _fileName, bool _isOpen, bool _isSingleFile);
+	void OpenH5File(const std::filesystem::path& _fileName, bool _isOpen, bool _isSingleFile, bool _isWritable = false);
 };
@@ -24,7 +24,12 @@ namespace MDBDescriptors
 	const std::string SIGNATURE_STRING = "DyssolMaterialsDatabase"; ///< Signature string to recognize materials database file.
 	const unsigned VERSION = 3;										///< Version of the materials database file.
 
+	const std::string BINARY_SIGNATURE_STRING = "DMDBBIN";			///< Signature string to recognize binary materials database file.
+	const unsigned BINARY_VERSION = 1;								///< Version of the binary materials database file.
+
 	const std::string DEFAULT_MDB_FILE_NAME = "Materials.dmdb";		///< Default name of the materials database file.
+	const std::string TEXT_MDB_FILE_EXT = ".dmdb";					///< Extension of the text materials database file.
+	const std::string BINARY_MDB_FILE_EXT = ".bdmdb";				///< Extension of the binary materials database file.
 
 	const double TEMP_MIN = 10;										///< Minimum temperature.
 	const double TEMP_MAX = 10000;									///< Maximum temperature.
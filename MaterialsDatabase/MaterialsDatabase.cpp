@@ -5,11 +5,192 @@
 #include "DyssolUtilities.h"
 #include "DyssolStringConstants.h"
 #include "ContainerFunctions.h"
+#include "MemoryMappedFile.h"
+#include <cstring>
 #include <fstream>
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
 
 using namespace StringFunctions;
 
+namespace
+{
+	// Header of the binary materials database file.
+	struct SBinaryHeader
+	{
+		char signature[8]{};	// Signature string, padded with zeros.
+		uint32_t version{};		// Version of the binary format.
+		uint32_t byteOrder{};	// Byte order mark to detect files written on machines with different endianness.
+		uint64_t payloadSize{};	// Size of the data following the header.
+		uint64_t checksum{};	// Checksum of the data following the header.
+	};
+
+	constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+	// Calculates FNV-1a hash of the data.
+	uint64_t Checksum(const char* _data, size_t _size)
+	{
+		uint64_t hash = 0xcbf29ce484222325ULL;
+		for (size_t i = 0; i < _size; ++i)
+		{
+			hash ^= static_cast<uint8_t>(_data[i]);
+			hash *= 0x100000001b3ULL;
+		}
+		return hash;
+	}
+
+	// Sequentially writes values into a memory buffer.
+	class CBinaryWriter
+	{
+		std::string m_buffer;
+
+	public:
+		template<typename T>
+		void Write(const T& _value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			m_buffer.append(reinterpret_cast<const char*>(&_value), sizeof(T));
+		}
+		void Write(const std::string& _value)
+		{
+			Write(static_cast<uint32_t>(_value.size()));
+			m_buffer.append(_value);
+		}
+		void Write(const std::vector<double>& _values)
+		{
+			Write(static_cast<uint32_t>(_values.size()));
+			for (const double v : _values)
+				Write(v);
+		}
+		void Append(const std::string& _data) { m_buffer.append(_data); }
+		[[nodiscard]] size_t Size() const { return m_buffer.size(); }
+		[[nodiscard]] const std::string& Buffer() const { return m_buffer; }
+	};
+
+	// Sequentially reads values from a memory buffer. After reading past the end, returns default values and reports failure.
+	class CBinaryReader
+	{
+		const char* m_pos;
+		const char* m_end;
+		bool m_ok{ true };
+
+	public:
+		CBinaryReader(const char* _data, size_t _size) : m_pos{ _data }, m_end{ _data + _size } {}
+
+		template<typename T>
+		T Read()
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			T res{};
+			if (!Check(sizeof(T))) return res;
+			std::memcpy(&res, m_pos, sizeof(T));
+			m_pos += sizeof(T);
+			return res;
+		}
+		std::string ReadString()
+		{
+			const auto size = Read<uint32_t>();
+			if (!Check(size)) return {};
+			std::string res{ m_pos, size };
+			m_pos += size;
+			return res;
+		}
+		std::vector<double> ReadDoubles()
+		{
+			const auto size = Read<uint32_t>();
+			if (!Check(static_cast<size_t>(size) * sizeof(double))) return {};
+			std::vector<double> res(size);
+			for (auto& v : res)
+				v = Read<double>();
+			return res;
+		}
+		[[nodiscard]] bool Ok() const { return m_ok; }
+
+	private:
+		bool Check(size_t _size)
+		{
+			if (static_cast<size_t>(m_end - m_pos) < _size)
+				m_ok = false;
+			return m_ok;
+		}
+	};
+
+	// Writes all correlations of the property.
+	void WriteCorrelations(CBinaryWriter& _writer, const CTPDProperty& _prop)
+	{
+		_writer.Write(static_cast<uint32_t>(_prop.GetType()));
+		_writer.Write(_prop.GetDescription());
+		_writer.Write(static_cast<uint32_t>(_prop.CorrelationsNumber()));
+		for (size_t i = 0; i < _prop.CorrelationsNumber(); ++i)
+		{
+			const CCorrelation& corr = *_prop.GetCorrelation(i);
+			_writer.Write(static_cast<uint32_t>(corr.GetType()));
+			_writer.Write(corr.GetTInterval());
+			_writer.Write(corr.GetPInterval());
+			_writer.Write(corr.GetParameters());
+			_writer.Write(corr.GetDescription());
+		}
+	}
+
+	// Reads all correlations of the property and replaces existing ones.
+	template<typename TGetter>
+	void ReadCorrelations(CBinaryReader& _reader, TGetter&& _getProperty)
+	{
+		CTPDProperty* prop = _getProperty(_reader.Read<uint32_t>());
+		const std::string description = _reader.ReadString();
+		if (prop)
+		{
+			prop->RemoveAllCorrelations();
+			prop->SetDescription(description);
+		}
+		const auto number = _reader.Read<uint32_t>();
+		for (uint32_t i = 0; i < number && _reader.Ok(); ++i)
+		{
+			const auto type = static_cast<ECorrelationTypes>(_reader.Read<uint32_t>());
+			const auto TInterval = _reader.Read<SInterval>();
+			const auto PInterval = _reader.Read<SInterval>();
+			const auto params = _reader.ReadDoubles();
+			CCorrelation corr{ type, params, TInterval, PInterval };
+			corr.SetDescription(_reader.ReadString());
+			if (prop)
+				prop->AddCorrelation(corr);
+		}
+	}
+
+	// Checks whether the property has any non-default data to store.
+	bool HasData(const CTPDProperty& _prop)
+	{
+		if (!_prop.IsDefaultValue() || !_prop.GetDescription().empty()) return true;
+		for (size_t i = 0; i < _prop.CorrelationsNumber(); ++i)
+			if (!_prop.GetCorrelation(i)->GetDescription().empty())
+				return true;
+		return false;
+	}
+}
+
+struct CMaterialsDatabase::SBinarySource
+{
+	// Position of a data block in the payload.
+	struct SBlock
+	{
+		uint64_t offset{};
+		uint64_t size{};
+	};
+
+	CMemoryMappedFile file;													// Mapped file.
+	const char* payload{};													// Pointer to the beginning of the payload in the mapped file.
+	std::unordered_map<std::string, SBlock> compounds;						// Not yet loaded compounds, by their keys.
+	std::map<std::pair<std::string, std::string>, SBlock> interactions;		// Not yet loaded interactions, by keys of compounds.
+	std::mutex mutex;														// Guards access to not yet loaded data.
+
+	// Returns a reader for the block.
+	[[nodiscard]] CBinaryReader Reader(const SBlock& _block) const
+	{
+		return CBinaryReader{ payload + _block.offset, static_cast<size_t>(_block.size) };
+	}
+};
+
 CMaterialsDatabase::CMaterialsDatabase()
 {
 	m_sFileName = MDBDescriptors::DEFAULT_MDB_FILE_NAME;
@@ -19,6 +200,10 @@ CMaterialsDatabase::CMaterialsDatabase()
 	activeInterProperties = MDBDescriptors::defaultInteractionProperties;
 }
 
+CMaterialsDatabase::~CMaterialsDatabase() = default;
+CMaterialsDatabase::CMaterialsDatabase(CMaterialsDatabase&& _other) noexcept = default;
+CMaterialsDatabase& CMaterialsDatabase::operator=(CMaterialsDatabase&& _other) noexcept = default;
+
 MDBDescriptors::constDescr CMaterialsDatabase::ActiveConstProperties() const
 {
 	return activeConstProperties;
@@ -36,6 +221,8 @@ MDBDescriptors::interDescr CMaterialsDatabase::ActiveInterProperties() const
 
 void CMaterialsDatabase::AddProperty(const MDBDescriptors::SPropertyDescriptor& _descriptor)
 {
+	MaterializeAll();
+
 	// get value to check _key
 	unsigned firstKey{ MDBDescriptors::FIRST_CONST_USER_PROP };
 	switch (_descriptor.type)
@@ -89,6 +276,7 @@ void CMaterialsDatabase::AddProperty(const MDBDescriptors::SPropertyDescriptor&
 
 void CMaterialsDatabase::RemoveProperty(const MDBDescriptors::EPropertyType& _type, unsigned _key)
 {
+	MaterializeAll();
 	switch (_type)
 	{
 	case MDBDescriptors::EPropertyType::CONSTANT:
@@ -130,6 +318,7 @@ void CMaterialsDatabase::Clear()
 	m_sFileName.clear();
 	m_vCompounds.clear();
 	m_vInteractions.clear();
+	m_binary.reset();
 
 	activeConstProperties = MDBDescriptors::defaultConstProperties;
 	activeTPDepProperties = MDBDescriptors::defaultTPDProperties;
@@ -165,6 +354,10 @@ bool CMaterialsDatabase::SaveToFile(const std::filesystem::path& _fileName /*= "
 	};
 
 	const std::filesystem::path fileName = _fileName.empty() ? m_sFileName : _fileName;
+	if (fileName.extension() == MDBDescriptors::BINARY_MDB_FILE_EXT)
+		return SaveToBinaryFile(fileName);
+
+	MaterializeAll();
 	std::ofstream outFile(fileName);
 	if (outFile.fail()) return false;
 
@@ -269,6 +462,8 @@ bool CMaterialsDatabase::LoadFromFile(const std::filesystem::path& _fileName /*=
 {
 	Clear();
 	const std::filesystem::path fileName = _fileName.empty() ? std::filesystem::path{ MDBDescriptors::DEFAULT_MDB_FILE_NAME } : _fileName;
+	if (IsBinaryFile(fileName))
+		return LoadFromBinaryFile(fileName);
 
 	std::ifstream inFile(fileName);
 	if (inFile.fail()) return false;
@@ -561,6 +756,253 @@ bool CMaterialsDatabase::LoadFromFileV3(std::ifstream& _file)
 	return true;
 }
 
+bool CMaterialsDatabase::SaveToBinaryFile(const std::filesystem::path& _fileName)
+{
+	// Writes information about user-defined types
+	const auto WritePropInfo = [](CBinaryWriter& _writer, MDBDescriptors::EPropertyType _type, unsigned _key, const MDBDescriptors::SCompoundPropertyDescriptor& _descr)
+	{
+		_writer.Write(static_cast<uint32_t>(_type));
+		_writer.Write(static_cast<uint32_t>(_key));
+		_writer.Write(_descr.name);
+		_writer.Write(WString2String(_descr.units));
+		_writer.Write(_descr.description);
+		if (_type == MDBDescriptors::EPropertyType::CONSTANT)
+			_writer.Write(dynamic_cast<const MDBDescriptors::SCompoundConstPropertyDescriptor&>(_descr).defaultValue);
+		else
+		{
+			const auto& descr = dynamic_cast<const MDBDescriptors::SCompoundTPDPropertyDescriptor&>(_descr);
+			_writer.Write(static_cast<uint32_t>(descr.defuaultType));
+			_writer.Write(descr.defaultParameters);
+		}
+	};
+
+	// all data must be in memory, also to release the mapping if the same file is overwritten
+	MaterializeAll();
+
+	// additional properties
+	CBinaryWriter props;
+	uint32_t propsNumber = 0;
+	for (const auto& [key, descr] : activeConstProperties)
+		if (!MapContainsKey(MDBDescriptors::defaultConstProperties, key))
+		{
+			WritePropInfo(props, MDBDescriptors::EPropertyType::CONSTANT, key, descr);
+			++propsNumber;
+		}
+	for (const auto& [key, descr] : activeTPDepProperties)
+		if (!MapContainsKey(MDBDescriptors::defaultTPDProperties, key))
+		{
+			WritePropInfo(props, MDBDescriptors::EPropertyType::TP_DEPENDENT, key, descr);
+			++propsNumber;
+		}
+	for (const auto& [key, descr] : activeInterProperties)
+		if (!MapContainsKey(MDBDescriptors::defaultInteractionProperties, key))
+		{
+			WritePropInfo(props, MDBDescriptors::EPropertyType::INTERACTION, key, descr);
+			++propsNumber;
+		}
+
+	// data blocks of compounds
+	std::vector<std::string> compoundBlocks;
+	for (const auto& compound : m_vCompounds)
+	{
+		CBinaryWriter block;
+		block.Write(compound.GetDescription());
+		uint32_t number = 0;
+		CBinaryWriter constProps;
+		for (const auto& prop : compound.GetConstProperties())
+			if (!prop.IsDefaultValue() || !prop.GetDescription().empty())
+			{
+				constProps.Write(static_cast<uint32_t>(prop.GetType()));
+				constProps.Write(prop.GetValue());
+				constProps.Write(prop.GetDescription());
+				++number;
+			}
+		block.Write(number);
+		block.Append(constProps.Buffer());
+		number = 0;
+		CBinaryWriter tpProps;
+		for (const auto& prop : compound.GetTPProperties())
+			if (HasData(prop))
+			{
+				WriteCorrelations(tpProps, prop);
+				++number;
+			}
+		block.Write(number);
+		block.Append(tpProps.Buffer());
+		compoundBlocks.push_back(block.Buffer());
+	}
+
+	// data blocks of interactions, only with non-default values
+	std::vector<const CInteraction*> interactions;
+	std::vector<std::string> interactionBlocks;
+	for (const auto& interaction : m_vInteractions)
+	{
+		CBinaryWriter block;
+		uint32_t number = 0;
+		CBinaryWriter interProps;
+		for (const auto& prop : interaction.GetProperties())
+			if (HasData(prop))
+			{
+				WriteCorrelations(interProps, prop);
+				++number;
+			}
+		if (number == 0) continue;
+		block.Write(number);
+		block.Append(interProps.Buffer());
+		interactions.push_back(&interaction);
+		interactionBlocks.push_back(block.Buffer());
+	}
+
+	// index of compounds and interactions; offsets are counted from the beginning of the payload
+	const auto WriteIndex = [&](uint64_t _dataOffset)
+	{
+		CBinaryWriter res;
+		uint64_t offset = _dataOffset;
+		res.Write(static_cast<uint32_t>(m_vCompounds.size()));
+		for (size_t i = 0; i < m_vCompounds.size(); ++i)
+		{
+			res.Write(m_vCompounds[i].GetKey());
+			res.Write(m_vCompounds[i].GetName());
+			res.Write(offset);
+			res.Write(static_cast<uint64_t>(compoundBlocks[i].size()));
+			offset += compoundBlocks[i].size();
+		}
+		res.Write(static_cast<uint32_t>(interactions.size()));
+		for (size_t i = 0; i < interactions.size(); ++i)
+		{
+			res.Write(interactions[i]->GetKey1());
+			res.Write(interactions[i]->GetKey2());
+			res.Write(offset);
+			res.Write(static_cast<uint64_t>(interactionBlocks[i].size()));
+			offset += interactionBlocks[i].size();
+		}
+		return res;
+	};
+	// the size of the index does not depend on offsets, so it can be determined with a dry run
+	const uint64_t dataOffset = sizeof(uint32_t) + props.Size() + WriteIndex(0).Size();
+	const CBinaryWriter index = WriteIndex(dataOffset);
+
+	// payload
+	CBinaryWriter payload;
+	payload.Write(propsNumber);
+	payload.Append(props.Buffer());
+	payload.Append(index.Buffer());
+	for (const auto& block : compoundBlocks)
+		payload.Append(block);
+	for (const auto& block : interactionBlocks)
+		payload.Append(block);
+
+	// header
+	SBinaryHeader header;
+	std::memcpy(header.signature, MDBDescriptors::BINARY_SIGNATURE_STRING.data(), std::min(MDBDescriptors::BINARY_SIGNATURE_STRING.size(), sizeof(header.signature)));
+	header.version     = MDBDescriptors::BINARY_VERSION;
+	header.byteOrder   = BYTE_ORDER_MARK;
+	header.payloadSize = payload.Size();
+	header.checksum    = Checksum(payload.Buffer().data(), payload.Size());
+
+	std::ofstream outFile(_fileName, std::ios::binary);
+	if (outFile.fail()) return false;
+	outFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	outFile.write(payload.Buffer().data(), static_cast<std::streamsize>(payload.Size()));
+	if (outFile.fail()) return false;
+
+	m_sFileName = _fileName;
+	return true;
+}
+
+bool CMaterialsDatabase::LoadFromBinaryFile(const std::filesystem::path& _fileName)
+{
+	Clear();
+
+	auto source = std::make_unique<SBinarySource>();
+	if (!source->file.Open(_fileName)) return false;
+
+	// check header
+	if (source->file.Size() < sizeof(SBinaryHeader)) return false;
+	SBinaryHeader header;
+	std::memcpy(&header, source->file.Data(), sizeof(header));
+	if (std::string{ header.signature, strnlen(header.signature, sizeof(header.signature)) } != MDBDescriptors::BINARY_SIGNATURE_STRING) return false;
+	if (header.version != MDBDescriptors::BINARY_VERSION) return false;
+	if (header.byteOrder != BYTE_ORDER_MARK) return false;
+	if (header.payloadSize != source->file.Size() - sizeof(SBinaryHeader)) return false;
+	source->payload = source->file.Data() + sizeof(SBinaryHeader);
+	if (header.checksum != Checksum(source->payload, header.payloadSize)) return false;
+
+	CBinaryReader reader{ source->payload, header.payloadSize };
+
+	// additional properties
+	const auto propsNumber = reader.Read<uint32_t>();
+	for (uint32_t i = 0; i < propsNumber && reader.Ok(); ++i)
+	{
+		const auto type = static_cast<MDBDescriptors::EPropertyType>(reader.Read<uint32_t>());
+		const auto key = reader.Read<uint32_t>();
+		MDBDescriptors::SCompoundPropertyDescriptor* descr{};
+		switch (type)
+		{
+		case MDBDescriptors::EPropertyType::CONSTANT:	  descr = &activeConstProperties[static_cast<ECompoundConstProperties>(key)]; break;
+		case MDBDescriptors::EPropertyType::TP_DEPENDENT: descr = &activeTPDepProperties[static_cast<ECompoundTPProperties>(key)];	  break;
+		case MDBDescriptors::EPropertyType::INTERACTION:  descr = &activeInterProperties[static_cast<EInteractionProperties>(key)];  break;
+		default: Clear(); return false;
+		}
+		descr->name = reader.ReadString();
+		descr->units = String2WString(reader.ReadString());
+		descr->description = reader.ReadString();
+		if (type == MDBDescriptors::EPropertyType::CONSTANT)
+			dynamic_cast<MDBDescriptors::SCompoundConstPropertyDescriptor*>(descr)->defaultValue = reader.Read<double>();
+		else
+		{
+			dynamic_cast<MDBDescriptors::SCompoundTPDPropertyDescriptor*>(descr)->defuaultType = static_cast<ECorrelationTypes>(reader.Read<uint32_t>());
+			dynamic_cast<MDBDescriptors::SCompoundTPDPropertyDescriptor*>(descr)->defaultParameters = reader.ReadDoubles();
+		}
+	}
+
+	// compounds are created with default properties, the rest is read on first access
+	const auto ReadBlock = [&]
+	{
+		SBinarySource::SBlock block{ reader.Read<uint64_t>(), reader.Read<uint64_t>() };
+		if (block.offset > header.payloadSize || block.size > header.payloadSize - block.offset)
+			block = {};
+		return block;
+	};
+	const auto compoundsNumber = reader.Read<uint32_t>();
+	for (uint32_t i = 0; i < compoundsNumber && reader.Ok(); ++i)
+	{
+		const std::string key = reader.ReadString();
+		const std::string name = reader.ReadString();
+		CCompound* compound = AddCompound(key);
+		compound->SetName(name);
+		source->compounds[compound->GetKey()] = ReadBlock();
+	}
+	const auto interactionsNumber = reader.Read<uint32_t>();
+	for (uint32_t i = 0; i < interactionsNumber && reader.Ok(); ++i)
+	{
+		const std::string key1 = reader.ReadString();
+		const std::string key2 = reader.ReadString();
+		const CInteraction* interaction = AddInteraction(key1, key2);
+		source->interactions[{ interaction->GetKey1(), interaction->GetKey2() }] = ReadBlock();
+	}
+
+	if (!reader.Ok())
+	{
+		Clear();
+		return false;
+	}
+
+	m_binary = std::move(source);
+	m_sFileName = _fileName;
+	return true;
+}
+
+bool CMaterialsDatabase::IsBinaryFile(const std::filesystem::path& _fileName)
+{
+	std::ifstream file(_fileName, std::ios::binary);
+	if (file.fail()) return false;
+	char signature[sizeof(SBinaryHeader::signature)]{};
+	file.read(signature, sizeof(signature));
+	if (file.gcount() != sizeof(signature)) return false;
+	return std::string{ signature, strnlen(signature, sizeof(signature)) } == MDBDescriptors::BINARY_SIGNATURE_STRING;
+}
+
 size_t CMaterialsDatabase::CompoundsNumber() const
 {
 	return m_vCompounds.size();
@@ -588,6 +1030,13 @@ CCompound* CMaterialsDatabase::AddCompound(const CCompound& _compound)
 void CMaterialsDatabase::RemoveCompound(size_t _iCompound)
 {
 	if (_iCompound >= m_vCompounds.size()) return;
+	if (m_binary) // forget not yet loaded data of the compound
+	{
+		const std::string key = m_vCompounds[_iCompound].GetKey();
+		std::lock_guard lock{ m_binary->mutex };
+		m_binary->compounds.erase(key);
+		std::erase_if(m_binary->interactions, [&](const auto& _entry) { return _entry.first.first == key || _entry.first.second == key; });
+	}
 	ConformInteractionsRemove(m_vCompounds[_iCompound].GetKey());
 	m_vCompounds.erase(m_vCompounds.begin() + _iCompound);
 }
@@ -634,9 +1083,9 @@ CCompound* CMaterialsDatabase::GetCompound(size_t _iCompound)
 
 const CCompound* CMaterialsDatabase::GetCompound(size_t _iCompound) const
 {
-	if (_iCompound < m_vCompounds.size())
-		return &m_vCompounds[_iCompound];
-	return nullptr;
+	if (_iCompound >= m_vCompounds.size()) return nullptr;
+	MaterializeCompound(m_vCompounds[_iCompound]);
+	return &m_vCompounds[_iCompound];
 }
 
 CCompound* CMaterialsDatabase::GetCompound(const std::string& _sCompoundUniqueKey)
@@ -648,7 +1097,10 @@ const CCompound* CMaterialsDatabase::GetCompound(const std::string& _sCompoundUn
 {
 	for(const auto& c : m_vCompounds)
 		if (c.GetKey() == _sCompoundUniqueKey)
+		{
+			MaterializeCompound(c);
 			return &c;
+		}
 	return nullptr;
 }
 
@@ -661,7 +1113,10 @@ const CCompound* CMaterialsDatabase::GetCompoundByName(const std::string& _sComp
 {
 	for (const auto& c : m_vCompounds)
 		if (c.GetName() == _sCompoundName)
+		{
+			MaterializeCompound(c);
 			return &c;
+		}
 	return nullptr;
 }
 
@@ -669,7 +1124,10 @@ std::vector<CCompound*> CMaterialsDatabase::GetCompounds()
 {
 	auto res = ReservedVector<CCompound*>(m_vCompounds.size());
 	for (auto& c : m_vCompounds)
+	{
+		MaterializeCompound(c);
 		res.push_back(&c);
+	}
 	return res;
 }
 
@@ -677,7 +1135,10 @@ std::vector<const CCompound*> CMaterialsDatabase::GetCompounds() const
 {
 	auto res = ReservedVector<const CCompound*>(m_vCompounds.size());
 	for (const auto& c : m_vCompounds)
+	{
+		MaterializeCompound(c);
 		res.push_back(&c);
+	}
 	return res;
 }
 
@@ -779,9 +1240,9 @@ CInteraction* CMaterialsDatabase::GetInteraction(size_t _iInteraction)
 
 const CInteraction* CMaterialsDatabase::GetInteraction(size_t _iInteraction) const
 {
-	if (_iInteraction < m_vInteractions.size())
-		return &m_vInteractions[_iInteraction];
-	return nullptr;
+	if (_iInteraction >= m_vInteractions.size()) return nullptr;
+	MaterializeInteraction(m_vInteractions[_iInteraction]);
+	return &m_vInteractions[_iInteraction];
 }
 
 CInteraction* CMaterialsDatabase::GetInteraction(const std::string& _sCompoundKey1, const std::string& _sCompoundKey2)
@@ -796,9 +1257,8 @@ const CInteraction* CMaterialsDatabase::GetInteraction(const std::string& _sComp
 
 double CMaterialsDatabase::GetInteractionValue(const std::string& _sCompoundKey1, const std::string& _sCompoundKey2, EInteractionProperties _nInterPropType, double _dT, double _dP) const
 {
-	for (const auto& i : m_vInteractions)
-		if (i.IsBetween(_sCompoundKey1, _sCompoundKey2))
-			return i.GetPropertyValue(_nInterPropType, _dT, _dP);
+	if (const CInteraction* inter = GetInteraction(_sCompoundKey1, _sCompoundKey2))
+		return inter->GetPropertyValue(_nInterPropType, _dT, _dP);
 	return 0;
 }
 
@@ -843,6 +1303,61 @@ void CMaterialsDatabase::ConformInteractionsRemove(const std::string& _sCompound
 			++i;
 }
 
+void CMaterialsDatabase::MaterializeCompound(const CCompound& _compound) const
+{
+	if (!m_binary) return;
+	std::lock_guard lock{ m_binary->mutex };
+	const auto it = m_binary->compounds.find(_compound.GetKey());
+	if (it == m_binary->compounds.end()) return;
+	CBinaryReader reader = m_binary->Reader(it->second);
+	m_binary->compounds.erase(it);
+
+	// the compound is owned by this database, only its lazily loaded part is modified here
+	auto& compound = const_cast<CCompound&>(_compound);
+	compound.SetDescription(reader.ReadString());
+	const auto constNumber = reader.Read<uint32_t>();
+	for (uint32_t i = 0; i < constNumber && reader.Ok(); ++i)
+	{
+		const auto type = static_cast<ECompoundConstProperties>(reader.Read<uint32_t>());
+		const auto value = reader.Read<double>();
+		const auto description = reader.ReadString();
+		if (CConstProperty* prop = compound.GetConstProperty(type))
+		{
+			prop->SetValue(value);
+			prop->SetDescription(description);
+		}
+	}
+	const auto tpNumber = reader.Read<uint32_t>();
+	for (uint32_t i = 0; i < tpNumber && reader.Ok(); ++i)
+		ReadCorrelations(reader, [&](uint32_t _type) { return compound.GetTPProperty(static_cast<ECompoundTPProperties>(_type)); });
+}
+
+void CMaterialsDatabase::MaterializeInteraction(const CInteraction& _interaction) const
+{
+	if (!m_binary) return;
+	std::lock_guard lock{ m_binary->mutex };
+	const auto it = m_binary->interactions.find({ _interaction.GetKey1(), _interaction.GetKey2() });
+	if (it == m_binary->interactions.end()) return;
+	CBinaryReader reader = m_binary->Reader(it->second);
+	m_binary->interactions.erase(it);
+
+	// the interaction is owned by this database, only its lazily loaded part is modified here
+	auto& interaction = const_cast<CInteraction&>(_interaction);
+	const auto number = reader.Read<uint32_t>();
+	for (uint32_t i = 0; i < number && reader.Ok(); ++i)
+		ReadCorrelations(reader, [&](uint32_t _type) { return interaction.GetProperty(static_cast<EInteractionProperties>(_type)); });
+}
+
+void CMaterialsDatabase::MaterializeAll()
+{
+	if (!m_binary) return;
+	for (const auto& c : m_vCompounds)
+		MaterializeCompound(c);
+	for (const auto& i : m_vInteractions)
+		MaterializeInteraction(i);
+	m_binary.reset();
+}
+
 std::string CMaterialsDatabase::Comment(const std::string& _s)
 {
 	return " \t" + StrConst::COMMENT_SYMBOL + " " + _s;
@@ -7,6 +7,7 @@
 #include "Compound.h"
 #include "Interaction.h"
 #include "DyssolFilesystem.h"
+#include <memory>
 
 // Description of parameters of all compounds.
 class CMaterialsDatabase
@@ -42,6 +43,9 @@ class CMaterialsDatabase
 		COMPOUND_PROPERTY = 26
 	};
 
+	// Memory-mapped binary file with data of compounds and interactions, which have not yet been loaded.
+	struct SBinarySource;
+
 	MDBDescriptors::constDescr activeConstProperties;
 	MDBDescriptors::tpdepDescr activeTPDepProperties;
 	MDBDescriptors::interDescr activeInterProperties;
@@ -49,9 +53,15 @@ class CMaterialsDatabase
 	std::filesystem::path m_sFileName;			// Current file where the database is stored.
 	std::vector<CCompound> m_vCompounds;				// List of defined compounds.
 	std::vector<CInteraction> m_vInteractions;	// List of defined interactions between each pair of defined compounds.
+	std::unique_ptr<SBinarySource> m_binary;	// Source of not yet loaded data if the database was loaded from a binary file.
 
 public:
 	CMaterialsDatabase();
+	~CMaterialsDatabase();
+	CMaterialsDatabase(const CMaterialsDatabase& _other) = delete;
+	CMaterialsDatabase& operator=(const CMaterialsDatabase& _other) = delete;
+	CMaterialsDatabase(CMaterialsDatabase&& _other) noexcept;
+	CMaterialsDatabase& operator=(CMaterialsDatabase&& _other) noexcept;
 
 	//////////////////////////////////////////////////////////////////////////
 	/// Functions to work with properties
@@ -82,8 +92,14 @@ public:
 
 	// Saves database to a text file with specified name. If the name is not specified, data will be written to the default file. Returns true on success.
 	bool SaveToFile(const std::filesystem::path& _fileName = "");
-	// Loads database from a text file with specified name. If the name is not specified, data will be loaded from the default file. Returns true on success.
+	// Loads database from a text or binary file with specified name. If the name is not specified, data will be loaded from the default file. Returns true on success.
 	bool LoadFromFile(const std::filesystem::path& _fileName = "");
+	// Saves database to a binary file with specified name. Returns true on success.
+	bool SaveToBinaryFile(const std::filesystem::path& _fileName);
+	// Loads database from a binary file with specified name. The file is memory-mapped and properties of compounds and interactions are read on first access. Returns true on success.
+	bool LoadFromBinaryFile(const std::filesystem::path& _fileName);
+	// Checks whether the file is a binary materials database file.
+	static bool IsBinaryFile(const std::filesystem::path& _fileName);
 	// Loads database from the file. Loads file with old syntax for versions before v0.7. Returns true on success.
 	bool LoadFromFileV0(std::ifstream& _file);
 	// Loads database from the file. Loads file with old syntax for versions before v0.9.1. Returns true on success.
@@ -206,6 +222,16 @@ private:
 	// Removes interactions with specified compound, if exists.
 	void ConformInteractionsRemove(const std::string& _sCompoundKey);
 
+	//////////////////////////////////////////////////////////////////////////
+	/// Functions to work with binary files
+
+	// Reads not yet loaded properties of the compound from the binary file.
+	void MaterializeCompound(const CCompound& _compound) const;
+	// Reads not yet loaded properties of the interaction from the binary file.
+	void MaterializeInteraction(const CInteraction& _interaction) const;
+	// Reads all not yet loaded data from the binary file and releases it.
+	void MaterializeAll();
+
 	//////////////////////////////////////////////////////////////////////////
 	/// Auxiliary function to work with text files
 
@@ -11,6 +11,7 @@
 #include "DyssolStringConstants.h"
 #include "DyssolUtilities.h"
 #include "H5Handler.h"
+#include "MixtureEnthalpyCache.h"
 
 // TODO: remove all reinterpret_cast and static_cast for MDMatrix.
 
@@ -75,6 +76,7 @@ void CBaseStream::Clear()
 	m_overall.clear();
 	m_phases.clear();
 	ClearEnthalpyCalculator();
+	ClearPropertyKernels();
 }
 
 void CBaseStream::SetupStructure(const CBaseStream* _other)
@@ -401,6 +403,7 @@ void CBaseStream::AddCompound(const std::string& _compoundKey)
 
 	// invalidate enthalpy calculator
 	ClearEnthalpyCalculator();
+	ClearPropertyKernels();
 }
 
 void CBaseStream::RemoveCompound(const std::string& _compoundKey)
@@ -416,6 +419,7 @@ void CBaseStream::RemoveCompound(const std::string& _compoundKey)
 
 	// invalidate enthalpy calculator
 	ClearEnthalpyCalculator();
+	ClearPropertyKernels();
 }
 
 std::vector<std::string> CBaseStream::GetAllCompounds() const
@@ -640,17 +644,7 @@ double CBaseStream::GetPhaseProperty(double _time, EPhase _phase, ECompoundConst
 
 	// TODO: implement other properties if needed
 	if (_property == MOLAR_MASS)
-	{
-		double res = 0.0;
-		for (const auto& c : GetAllCompounds())
-		{
-			const double molarMass = GetCompoundProperty(c, MOLAR_MASS);
-			if (molarMass != 0.0)
-				res += GetCompoundFraction(_time, c, _phase) / molarMass;
-		}
-		if (res != 0.0)
-			return 1.0 / res;
-	}
+		return GetPropertyKernels()->MolarMass(GetCompoundsFractions(_time, _phase));
 	else
 	{
 		double res{ 0.0 };
@@ -680,75 +674,9 @@ double CBaseStream::GetPhaseProperty(double _time, EPhase _phase, ECompoundTPPro
 		return VectorMin(pressures);
 	}
 	case VISCOSITY:
-		switch (_phase)
-		{
-		case EPhase::LIQUID:
-			for (const auto& c : GetAllCompounds())
-			{
-				const double visco = m_materialsDB->GetTPPropertyValue(c, _property, T, P);
-				if (visco > 0.0)
-					res += GetCompoundFraction(_time, c, _phase) * std::log(visco);
-			}
-			if (res != 0.0)
-				return std::exp(res);
-			break;
-		case EPhase::VAPOR:
-		{
-			double numerator = 0.0, denominator = 0.0;
-			for (const auto& c : GetAllCompounds())
-			{
-				const double visco = m_materialsDB->GetTPPropertyValue(c, _property, T, P);
-				const double mollMass = GetCompoundProperty(c, MOLAR_MASS);
-				const double mollFrac = GetCompoundMolFraction(_time, c, _phase);
-				numerator += mollFrac * visco * std::sqrt(mollMass);
-				denominator += mollFrac * std::sqrt(mollMass);
-			}
-			if (denominator != 0.0)
-				return numerator / denominator;
-			break;
-		}
-		case EPhase::SOLID:
-			for (const auto& c : GetAllCompounds())
-				res += GetCompoundFraction(_time, c, _phase) * m_materialsDB->GetTPPropertyValue(c, _property, T, P);
-			return res;
-		case EPhase::UNDEFINED: return {};
-		}
-		break;
+		return GetPropertyKernels()->Viscosity(_phase, GetCompoundsFractions(_time, _phase), T, P);
 	case THERMAL_CONDUCTIVITY:
-		switch (_phase)
-		{
-		case EPhase::LIQUID:
-			for (const auto& c : GetAllCompounds())
-				if (const auto conduct = m_materialsDB->GetTPPropertyValue(c, _property, T, P); conduct != 0.0)
-					res += GetCompoundMolFraction(_time, c, _phase) / std::pow(conduct, 2.0);
-			if (res != 0.0)
-				return 1.0 / std::sqrt(res);
-			break;
-		case EPhase::VAPOR:
-			for (const auto& c1 : GetAllCompounds())
-			{
-				const double conduct1 = m_materialsDB->GetTPPropertyValue(c1, _property, T, P);
-				const double mollMass1 = GetCompoundProperty(c1, MOLAR_MASS);
-				const double numerator = GetCompoundMolFraction(_time, c1, _phase) * conduct1;
-				double denominator = 0.0;
-				for (const auto& c2 : GetAllCompounds())
-				{
-					const double conduct2 = m_materialsDB->GetTPPropertyValue(c2, _property, T, P);
-					const double mollMass2 = GetCompoundProperty(c2, MOLAR_MASS);
-					if (mollMass1 != 0.0 && mollMass2 != 0.0 && conduct2 != 0.0)
-						denominator += GetCompoundMolFraction(_time, c2, _phase) * std::pow(1 + std::sqrt(conduct1 / conduct2) * std::pow(mollMass2 / mollMass1, 1. / 4.), 2) / std::sqrt(8 * (1 + mollMass1 / mollMass2));
-				}
-				if (denominator != 0.0)
-					res += numerator / denominator;
-			}
-			return res;
-		case EPhase::SOLID:
-			for (const auto& c : GetAllCompounds())
-				res += GetCompoundFraction(_time, c, _phase) * m_materialsDB->GetTPPropertyValue(c, _property, T, P);
-			return res;
-		case EPhase::UNDEFINED: return {};
-		}
-		break;
+		return GetPropertyKernels()->ThermalConductivity(_phase, GetCompoundsFractions(_time, _phase), T, P);
 	case DENSITY:
 		if (_phase == EPhase::SOLID && m_grid.HasDimension(DISTR_PART_POROSITY))
 		{
@@ -766,15 +694,7 @@ double CBaseStream::GetPhaseProperty(double _time, EPhase _phase, ECompoundTPPro
 			return res;
 		}
 		else // for liquids and solids and vapor
-		{
-			for (const auto& c : GetAllCompounds())
-			{
-				const double componentDensity = m_materialsDB->GetTPPropertyValue(c, _property, T, P);
-				if (componentDensity != 0.0)
-					res += GetCompoundFraction(_time, c, _phase) / componentDensity;
-			}
-			return  1./res;
-		}
+			return GetPropertyKernels()->Density(GetCompoundsFractions(_time, _phase), T, P);
 		break;
 	case HEAT_CAPACITY_CP: // same for solids, liquids and gases
 		for (const auto& c : GetAllCompounds())
@@ -817,6 +737,36 @@ double CBaseStream::GetPhaseProperty(double _time, EPhase _phase, ECompoundTPPro
 	return {};
 }
 
+std::vector<double> CBaseStream::GetPhaseProperty(const std::vector<double>& _times, EPhase _phase, ECompoundTPProperties _property) const
+{
+	std::vector<double> res(_times.size());
+	if (!HasPhase(_phase)) return res;
+
+	const bool porous = _phase == EPhase::SOLID && m_grid.HasDimension(DISTR_PART_POROSITY);
+	if (_property != VISCOSITY && _property != THERMAL_CONDUCTIVITY && !(_property == DENSITY && !porous))
+	{
+		for (size_t i = 0; i < _times.size(); ++i)
+			res[i] = GetPhaseProperty(_times[i], _phase, _property);
+		return res;
+	}
+
+	const auto* kernels = GetPropertyKernels();
+	const auto* phase = m_phases.at(_phase).get();
+	for (size_t i = 0; i < _times.size(); ++i)
+	{
+		const double T = GetTemperature(_times[i]);
+		const double P = GetPressure(_times[i]);
+		const auto fractions = phase->GetCompoundsDistribution(_times[i]);
+		switch (_property)
+		{
+		case VISCOSITY:				res[i] = kernels->Viscosity(_phase, fractions, T, P);			break;
+		case THERMAL_CONDUCTIVITY:	res[i] = kernels->ThermalConductivity(_phase, fractions, T, P);	break;
+		default:					res[i] = kernels->Density(fractions, T, P);						break;
+		}
+	}
+	return res;
+}
+
 void CBaseStream::SetPhaseFraction(double _time, EPhase _phase, double _value)
 {
 	if (!HasPhase(_phase)) return;
@@ -1571,16 +1521,12 @@ CMixtureEnthalpyLookup* CBaseStream::GetEnthalpyCalculator() const
 
 double CBaseStream::CalculateEnthalpyFromTemperature(double _time) const
 {
-	auto* table = GetEnthalpyCalculator();
-	table->SetCompoundFractions(GetCompoundsFractions(_time));
-	return table->GetEnthalpy(GetTemperature(_time));
+	return GetEnthalpyLookup(_time)->GetEnthalpy(GetTemperature(_time));
 }
 
 double CBaseStream::CalculateTemperatureFromEnthalpy(double _time) const
 {
-	auto* table = GetEnthalpyCalculator();
-	table->SetCompoundFractions(GetCompoundsFractions(_time));
-	return table->GetTemperature(GetMixtureProperty(_time, ENTHALPY));
+	return GetEnthalpyLookup(_time)->GetTemperature(GetMixtureProperty(_time, ENTHALPY));
 }
 
 const CMultidimensionalGrid& CBaseStream::GetGrid() const
@@ -1592,6 +1538,7 @@ void CBaseStream::SetMaterialsDatabase(const CMaterialsDatabase* _database)
 {
 	m_materialsDB = _database;
 	ClearEnthalpyCalculator();
+	ClearPropertyKernels();
 }
 
 void CBaseStream::SetGrid(const CMultidimensionalGrid& _grid)
@@ -1617,6 +1564,18 @@ void CBaseStream::SetCacheSettings(const SCacheSettings& _settings)
 		phase->SetCacheSettings(_settings);
 }
 
+void CBaseStream::DetachFromFile()
+{
+	for (auto& [state, phase] : m_phases)
+		phase->DetachFromFile();
+}
+
+void CBaseStream::UnloadFileData() const
+{
+	for (const auto& [state, phase] : m_phases)
+		phase->UnloadFileData();
+}
+
 void CBaseStream::SetToleranceSettings(const SToleranceSettings& _settings)
 {
 	m_toleranceSettings = _settings;
@@ -1685,6 +1644,18 @@ void CBaseStream::SaveToFile(CH5Handler& _h5File, const std::string& _path)
 {
 	if (!_h5File.IsValid()) return;
 
+	// data of another stream or with another structure may be stored under this path when appending to existing file
+	if (_h5File.IsAppending())
+	{
+		std::string key;
+		std::vector<unsigned> overallKeys, phaseKeys;
+		_h5File.ReadData(_path, StrConst::Stream_H5StreamKey, key);
+		_h5File.ReadData(_path, StrConst::Stream_H5OverallKeys, overallKeys);
+		_h5File.ReadData(_path, StrConst::Stream_H5PhaseKeys, phaseKeys);
+		if (key != m_key || vector_cast<EOverall>(overallKeys) != MapKeys(m_overall) || vector_cast<EPhase>(phaseKeys) != MapKeys(m_phases))
+			_h5File.ClearGroup(_path);
+	}
+
 	// current version of save procedure
 	_h5File.WriteAttribute(_path, StrConst::H5AttrSaveVersion, m_saveVersion);
 
@@ -1694,8 +1665,15 @@ void CBaseStream::SaveToFile(CH5Handler& _h5File, const std::string& _path)
 	// stream key
 	_h5File.WriteData(_path, StrConst::Stream_H5StreamKey, m_key);
 
-	// time points
-	_h5File.WriteData(_path, StrConst::Stream_H5TimePoints, m_timePoints);
+	// time points; those already stored in the file and not changed since then are kept
+	size_t nUnchanged = 0;
+	if (_h5File.IsAppending())
+	{
+		std::vector<double> stored;
+		_h5File.ReadData(_path, StrConst::Stream_H5TimePoints, stored);
+		nUnchanged = static_cast<size_t>(std::mismatch(stored.begin(), stored.end(), m_timePoints.begin(), m_timePoints.end()).first - stored.begin());
+	}
+	_h5File.WriteExtendible(_path, StrConst::Stream_H5TimePoints, m_timePoints, nUnchanged);
 
 	// grid
 	m_grid.SaveToFile(_h5File, _h5File.CreateGroup(_path, StrConst::H5GroupDistrGrid));
@@ -1742,6 +1720,7 @@ void CBaseStream::LoadFromFile(const CH5Handler& _h5File, const std::string& _pa
 	m_overall.clear();
 	m_phases.clear();
 	ClearEnthalpyCalculator();
+	ClearPropertyKernels();
 
 	// basic data
 	_h5File.ReadData(_path, StrConst::Stream_H5StreamName, m_name);
@@ -1795,6 +1774,7 @@ void CBaseStream::LoadFromFile_v1(const CH5Handler& _h5File, const std::string&
 	m_overall.clear();
 	m_phases.clear();
 	ClearEnthalpyCalculator();
+	ClearPropertyKernels();
 
 	// prepare some values
 	const std::string distrPathBase = _path + "/" + StrConst::Stream_H5Group2DDistrs + "/" + StrConst::Stream_H5Group2DDistrName;
@@ -1948,14 +1928,19 @@ double CBaseStream::CalculateMixTemperature(double _time1, const CBaseStream& _s
 	// if no material at all, return some arbitrary temperature
 	if (massMix == 0.0)
 		return 0.0;
-	// get and check lookup tables for enthalpies
-	const CMixtureEnthalpyLookup& lookup1 = *_stream1.GetEnthalpyCalculator();
-	const CMixtureEnthalpyLookup& lookup2 = *_stream2.GetEnthalpyCalculator();
-	if (lookup1.Size() == 1 && lookup2.Size() == 1 && lookup1 == lookup2)
+	// check lookup tables for enthalpies
+	const CMixtureEnthalpyLookup& calculator1 = *_stream1.GetEnthalpyCalculator();
+	const CMixtureEnthalpyLookup& calculator2 = *_stream2.GetEnthalpyCalculator();
+	if (calculator1.Size() == 1 && calculator2.Size() == 1 && calculator1 == calculator2)
 		return (temperature1 * _mass1 + temperature2 * _mass2) / massMix;
+	// get lookup tables for current compositions
+	const auto pLookup1 = _stream1.GetEnthalpyLookup(_time1);
+	const auto pLookup2 = _stream2.GetEnthalpyLookup(_time2);
+	const CMixtureEnthalpyLookup& lookup1 = *pLookup1;
+	const CMixtureEnthalpyLookup& lookup2 = *pLookup2;
 	// get enthalpies
-	const double enthalpy1 = _stream1.CalculateEnthalpyFromTemperature(_time1);
-	const double enthalpy2 = _stream2.CalculateEnthalpyFromTemperature(_time2);
+	const double enthalpy1 = lookup1.GetEnthalpy(temperature1);
+	const double enthalpy2 = lookup2.GetEnthalpy(temperature2);
 	// calculate (specific) total enthalpy
 	const double enthalpyMix = (enthalpy1 * _mass1 + enthalpy2 * _mass2) / massMix;
 	// combine both enthalpy tables for mixture enthalpy table
@@ -2173,7 +2158,31 @@ std::vector<double> CBaseStream::GetPSDNumber(double _time, const std::vector<st
 	}
 }
 
+std::shared_ptr<const CMixtureEnthalpyLookup> CBaseStream::GetEnthalpyLookup(double _time) const
+{
+	auto* calculator = GetEnthalpyCalculator();
+	// take the mixture table from the shared cache
+	if (m_thermodynamicsSettings.cache)
+		return m_thermodynamicsSettings.cache->Get(*calculator, GetCompoundsFractions(_time));
+	// no cache available - update own table; returned pointer does not own the table
+	calculator->SetCompoundFractions(GetCompoundsFractions(_time));
+	return { std::shared_ptr<const CMixtureEnthalpyLookup>{}, calculator };
+}
+
 void CBaseStream::ClearEnthalpyCalculator()
 {
 	m_enthalpyCalculator.reset(nullptr);
 }
+
+const CPhasePropertyKernels* CBaseStream::GetPropertyKernels() const
+{
+	// lazy initialization
+	if (!m_propertyKernels)
+		m_propertyKernels = std::make_unique<CPhasePropertyKernels>(m_materialsDB, GetAllCompounds());
+	return m_propertyKernels.get();
+}
+
+void CBaseStream::ClearPropertyKernels()
+{
+	m_propertyKernels.reset(nullptr);
+}
@@ -6,6 +6,7 @@
 
 #include "DefinesMDB.h"
 #include "MixtureEnthalpyLookup.h"
+#include "PhasePropertyKernels.h"
 #include "MultidimensionalGrid.h"
 #include <limits>
 
@@ -83,6 +84,11 @@ protected:
 	 * Lookup table to calculate temperature<->enthalpy.
 	 */
 	mutable std::unique_ptr<CMixtureEnthalpyLookup> m_enthalpyCalculator;
+	/**
+	 * \private
+	 * Mixing rules with precalculated constant data of compounds to calculate phase properties.
+	 */
+	mutable std::unique_ptr<CPhasePropertyKernels> m_propertyKernels;
 	/**
 	 * \private
 	 * Settings for caching in the stream.
@@ -820,6 +826,17 @@ public:
 	 * \return Value of the temperature/pressure-dependent physical property.
 	 */
 	double GetPhaseProperty(double _time, EPhase _phase, ECompoundTPProperties _property) const;
+	/**
+	 * \brief Returns the value of the temperature/pressure-dependent physical property of the specified phase at the given time points.
+	 * \details Returns the same values as CBaseStream::GetPhaseProperty(double, EPhase, ECompoundTPProperties) const for each time point,
+	 * but evaluates all time points in one pass, reusing the data of compounds. Use it to obtain properties for a whole time interval.
+	 * If there is no specified phase in the stream, zeros are returned.
+	 * \param _times Target time points.
+	 * \param _phase Phase type identifier.
+	 * \param _property Identifier of temperature/pressure-dependent property.
+	 * \return Values of the temperature/pressure-dependent physical property for each time point.
+	 */
+	std::vector<double> GetPhaseProperty(const std::vector<double>& _times, EPhase _phase, ECompoundTPProperties _property) const;
 
 	/**
 	 * \brief Sets the mass fraction of the specified phase at the given time point.
@@ -1040,6 +1057,7 @@ public:
 	CMatrix2D GetDistribution(double _time, EDistrTypes _distribution1, EDistrTypes _distribution2) const;
 	/**
 	 * \brief Returns multi-dimensional distribution of the solid material over the specified parameters at the given time point.
+	 * \details Use CDenseMDMatrix::GetView() of the returned matrix to access its elements without additional allocations.
 	 * \param _time Target time point.
 	 * \param _distributions List of distributed parameter types of the solid phase.
 	 * \return Multi-dimensional distribution of the solid material.
@@ -1070,6 +1088,7 @@ public:
 	 * \brief Returns multi-dimensional distribution of the solid material over the specified parameters for the given compound and time point.
 	 * \details Input dimensions should not include distribution by compounds (::DISTR_COMPOUNDS).
 	 * If specified compound has not been defined in the stream, empty matrix is returned.
+	 * Use CDenseMDMatrix::GetView() of the returned matrix to access its elements without additional allocations.
 	 * \param _time Target time point.
 	 * \param _distributions List of distributed parameter types of the solid phase.
 	 * \param _compoundKey Unique key of the compound.
@@ -1315,6 +1334,14 @@ public:
 	 * \return Pointer to enthalpy calculator.
 	 */
 	[[nodiscard]] CMixtureEnthalpyLookup* GetEnthalpyCalculator() const;
+	/**
+	 * \private
+	 * \brief Returns enthalpy lookup table for the mixture at the given time point.
+	 * \details If a shared cache is set in thermodynamics settings, takes the table from there. Otherwise, updates fractions in the own enthalpy calculator.
+	 * \param _time Target time point.
+	 * \return Lookup table for the mixture.
+	 */
+	[[nodiscard]] std::shared_ptr<const CMixtureEnthalpyLookup> GetEnthalpyLookup(double _time) const;
 
 	/**
 	 * \brief Calculates enthalpy of the stream mixture for the temperature at the given time point using a lookup table.
@@ -1364,6 +1391,18 @@ public:
 	 */
 	void SetCacheSettings(const SCacheSettings& _settings);
 
+	/**
+	 * \private
+	 * \brief Loads all data, which are loaded from file on demand, and releases the file.
+	 */
+	void DetachFromFile();
+	/**
+	 * \private
+	 * \brief Removes from memory unchanged data loaded from file on demand.
+	 * \details They will be loaded again when accessed.
+	 */
+	void UnloadFileData() const;
+
 	/**
 	 * \private
 	 * \brief Sets tolerance settings.
@@ -1589,4 +1628,16 @@ private:
 	 * \brief Clears enthalpy calculator.
 	 */
 	void ClearEnthalpyCalculator();
+
+	/**
+	 * \private
+	 * \brief Returns mixing rules to calculate phase properties. Creates them if needed.
+	 * \return Pointer to mixing rules.
+	 */
+	[[nodiscard]] const CPhasePropertyKernels* GetPropertyKernels() const;
+	/**
+	 * \private
+	 * \brief Clears mixing rules to calculate phase properties.
+	 */
+	void ClearPropertyKernels();
 };
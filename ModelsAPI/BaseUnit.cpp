@@ -10,6 +10,7 @@
 #include "DyssolUtilities.h"
 #include "DyssolStringConstants.h"
 #include "H5Handler.h"
+#include "MixtureEnthalpyCache.h"
 
 #include <stdexcept>
 #include <numeric>
@@ -122,6 +123,14 @@ void CBaseUnit::SetMaterialsDatabase(const CMaterialsDatabase* _materialsDB)
 	ClearEnthalpyCalculator();
 }
 
+void CBaseUnit::CopyUserData(const CBaseUnit& _other)
+{
+	SetGrid(_other.m_grid);
+	m_ports.CopyUserData(_other.m_ports);
+	m_unitParameters.CopyUserData(_other.m_unitParameters);
+	m_streams.CopyUserData(_other.m_streams);
+}
+
 std::string CBaseUnit::GetUnitName() const
 {
 	return m_unitName;
@@ -541,6 +550,19 @@ CSolverUnitParameter* CBaseUnit::AddSolverPBM(const std::string& _name, const st
 	return m_unitParameters.GetSolverParameter(_name);
 }
 
+CSolverUnitParameter* CBaseUnit::AddSolverBreakage(const std::string& _name, const std::string& _description)
+{
+	if (m_unitParameters.IsNameExist(_name))
+	{
+		auto* param = m_unitParameters.GetSolverParameter(_name);
+		if (param->GetSolverType() == ESolverTypes::SOLVER_BREAKAGE_1) // exists with the same name and type
+			return param;
+		throw std::logic_error(StrConst::BUnit_ErrAddParam(m_unitName, _name, __func__)); // same name but wrong type
+	}
+	m_unitParameters.AddSolverParameter(_name, _description, ESolverTypes::SOLVER_BREAKAGE_1);
+	return m_unitParameters.GetSolverParameter(_name);
+}
+
 void CBaseUnit::AddParametersToGroup(const std::string& _unitParamNameSelector, const std::string& _unitParamSelectedValueName, const std::vector<std::string>& _groupedParamNames)
 {
 	const auto* groupParameter = m_unitParameters.GetComboParameter(_unitParamNameSelector);
@@ -720,6 +742,37 @@ CPBMSolver* CBaseUnit::GetSolverPBM(const CSolverUnitParameter* _param) const
 	return GetSolverPBM(_param->GetName());
 }
 
+CBreakageSolver* CBaseUnit::GetSolverBreakage(const std::string& _name) const
+{
+	if (const CSolverUnitParameter* param = m_unitParameters.GetSolverParameter(_name))
+		return dynamic_cast<CBreakageSolver*>(param->GetSolver());
+	throw std::logic_error(StrConst::BUnit_ErrGetParam(m_unitName, _name, __func__));
+}
+
+CBreakageSolver* CBaseUnit::GetSolverBreakage(const CSolverUnitParameter* _param) const
+{
+	return GetSolverBreakage(_param->GetName());
+}
+
+std::function<void(const SSolverStatistics&)> CBaseUnit::RegisterSolver(const std::string& _name)
+{
+	auto statistics = std::make_shared<SSolverStatistics>();
+	const auto it = std::find_if(m_equationSolvers.begin(), m_equationSolvers.end(), [&](const auto& _entry) { return _entry.first == _name; });
+	if (it != m_equationSolvers.end())
+		it->second = statistics;
+	else
+		m_equationSolvers.emplace_back(_name, statistics);
+	return [statistics](const SSolverStatistics& _statistics) { *statistics = _statistics; };
+}
+
+std::vector<std::pair<std::string, SSolverStatistics>> CBaseUnit::GetSolversStatistics() const
+{
+	std::vector<std::pair<std::string, SSolverStatistics>> res;
+	for (const auto& [name, statistics] : m_equationSolvers)
+		res.emplace_back(name, *statistics);
+	return res;
+}
+
 const CStateVariablesManager& CBaseUnit::GetStateVariablesManager() const
 {
 	return m_stateVariables;
@@ -1335,6 +1388,11 @@ void CBaseUnit::UpdateCacheSettings()
 	m_streams.UpdateCacheSettings();
 }
 
+void CBaseUnit::DetachFromFile()
+{
+	m_streams.DetachFromFile();
+}
+
 void CBaseUnit::UpdateThermodynamicsSettings()
 {
 	m_streams.UpdateThermodynamicsSettings();
@@ -1382,6 +1440,8 @@ CMixtureEnthalpyLookup* CBaseUnit::GetEnthalpyCalculator() const
 double CBaseUnit::CalculateEnthalpyFromTemperature(double _temperature, const std::vector<double>& _fractions) const
 {
 	auto* calculator = GetEnthalpyCalculator();
+	if (m_thermodynamics->cache)
+		return m_thermodynamics->cache->Get(*calculator, _fractions)->GetEnthalpy(_temperature);
 	calculator->SetCompoundFractions(_fractions);
 	return calculator->GetEnthalpy(_temperature);
 }
@@ -1389,6 +1449,8 @@ double CBaseUnit::CalculateEnthalpyFromTemperature(double _temperature, const st
 double CBaseUnit::CalculateTemperatureFromEnthalpy(double _enthalpy, const std::vector<double>& _fractions) const
 {
 	auto* calculator = GetEnthalpyCalculator();
+	if (m_thermodynamics->cache)
+		return m_thermodynamics->cache->Get(*calculator, _fractions)->GetTemperature(_enthalpy);
 	calculator->SetCompoundFractions(_fractions);
 	return calculator->GetTemperature(_enthalpy);
 }
@@ -1406,14 +1468,16 @@ void CBaseUnit::HeatExchange(double _time, CBaseStream* _stream1, CBaseStream* _
 	if (massMix == 0.0)
 		return;
 
+	// enthalpy tables for current compositions of both streams
+	const auto lookup1 = _stream1->GetEnthalpyLookup(_time);
+	const auto lookup2 = _stream2->GetEnthalpyLookup(_time);
+
 	// calculate enthalpy
-	const double enthalpy1 = _stream1->CalculateEnthalpyFromTemperature(_time);
-	const double enthalpy2 = _stream2->CalculateEnthalpyFromTemperature(_time);
+	const double enthalpy1 = lookup1->GetEnthalpy(_stream1->GetTemperature(_time));
+	const double enthalpy2 = lookup2->GetEnthalpy(_stream2->GetTemperature(_time));
 	const double enthalpyMix = (mass1 * enthalpy1 + mass2 * enthalpy2) / massMix;
 
 	// add up both enthalpy tables weighted with their respective mass fraction of total mass flow
-	const CMixtureEnthalpyLookup* lookup1 = _stream1->GetEnthalpyCalculator();
-	const CMixtureEnthalpyLookup* lookup2 = _stream2->GetEnthalpyCalculator();
 	const CMixtureEnthalpyLookup lookupMix = *lookup1 * (mass1 / massMix) + *lookup2 * (mass2 / massMix);
 
 	// get ideal heat exchange temperature, i.e. temperature for maximum heat exchange between both streams (here: mixing temperature)
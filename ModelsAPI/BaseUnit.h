@@ -7,11 +7,14 @@
 #include "UnitParametersManager.h"
 #include "AgglomerationSolver.h"
 #include "PBMSolver.h"
+#include "BreakageSolver.h"
 #include "PlotManager.h"
 #include "UnitPorts.h"
 #include "StateVariable.h"
 #include "StreamManager.h"
 #include "DyssolUtilities.h"
+#include "SolverStatistics.h"
+#include <functional>
 #include <mutex>
 
 #ifdef _DEBUG
@@ -92,6 +95,8 @@ private:
 
 	mutable std::unique_ptr<CMixtureEnthalpyLookup> m_enthalpyCalculator;	// Lookup table to calculate temperature<->enthalpy.
 
+	std::vector<std::pair<std::string, std::shared_ptr<SSolverStatistics>>> m_equationSolvers;	// Names of registered equation solvers and their last reported statistics.
+
 	////////////////////////////////////////////////////////////////////////////////
 	// Generated messages
 	//
@@ -172,6 +177,15 @@ public:
 	*/
 	void SetMaterialsDatabase(const CMaterialsDatabase* _materialsDB);
 
+	/**
+	 * \private
+	 * \brief Copies all data defined by the user from another unit of the same type.
+	 * \details Copies distributions grid, connections of ports, values of unit parameters and initial feeds and holdups.
+	 * The structure of the unit is not changed, so that all pointers obtained in CreateStructure() stay valid. Results of simulation are not copied.
+	 * \param _other Unit to copy from.
+	 */
+	void CopyUserData(const CBaseUnit& _other);
+
 	////////////////////////////////////////////////////////////////////////////////
 	/// Basic unit information
 	///
@@ -670,7 +684,6 @@ public:
 	 */
 	CSolverUnitParameter* AddSolverAgglomeration(const std::string& _name, const std::string& _description);
 	/**
-	 * \private
 	 * \brief Adds a new PBM solver unit parameter to the unit.
 	 * \details Should be used in the CBaseUnit::CreateStructure() function.
 	 * Adds the possibility to choose one of the available PBM solvers of this type.
@@ -682,6 +695,16 @@ public:
 	 * \return Pointer to the added unit parameter.
 	 */
 	CSolverUnitParameter* AddSolverPBM(const std::string& _name, const std::string& _description);
+	/**
+	 * \brief Adds a new breakage solver unit parameter to the unit.
+	 * \details Should be used in the CBaseUnit::CreateStructure() function.
+	 * Adds the possibility to choose one of the available breakage solvers of this type.
+	 * The name of the parameter should be unique within the unit. If the unit already has a parameter with the same name, logic_error exception is thrown.
+	 * \param _name Name of the unit parameter.
+	 * \param _description Extended parameter description.
+	 * \return Pointer to the added unit parameter.
+	 */
+	CSolverUnitParameter* AddSolverBreakage(const std::string& _name, const std::string& _description);
 
 	/**
 	 * \brief Groups the specified unit parameters.
@@ -862,7 +885,6 @@ public:
 	 */
 	CAgglomerationSolver* GetSolverAgglomeration(const CSolverUnitParameter* _param) const;
 	/**
-	 * \private
 	 * \brief Returns value of the PBM solver unit parameter.
 	 * \details Throws logic_error exception if a unit parameter with the given name and type does not exist.
 	 * \param _name Name of the unit parameter.
@@ -870,13 +892,45 @@ public:
 	 */
 	CPBMSolver* GetSolverPBM(const std::string& _name) const;
 	/**
-	 * \private
 	 * \brief Returns value of the PBM solver unit parameter.
 	 * \details Throws logic_error exception if the provided pointer to the unit parameter is of the wrong type.
 	 * \param _param Pointer to the PBM solver unit parameter.
 	 * \return Pointer to the selected PBM solver.
 	 */
 	CPBMSolver* GetSolverPBM(const CSolverUnitParameter* _param) const;
+	/**
+	 * \brief Returns value of the breakage solver unit parameter.
+	 * \details Throws logic_error exception if a unit parameter with the given name and type does not exist.
+	 * \param _name Name of the unit parameter.
+	 * \return Pointer to the selected breakage solver.
+	 */
+	CBreakageSolver* GetSolverBreakage(const std::string& _name) const;
+	/**
+	 * \brief Returns value of the breakage solver unit parameter.
+	 * \details Throws logic_error exception if the provided pointer to the unit parameter is of the wrong type.
+	 * \param _param Pointer to the breakage solver unit parameter.
+	 * \return Pointer to the selected breakage solver.
+	 */
+	CBreakageSolver* GetSolverBreakage(const CSolverUnitParameter* _param) const;
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Equation solvers
+	//
+
+	/**
+	 * \brief Registers an equation solver to collect its statistics.
+	 * \details Statistics of all registered solvers are written to the simulation log at the end of the simulation and can be exported with the command line interface.
+	 * Returns a function, which must be passed to the solver with its function SetStatisticsHandler, so that the solver reports its statistics after each call.
+	 * Registering a solver with an already existing name replaces it.
+	 * \param _name Name of the solver.
+	 * \return Function receiving statistics of the solver.
+	 */
+	std::function<void(const SSolverStatistics&)> RegisterSolver(const std::string& _name);
+	/**
+	 * \brief Returns statistics of all registered equation solvers.
+	 * \return Names of solvers with their statistics.
+	 */
+	[[nodiscard]] std::vector<std::pair<std::string, SSolverStatistics>> GetSolversStatistics() const;
 
 	////////////////////////////////////////////////////////////////////////////////
 	// State variables
@@ -1530,6 +1584,12 @@ public:
 	 */
 	void UpdateCacheSettings();
 
+	/**
+	 * \private
+	 * Loads all data, which are loaded from file on demand, in all streams and releases the file.
+	 */
+	void DetachFromFile();
+
 	/**
 	 * \private
 	 * Updates thermodynamics settings in all streams.
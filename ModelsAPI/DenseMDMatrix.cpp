@@ -215,7 +215,7 @@ bool CDenseMDMatrix::SetValue(const std::vector<unsigned>& _vCoords, double _dVa
 bool CDenseMDMatrix::SetValue(const std::vector<unsigned>& _vDims, const std::vector<unsigned>& _vCoords, double _dValue)
 {
 	size_t index = GetIndex(_vDims, _vCoords);
-	if ((index == -1) || (index >= m_vData.size()))
+	if (index >= m_vData.size())
 		return false;
 	m_vData[index] = _dValue;
 	return true;
@@ -304,32 +304,23 @@ size_t CDenseMDMatrix::GetIndex(const std::vector<unsigned>& _vDims, const std::
 	if (_vDims.size() != _vCoords.size())		return -1; // wrong number of coordinates
 	if (_vDims.size() == 0)						return -1; // empty dimensions set
 
-	std::vector<unsigned> vSizes;
-	std::vector<unsigned> vCoords;
+	// the first dimension changes fastest in m_vData
+	size_t index = 0;
+	size_t stride = 1;
 	for (size_t i = 0; i < m_vDimensions.size(); ++i)
 	{
-		unsigned iDim;
+		size_t iDim;
 		for (iDim = 0; iDim < _vDims.size(); ++iDim)
 			if (m_vDimensions[i] == _vDims[iDim])
-			{
-				if (_vCoords[iDim] >= m_vClasses[i]) // wrong coordinate
-					return -1;
-				vSizes.push_back(m_vClasses[i]);
-				vCoords.push_back(_vCoords[iDim]);
 				break;
-			}
-		if (iDim == _vDims.size()) // dimension #i wasn't defined in _vDims
+		if (iDim == _vDims.size())				// dimension #i wasn't defined in _vDims
 			return -1;
+		if (_vCoords[iDim] >= m_vClasses[i])	// wrong coordinate
+			return -1;
+		index += _vCoords[iDim] * stride;
+		stride *= m_vClasses[i];
 	}
 
-	std::vector<unsigned>::reverse_iterator iterCoord = vCoords.rbegin();
-	std::vector<unsigned>::reverse_iterator iterSize = vSizes.rbegin();
-	unsigned index = *iterCoord;
-	++iterCoord;
-	++iterSize;
-	for (size_t i = 0; i < _vDims.size() - 1; ++i, ++iterSize, ++iterCoord)
-		index = index * *iterSize + *iterCoord;
-
 	return index;
 }
 
@@ -339,117 +330,120 @@ bool CDenseMDMatrix::GetIndexAndStep(const std::vector<unsigned>& _vDims, const
 	if (_vDims.size() != _vCoords.size() + 1)	return false; // wrong number of coordinates
 	if (_vDims.size() == 0)						return false; // empty dimensions set
 
-	std::vector<size_t> vSizes;
-	std::vector<size_t> vCoords;
+	// the first dimension changes fastest in m_vData; the vector is taken along the last dimension in _vDims
+	size_t index = 0;
+	size_t stride = 1;
 	size_t iVect = 0;
-	size_t nStep = 1;
-	bool bFlagOk = true;
 	for (size_t i = 0; i < m_vDimensions.size(); ++i)
 	{
-		unsigned iDim;
+		size_t iDim;
 		for (iDim = 0; iDim < _vDims.size(); ++iDim)
-		{
 			if (m_vDimensions[i] == _vDims[iDim])
-			{
-				vSizes.push_back(m_vClasses[i]);
-				if (iDim < _vCoords.size())
-				{
-					if (m_vClasses[i] <= _vCoords[iDim]) // wrong coordinate
-						return false;
-					vCoords.push_back(_vCoords[iDim]);
-				}
-				if (bFlagOk)
-				{
-					if (_vDims[iDim] != _vDims.back())
-						nStep *= m_vClasses[i];
-					else
-					{
-						bFlagOk = false;
-						iVect = i;
-					}
-				}
 				break;
-			}
-		}
-		if (iDim == _vDims.size())
+		if (iDim == _vDims.size())				// dimension #i wasn't defined in _vDims
 			return false;
+		if (iDim < _vCoords.size())
+		{
+			if (_vCoords[iDim] >= m_vClasses[i])	// wrong coordinate
+				return false;
+			index += _vCoords[iDim] * stride;
+		}
+		else
+		{
+			iVect = i;
+			*_pResStep = stride;
+		}
+		stride *= m_vClasses[i];
 	}
 
-	vCoords.insert(vCoords.begin() + iVect, 0);
-	std::vector<size_t>::reverse_iterator iterCoord = vCoords.rbegin();
-	std::vector<size_t>::reverse_iterator iterSize = vSizes.rbegin();
-	size_t index = *iterCoord;
-	++iterCoord;
-	++iterSize;
-	for (size_t i = 0; i < _vDims.size() - 1; ++i, ++iterSize, ++iterCoord)
-		index = index * *iterSize + *iterCoord;
-
 	*_pResIndex = index;
-	*_pResStep = nStep;
-	*_pResVecLength = vSizes.at(iVect);
+	*_pResVecLength = m_vClasses[iVect];
 	return true;
 }
 
-double CDenseMDMatrix::GetValueRecursive(std::vector<unsigned> _vDims, std::vector<unsigned> _vCoords) const
+double CDenseMDMatrix::GetValueRecursive(const std::vector<unsigned>& _vDims, const std::vector<unsigned>& _vCoords) const
 {
-	if (_vDims.size() < m_vDimensions.size() - 1) // add dimension and call GetValueRecursive for each class recursively
+	if (_vDims.size() == m_vDimensions.size()) // just return the value
+	{
+		size_t index = GetIndex(_vDims, _vCoords);
+		if (index < m_vData.size())
+			return m_vData[index];
+		return 0;
+	}
+
+	std::vector<unsigned> vDims = _vDims;
+	std::vector<unsigned> vCoords = _vCoords;
+	if (vDims.size() < m_vDimensions.size() - 1) // add dimension and call GetValueRecursive for each class recursively
 	{
 		size_t index = 0;
 		for (size_t i = 0; i < m_vDimensions.size(); ++i)
 		{
-			std::vector<unsigned>::iterator res = std::find(_vDims.begin(), _vDims.end(), m_vDimensions.at(i));
-			if (res == _vDims.end())
+			std::vector<unsigned>::iterator res = std::find(vDims.begin(), vDims.end(), m_vDimensions.at(i));
+			if (res == vDims.end())
 			{
-				_vDims.push_back(m_vDimensions[i]);
+				vDims.push_back(m_vDimensions[i]);
 				index = i;
 				break;
 			}
 		}
 		double dRes = 0;
-		_vCoords.push_back(0);
+		vCoords.push_back(0);
 		for (unsigned i = 0; i < m_vClasses[index]; ++i)
 		{
-			dRes += GetValueRecursive(_vDims, _vCoords);
-			_vCoords.back()++;
+			dRes += GetValueRecursive(vDims, vCoords);
+			vCoords.back()++;
 		}
 		return dRes;
 	}
-	else if (_vDims.size() == m_vDimensions.size() - 1) // add dim and return sum of the vector
+	else if (vDims.size() == m_vDimensions.size() - 1) // add dim and return sum of the vector
 	{
 		for (size_t i = 0; i < m_vDimensions.size(); ++i)
 		{
-			std::vector<unsigned>::iterator res = std::find(_vDims.begin(), _vDims.end(), m_vDimensions[i]);
-			if (res == _vDims.end())
+			std::vector<unsigned>::iterator res = std::find(vDims.begin(), vDims.end(), m_vDimensions[i]);
+			if (res == vDims.end())
 			{
-				_vDims.push_back(m_vDimensions[i]);
+				vDims.push_back(m_vDimensions[i]);
 				break;
 			}
 		}
 		std::vector<double> vRes;
-		if (!GetVectorValue(_vDims, _vCoords, vRes))
+		if (!GetVectorValue(vDims, vCoords, vRes))
 			return 0;
 		double dRes = 0;
 		for (size_t i = 0; i < vRes.size(); ++i)
 			dRes += vRes[i];
 		return dRes;
 	}
-	else if (_vDims.size() == m_vDimensions.size()) // just return the value
-	{
-		size_t index = GetIndex(_vDims, _vCoords);
-		if ((index != -1) && (index < m_vData.size()))
-			return m_vData[index];
-	}
 	return 0;
 }
 
-bool CDenseMDMatrix::GetVectorValueRecursive(std::vector<unsigned> _vDims, std::vector<unsigned> _vCoords, std::vector<double>& _pResult) const
+bool CDenseMDMatrix::GetVectorValueRecursive(const std::vector<unsigned>& _vDims, const std::vector<unsigned>& _vCoords, std::vector<double>& _pResult) const
 {
-	if( _vDims.size() < m_vDimensions.size() ) // add dimension and call GetVectorValueRecursive for each class recursively
+	if( _vDims.size() == m_vDimensions.size() ) // just return the vector value
+	{
+		size_t index;
+		size_t nStep;
+		size_t nVecLength;
+		if( !GetIndexAndStep( _vDims, _vCoords, &index, &nStep, &nVecLength ) )
+			return false;
+		_pResult.resize( nVecLength );
+		for (size_t i = 0; i < nVecLength; ++i)
+			if( index < m_vData.size() )
+			{
+				_pResult[i] = m_vData[index];
+				index += nStep;
+			}
+		return true;
+	}
+
+	std::vector<unsigned> vDims = _vDims;
+	std::vector<unsigned> vCoords = _vCoords;
+	if( vDims.size() < m_vDimensions.size() ) // add dimension and call GetVectorValueRecursive for each class recursively
 	{
-		// find index of dimension that corresponds to a last element of _vDims
+		// find index of dimension that corresponds to a last element of vDims
 		size_t index = 0;
 		for(size_t i=0; i<m_vDimensions.size(); ++i )
-			if( m_vDimensions[i] == _vDims.back() )
+			if( m_vDimensions[i] == vDims.back() )
 			{
 				index = i;
 				break;
@@ -457,42 +451,26 @@ bool CDenseMDMatrix::GetVectorValueRecursive(std::vector<unsigned> _vDims, std::
 
 		for(size_t i=0; i<m_vDimensions.size(); ++i )
 		{
-			std::vector<unsigned>::iterator res = std::find( _vDims.begin(), _vDims.end(), m_vDimensions[i] );
-			if( res == _vDims.end() )
+			std::vector<unsigned>::iterator res = std::find( vDims.begin(), vDims.end(), m_vDimensions[i] );
+			if( res == vDims.end() )
 			{
-				_vDims.push_back( m_vDimensions[i] );
+				vDims.push_back( m_vDimensions[i] );
 				break;
 			}
 		}
-		_vCoords.push_back( 0 );
+		vCoords.push_back( 0 );
 		_pResult.clear();
 		for(size_t i=0; i<m_vClasses[index]; ++i )
 		{
 			std::vector<double> vTemp;
 			_pResult.push_back( 0 );
-			if( GetVectorValueRecursive( _vDims, _vCoords, vTemp ) )
+			if( GetVectorValueRecursive( vDims, vCoords, vTemp ) )
 				for(size_t j=0; j<vTemp.size(); ++j )
 					_pResult.back() += vTemp[j];
-			_vCoords.back()++;
+			vCoords.back()++;
 		}
 		return true;
 	}
-	else if( _vDims.size() == m_vDimensions.size() ) // just return the vector value
-	{
-		size_t index;
-		size_t nStep;
-		size_t nVecLength;
-		if( !GetIndexAndStep( _vDims, _vCoords, &index, &nStep, &nVecLength ) )
-			return false;
-		_pResult.resize( nVecLength );
-		for (size_t i = 0; i < nVecLength; ++i)
-			if( index < m_vData.size() )
-			{
-				_pResult[i] = m_vData[index];
-				index += nStep;
-			}
-		return true;
-	}
 	return false;
 }
 
@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include "DenseMDView.h"
+#include <algorithm>
+#include <array>
 #include <vector>
 #include <cstddef>
 
@@ -323,6 +326,51 @@ public:
 	bool SetVectorValue( const std::vector<unsigned>& _vDims, const std::vector<unsigned>& _vCoords, const std::vector<double>& _vValue );
 
 
+	// ============= Views
+
+	/**
+	 * \brief Returns a view with direct access to the data of the matrix.
+	 * \details Dimensions of the view follow the order of dimensions in the matrix.
+	 * If \p N is not equal to the number of dimensions of the matrix, an empty view is returned.
+	 * The view becomes invalid if dimensions of the matrix are changed.
+	 * \tparam N Number of dimensions.
+	 * \return View of the matrix.
+	 */
+	template<size_t N>
+	CDenseMDView<double, N> GetView();
+	/**
+	 * \brief Returns a read-only view with direct access to the data of the matrix.
+	 * \details Dimensions of the view follow the order of dimensions in the matrix.
+	 * If \p N is not equal to the number of dimensions of the matrix, an empty view is returned.
+	 * The view becomes invalid if dimensions of the matrix are changed.
+	 * \tparam N Number of dimensions.
+	 * \return View of the matrix.
+	 */
+	template<size_t N>
+	CDenseMDView<const double, N> GetView() const;
+	/**
+	 * \brief Returns a view with direct access to the data of the matrix with the given order of dimensions.
+	 * \details Types are types of the #EDistrTypes. All dimensions of the matrix must be listed.
+	 * If the dimensions do not correspond to the dimensions of the matrix, an empty view is returned.
+	 * The view becomes invalid if dimensions of the matrix are changed.
+	 * \tparam N Number of dimensions.
+	 * \param _dims Order of dimensions in the view.
+	 * \return View of the matrix.
+	 */
+	template<size_t N>
+	CDenseMDView<double, N> GetView(const std::array<unsigned, N>& _dims);
+	/**
+	 * \brief Returns a read-only view with direct access to the data of the matrix with the given order of dimensions.
+	 * \details Types are types of the #EDistrTypes. All dimensions of the matrix must be listed.
+	 * If the dimensions do not correspond to the dimensions of the matrix, an empty view is returned.
+	 * The view becomes invalid if dimensions of the matrix are changed.
+	 * \tparam N Number of dimensions.
+	 * \param _dims Order of dimensions in the view.
+	 * \return View of the matrix.
+	 */
+	template<size_t N>
+	CDenseMDView<const double, N> GetView(const std::array<unsigned, N>& _dims) const;
+
 	// ========== Normalization
 
 	/**
@@ -359,6 +407,13 @@ public:
 
 
 private:
+	/** Creates a view of _data with dimensions in the order given in _dims. Returns an empty view if _dims do not correspond to the dimensions of the matrix.*/
+	template<typename T, size_t N>
+	CDenseMDView<T, N> MakeView(T* _data, const std::array<unsigned, N>& _dims) const;
+	/** Returns dimensions of the matrix as an array if their number equals to N.*/
+	template<size_t N>
+	std::array<unsigned, N> DimensionsArray() const;
+
 	/** Checks the duplicates in dimensions vector. Return true if check is passed.*/
 	bool CheckDuplicates( const std::vector<unsigned>& _vDims ) const;
 
@@ -371,8 +426,67 @@ private:
 
 	/** Returns value by specified dimension and coordinate. Doesn't check sizes of dimensions and coordinates in parameters.
 	*	Returns 0 if there is no such combination of dimensions and coordinates.*/
-	double GetValueRecursive( std::vector<unsigned> _vDims, std::vector<unsigned> _vCoords ) const;
+	double GetValueRecursive( const std::vector<unsigned>& _vDims, const std::vector<unsigned>& _vCoords ) const;
 	/** Returns vector value by specified dimension and coordinate. Doesn't check sizes of dimensions and coordinates in parameters.
 	*	Returns false if there is no such combination of dimensions and coordinates.*/
-	bool GetVectorValueRecursive( std::vector<unsigned> _vDims, std::vector<unsigned> _vCoords, std::vector<double>& _pResult ) const;
+	bool GetVectorValueRecursive( const std::vector<unsigned>& _vDims, const std::vector<unsigned>& _vCoords, std::vector<double>& _pResult ) const;
 };
+
+template<size_t N>
+CDenseMDView<double, N> CDenseMDMatrix::GetView()
+{
+	return MakeView(m_vData.data(), DimensionsArray<N>());
+}
+
+template<size_t N>
+CDenseMDView<const double, N> CDenseMDMatrix::GetView() const
+{
+	return MakeView(m_vData.data(), DimensionsArray<N>());
+}
+
+template<size_t N>
+CDenseMDView<double, N> CDenseMDMatrix::GetView(const std::array<unsigned, N>& _dims)
+{
+	return MakeView(m_vData.data(), _dims);
+}
+
+template<size_t N>
+CDenseMDView<const double, N> CDenseMDMatrix::GetView(const std::array<unsigned, N>& _dims) const
+{
+	return MakeView(m_vData.data(), _dims);
+}
+
+template<typename T, size_t N>
+CDenseMDView<T, N> CDenseMDMatrix::MakeView(T* _data, const std::array<unsigned, N>& _dims) const
+{
+	if (m_vDimensions.size() != N) return {};
+
+	// the first dimension of the matrix changes fastest in the data
+	std::array<size_t, N> extents{};
+	std::array<size_t, N> strides{};
+	std::array<bool, N> used{};
+	for (size_t i = 0; i < N; ++i)
+	{
+		size_t stride = 1;
+		size_t j = 0;
+		for (; j < N; ++j)
+		{
+			if (m_vDimensions[j] == _dims[i]) break;
+			stride *= m_vClasses[j];
+		}
+		if (j == N || used[j]) return {}; // unknown or duplicated dimension
+		used[j] = true;
+		extents[i] = m_vClasses[j];
+		strides[i] = stride;
+	}
+	return CDenseMDView<T, N>{ _data, _dims, extents, strides };
+}
+
+template<size_t N>
+std::array<unsigned, N> CDenseMDMatrix::DimensionsArray() const
+{
+	std::array<unsigned, N> res{};
+	if (m_vDimensions.size() == N)
+		std::copy(m_vDimensions.begin(), m_vDimensions.end(), res.begin());
+	return res;
+}
@@ -0,0 +1,161 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * \brief Non-owning view of multidimensional data with the number of dimensions known at compile time.
+ * \details Provides access to the elements of a CDenseMDMatrix without any heap allocations:
+ * element and slice access is reduced to index arithmetic on a pointer using the strides of each dimension.
+ * The view is valid as long as the matrix it was obtained from exists and its dimensions are not changed.
+ * Use the \p T = \p const \p double to get a read-only view.
+ * \tparam T Type of elements, \p double or \p const \p double.
+ * \tparam N Number of dimensions, from 1 to 4.
+ */
+template<typename T, size_t N>
+class CDenseMDView
+{
+	static_assert(N >= 1 && N <= 4, "CDenseMDView supports from 1 to 4 dimensions");
+
+	template<typename, size_t> friend class CDenseMDView;
+
+	T* m_data{ nullptr };					///< Pointer to the first element.
+	std::array<unsigned, N> m_dims{};		///< Types of the distributions.
+	std::array<size_t, N> m_extents{};		///< Number of classes in each dimension.
+	std::array<size_t, N> m_strides{};		///< Offset between neighboring elements in each dimension.
+
+public:
+	/**
+	 * \brief Creates an empty view.
+	 */
+	CDenseMDView() = default;
+	/**
+	 * \brief Creates a view of the data with the given dimensions, extents and strides.
+	 * \param _data Pointer to the first element.
+	 * \param _dims Types of the distributions.
+	 * \param _extents Number of classes in each dimension.
+	 * \param _strides Offset between neighboring elements in each dimension.
+	 */
+	CDenseMDView(T* _data, const std::array<unsigned, N>& _dims, const std::array<size_t, N>& _extents, const std::array<size_t, N>& _strides)
+		: m_data{ _data }
+		, m_dims{ _dims }
+		, m_extents{ _extents }
+		, m_strides{ _strides }
+	{
+	}
+	/**
+	 * \brief Creates a read-only view from a writable one.
+	 * \param _other Writable view.
+	 */
+	template<typename U, std::enable_if_t<std::is_same_v<const U, T> && !std::is_same_v<U, T>, int> = 0>
+	CDenseMDView(const CDenseMDView<U, N>& _other)
+		: m_data{ _other.m_data }
+		, m_dims{ _other.m_dims }
+		, m_extents{ _other.m_extents }
+		, m_strides{ _other.m_strides }
+	{
+	}
+
+	/**
+	 * \brief Returns the number of dimensions.
+	 * \return Number of dimensions.
+	 */
+	static constexpr size_t Rank() { return N; }
+	/**
+	 * \brief Checks whether the view refers to any data.
+	 * \return Whether the view is empty.
+	 */
+	[[nodiscard]] bool Empty() const { return m_data == nullptr; }
+	/**
+	 * \brief Returns the type of the distribution of the given dimension.
+	 * \param _i Index of the dimension.
+	 * \return Type of the distribution.
+	 */
+	[[nodiscard]] unsigned Dimension(size_t _i) const { return m_dims[_i]; }
+	/**
+	 * \brief Returns the number of classes in the given dimension.
+	 * \param _i Index of the dimension.
+	 * \return Number of classes.
+	 */
+	[[nodiscard]] size_t Extent(size_t _i) const { return m_extents[_i]; }
+	/**
+	 * \brief Returns the offset between neighboring elements of the given dimension in the underlying data.
+	 * \param _i Index of the dimension.
+	 * \return Stride of the dimension.
+	 */
+	[[nodiscard]] size_t Stride(size_t _i) const { return m_strides[_i]; }
+	/**
+	 * \brief Returns the total number of elements in the view.
+	 * \return Number of elements.
+	 */
+	[[nodiscard]] size_t Size() const
+	{
+		if (!m_data) return 0;
+		size_t res = 1;
+		for (const auto e : m_extents) res *= e;
+		return res;
+	}
+	/**
+	 * \brief Returns the pointer to the element with all coordinates equal to zero.
+	 * \return Pointer to data.
+	 */
+	[[nodiscard]] T* Data() const { return m_data; }
+
+	/**
+	 * \brief Returns the element with the given coordinates.
+	 * \details Coordinates are given in the order of dimensions of the view. They are not checked.
+	 * \param _coords Coordinates, one per dimension.
+	 * \return Reference to the element.
+	 */
+	template<typename... I, std::enable_if_t<sizeof...(I) == N && (std::is_integral_v<I> && ...), int> = 0>
+	T& operator()(I... _coords) const
+	{
+		const std::array<size_t, N> coords{ static_cast<size_t>(_coords)... };
+		size_t offset = 0;
+		for (size_t i = 0; i < N; ++i)
+			offset += coords[i] * m_strides[i];
+		return m_data[offset];
+	}
+	/**
+	 * \brief Returns the element with the given coordinates.
+	 * \details Coordinates are given in the order of dimensions of the view. They are not checked.
+	 * \param _coords Coordinates.
+	 * \return Reference to the element.
+	 */
+	T& operator[](const std::array<size_t, N>& _coords) const
+	{
+		size_t offset = 0;
+		for (size_t i = 0; i < N; ++i)
+			offset += _coords[i] * m_strides[i];
+		return m_data[offset];
+	}
+
+	/**
+	 * \brief Returns a view with one dimension less, obtained by fixing the coordinate of the given dimension.
+	 * \details The coordinate is not checked.
+	 * \tparam D Index of the dimension to fix.
+	 * \param _coord Coordinate in the fixed dimension.
+	 * \return View of the slice.
+	 */
+	template<size_t D>
+	[[nodiscard]] CDenseMDView<T, N - 1> Slice(size_t _coord) const
+	{
+		static_assert(N > 1 && D < N, "Wrong dimension of the slice");
+		std::array<unsigned, N - 1> dims{};
+		std::array<size_t, N - 1> extents{};
+		std::array<size_t, N - 1> strides{};
+		for (size_t i = 0, j = 0; i < N; ++i)
+		{
+			if (i == D) continue;
+			dims[j] = m_dims[i];
+			extents[j] = m_extents[i];
+			strides[j] = m_strides[i];
+			++j;
+		}
+		return CDenseMDView<T, N - 1>{ m_data + _coord * m_strides[D], dims, extents, strides };
+	}
+};
@@ -5,7 +5,15 @@
 #include "DyssolStringConstants.h"
 #include "H5Handler.h"
 
+#include <algorithm>
 #include <cmath>
+#include <mutex>
+
+namespace
+{
+	// access to files with data loaded on demand is serialized, since they may be shared between matrices
+	std::mutex sourceMutex;
+}
 
 CMDMatrix::CMDMatrix(const CMDMatrix& _other) :
 	m_vDimensions{ _other.m_vDimensions },
@@ -16,7 +24,7 @@ CMDMatrix::CMDMatrix(const CMDMatrix& _other) :
 	m_nCacheWindow{ _other.m_nCacheWindow }
 {
 	SetCachePath(_other.m_sCachePath);
-	SetCacheParams(_other.m_bCacheEnabled, _other.m_nCacheWindow);
+	SetCacheParams(_other.m_bCacheEnabled || _other.m_bCacheSuspended, _other.m_nCacheWindow);
 	if (!_other.m_vTimePoints.empty())
 	{
 		CopyFrom(_other, _other.m_vTimePoints.front(), _other.m_vTimePoints.back());
@@ -39,6 +47,7 @@ void CMDMatrix::Clear()
 
 void CMDMatrix::AddDimension(unsigned _nDim, unsigned _nClasses)
 {
+	MarkModified();
 	for( unsigned i=0; i<m_vDimensions.size(); ++i )
 		if( m_vDimensions[i] == _nDim ) // dimension already exists
 			return;
@@ -56,6 +65,7 @@ void CMDMatrix::AddDimension(unsigned _nDim, unsigned _nClasses)
 
 void CMDMatrix::DeleteDimension(unsigned _nDim)
 {
+	MarkModified();
 	std::vector<unsigned> vDims;
 	vDims.push_back( _nDim );
 	DeleteDimensions( vDims );
@@ -63,6 +73,7 @@ void CMDMatrix::DeleteDimension(unsigned _nDim)
 
 void CMDMatrix::DeleteDimensions(const std::vector<unsigned>& _vDims)
 {
+	MarkModified();
 	std::vector<unsigned> vDimsToKeep;
 	std::vector<unsigned> vClassesToKeep;
 	m_pSortMatr = new CMDMatrix();
@@ -87,6 +98,7 @@ std::vector<unsigned> CMDMatrix::GetClasses() const
 
 void CMDMatrix::SetDimension(unsigned _nDim, unsigned _nClasses)
 {
+	MarkModified();
 	if( !m_vDimensions.empty() )
 		Clear();
 	m_vDimensions.push_back( _nDim );
@@ -95,6 +107,7 @@ void CMDMatrix::SetDimension(unsigned _nDim, unsigned _nClasses)
 
 void CMDMatrix::SetDimensions(const std::vector<unsigned>& _vDims, const std::vector<unsigned>& _vClasses)
 {
+	MarkModified();
 	if( _vDims.size() != _vClasses.size() ) // wrong input data
 		return;
 
@@ -142,6 +155,7 @@ unsigned CMDMatrix::GetDimensionSizeByType(unsigned _nDim) const
 
 void CMDMatrix::UpdateDimensions(const std::vector<unsigned>& _vDims, const std::vector<unsigned>& _vClasses)
 {
+	MarkModified();
 	if( _vDims.size() != _vClasses.size() )
 		return;
 
@@ -278,6 +292,7 @@ void CMDMatrix::UpdateDimensions(const std::vector<unsigned>& _vDims, const std:
 
 void CMDMatrix::AddClass(unsigned _nDim)
 {
+	MarkModified();
 	for( unsigned i=0; i<m_vDimensions.size(); ++i )
 	{
 		if( m_vDimensions[i] == _nDim )
@@ -295,6 +310,7 @@ void CMDMatrix::AddClass(unsigned _nDim)
 
 void CMDMatrix::RemoveClass(unsigned _nDim, size_t _nClassIndex)
 {
+	MarkModified();
 	const size_t iDim = VectorFind(m_vDimensions, _nDim);
 	if (iDim == static_cast<size_t>(-1)) return;
 	if (_nClassIndex >= m_vClasses[iDim]) return;
@@ -327,6 +343,7 @@ bool CMDMatrix::CompareDims(const CMDMatrix& _matr) const
 
 void CMDMatrix::AddTimePoint(double _dTime, double _dSrcTimePoint /*= -1 */)
 {
+	MarkModified(_dTime);
 	unsigned index = GetTimeIndex( _dTime, false ); // get new index to insert
 	if( (unsigned)index < m_vTimePoints.size() )
 		if( m_vTimePoints[index] == _dTime ) // time point already exists
@@ -369,6 +386,7 @@ void CMDMatrix::ChangeTimePoint(unsigned _nTimePointIndex, double _dNewTime)
 	}
 
 	m_dTempT1 = GetTimeForIndex( _nTimePointIndex );
+	MarkModified(std::min(m_dTempT1, _dNewTime));
 	UnCacheData(m_dTempT1);
 	if( _dNewTime < m_dCurrWinStart )
 		UnCacheData( _dNewTime, m_dCurrWinStart );
@@ -387,6 +405,7 @@ void CMDMatrix::ChangeTimePoint(unsigned _nTimePointIndex, double _dNewTime)
 
 void CMDMatrix::RemoveTimePoint(double _dTime)
 {
+	MarkModified(_dTime);
 	unsigned index = GetTimeIndex( _dTime );
 	if( index == -1 ) // no such time point
 		return;
@@ -407,6 +426,7 @@ void CMDMatrix::RemoveTimePoint(double _dTime)
 
 void CMDMatrix::RemoveTimePoints(double _dStart, double _dEnd, bool _inclusive/* = true*/)
 {
+	MarkModified(_dStart);
 	if( _dStart > _dEnd ) // wrong interval
 		return;
 
@@ -450,6 +470,7 @@ void CMDMatrix::RemoveTimePoints(double _dStart, double _dEnd, bool _inclusive/*
 
 void CMDMatrix::RemoveTimePointsAfter(double _dTime, bool _bIncludeTime /*= false */)
 {
+	MarkModified(_dTime);
 	if( m_vTimePoints.empty() ) // nothing to remove
 		return;
 
@@ -473,6 +494,7 @@ void CMDMatrix::RemoveTimePointsAfter(double _dTime, bool _bIncludeTime /*= fals
 
 void CMDMatrix::RemoveAllTimePoints()
 {
+	MarkModified();
 	if( !m_vTimePoints.empty() )
 	{
 		m_dTempT1 = m_vTimePoints.front();
@@ -483,6 +505,7 @@ void CMDMatrix::RemoveAllTimePoints()
 
 	m_data = RemoveFractionsRecursive( m_data );
 	ClearCache();
+	ReleaseSource();
 }
 
 std::vector<double> CMDMatrix::GetTimePoints(double _dStart, double _dEnd) const
@@ -607,6 +630,7 @@ double CMDMatrix::GetValue(double _dTime, const std::vector<unsigned>& _vDims, c
 
 bool CMDMatrix::SetValue(unsigned _nTimeIndex, unsigned _nDim, unsigned _nCoord, double _dValue, bool _bExternal /*= true*/)
 {
+	MarkModified(GetTimeForIndex(_nTimeIndex));
 	if( _nTimeIndex >= m_vTimePoints.size() )
 		return false;
 
@@ -619,6 +643,7 @@ bool CMDMatrix::SetValue(unsigned _nTimeIndex, unsigned _nDim, unsigned _nCoord,
 
 bool CMDMatrix::SetValue(double _dTime, unsigned _nDim, unsigned _nCoord, double _dValue, bool _bExternal /*= true*/)
 {
+	MarkModified(_dTime);
 	std::vector<unsigned> vDims(1);
 	vDims[0] = _nDim;
 	std::vector<unsigned> vCoords(1);
@@ -628,6 +653,7 @@ bool CMDMatrix::SetValue(double _dTime, unsigned _nDim, unsigned _nCoord, double
 
 bool CMDMatrix::SetValue(double _dTime, unsigned _nDim1, unsigned _nCoord1, unsigned _nDim2, unsigned _nCoord2, double _dValue, bool _bExternal /*= true*/)
 {
+	MarkModified(_dTime);
 	std::vector<unsigned> vDims(2);
 	vDims[0] = _nDim1;
 	vDims[1] = _nDim2;
@@ -639,6 +665,7 @@ bool CMDMatrix::SetValue(double _dTime, unsigned _nDim1, unsigned _nCoord1, unsi
 
 bool CMDMatrix::SetValue(double _dTime, unsigned _nDim1, unsigned _nCoord1, unsigned _nDim2, unsigned _nCoord2, unsigned _nDim3, unsigned _nCoord3, double _dValue, bool _bExternal /*= true*/)
 {
+	MarkModified(_dTime);
 	std::vector<unsigned> vDims(3);
 	vDims[0] = _nDim1;
 	vDims[1] = _nDim2;
@@ -652,11 +679,13 @@ bool CMDMatrix::SetValue(double _dTime, unsigned _nDim1, unsigned _nCoord1, unsi
 
 bool CMDMatrix::SetValue( double _dTime, const std::vector<unsigned>& _vCoords, double _dValue, bool _bExternal /*= true*/ )
 {
+	MarkModified(_dTime);
 	return SetValue( _dTime, m_vDimensions, _vCoords, _dValue, _bExternal );
 }
 
 bool CMDMatrix::SetValue(double _dTime, const std::vector<unsigned>& _vDims, const std::vector<unsigned>& _vCoords, double _dValue, bool _bExternal /*= true*/)
 {
+	MarkModified(_dTime);
 	//int index;
 	if( /* ( index = */ GetTimeIndex( _dTime ) /* ) */ == -1 ) // time point doesn't exist
 		return false;
@@ -879,6 +908,7 @@ std::vector<double> CMDMatrix::GetValues(unsigned _nDim, unsigned _nCoord) const
 
 bool CMDMatrix::SetVectorValue(unsigned _nTimeIndex, unsigned _nDim, const std::vector<double>& _vValue, bool _bExternal /*= false*/ )
 {
+	MarkModified(GetTimeForIndex(_nTimeIndex));
 	if( _nTimeIndex >= m_vTimePoints.size() )
 		return false;
 
@@ -890,6 +920,7 @@ bool CMDMatrix::SetVectorValue(unsigned _nTimeIndex, unsigned _nDim, const std::
 
 bool CMDMatrix::SetVectorValue(double _dTime, unsigned _nDim, const std::vector<double>& _vValue, bool _bExternal /*= false*/ )
 {
+	MarkModified(_dTime);
 	std::vector<unsigned> vDims(1);
 	vDims[0] = _nDim;
 	std::vector<unsigned> vCoords;
@@ -898,6 +929,7 @@ bool CMDMatrix::SetVectorValue(double _dTime, unsigned _nDim, const std::vector<
 
 bool CMDMatrix::SetVectorValue(double _dTime, unsigned _nDim1, unsigned _nCoord1, unsigned _nDim2, const std::vector<double>& _vValue, bool _bExternal /*= false*/ )
 {
+	MarkModified(_dTime);
 	std::vector<unsigned> vDims(2);
 	vDims[0] = _nDim1;
 	vDims[1] = _nDim2;
@@ -908,6 +940,7 @@ bool CMDMatrix::SetVectorValue(double _dTime, unsigned _nDim1, unsigned _nCoord1
 
 bool CMDMatrix::SetVectorValue(double _dTime, const std::vector<unsigned>& _vDims, const std::vector<unsigned>& _vCoords, const std::vector<double>& _vValue, bool _bExternal /*= false*/ )
 {
+	MarkModified(_dTime);
 	if( m_vTimePoints.empty() )
 		return false;
 
@@ -1091,6 +1124,7 @@ std::vector<std::vector<double>> CMDMatrix::GetMatrixValue(double _dTime, const
 
 bool CMDMatrix::SetMatrixValue(double _dTime, const std::vector<unsigned>& _vDims, const std::vector<unsigned>& _vCoords, const std::vector<std::vector<double>>& _vValue)
 {
+	MarkModified(_dTime);
 	if( m_vTimePoints.empty() )
 		return false;
 
@@ -1427,6 +1461,7 @@ CDenseMDMatrix CMDMatrix::GetDistribution(double _dTime, const std::vector<unsig
 
 bool CMDMatrix::SetDistribution(double _dTime, unsigned _nDim, const std::vector<double>& _vDistr)
 {
+	MarkModified(_dTime);
 	if(GetTimeIndex( _dTime ) == -1) // time point doesn't exist
 		return false;
 
@@ -1447,6 +1482,7 @@ bool CMDMatrix::SetDistribution(double _dTime, unsigned _nDim, const std::vector
 
 bool CMDMatrix::SetDistribution(double _dTime, unsigned _nDim1, unsigned _nDim2, const CMatrix2D& _Distr)
 {
+	MarkModified(_dTime);
 	//int index;
 	if( /* ( index =  */GetTimeIndex( _dTime ) /* ) */ == -1 ) // time point doesn't exist
 		return false;
@@ -1509,6 +1545,7 @@ bool CMDMatrix::SetDistribution(double _dTime, unsigned _nDim1, unsigned _nDim2,
 
 bool CMDMatrix::SetDistribution(double _dTime, const CDenseMDMatrix& _Distr)
 {
+	MarkModified(_dTime);
 	//int index;
 	if( /* ( index = */ GetTimeIndex( _dTime ) /* ) */ == -1 ) // time point doesn't exist
 		return false;
@@ -1557,6 +1594,7 @@ bool CMDMatrix::SetDistribution(double _dTime, const CDenseMDMatrix& _Distr)
 
 bool CMDMatrix::Transform(double _dTime, const CTransformMatrix& _TMatrix)
 {
+	MarkModified(_dTime);
 	std::vector<unsigned> vTDims = _TMatrix.GetDimensions();
 	std::vector<unsigned> vTClasses = _TMatrix.GetClasses();
 	std::vector<unsigned> vNewDims;
@@ -1715,6 +1753,7 @@ bool CMDMatrix::Transform(double _dTime, const CTransformMatrix& _TMatrix)
 
 void CMDMatrix::NormalizeMatrix(double _dTime)
 {
+	MarkModified(_dTime);
 	unsigned index = GetTimeIndex( _dTime );
 	if( index != -1 )
 	{
@@ -1729,6 +1768,7 @@ void CMDMatrix::NormalizeMatrix(double _dTime)
 
 void CMDMatrix::NormalizeMatrix(double _dStart, double _dEnd)
 {
+	MarkModified(_dStart);
 	if( m_vTimePoints.size() == 0 ) // nothing to normalize
 		return;
 
@@ -1753,6 +1793,7 @@ void CMDMatrix::NormalizeMatrix(double _dStart, double _dEnd)
 
 void CMDMatrix::NormalizeMatrix()
 {
+	MarkModified();
 	m_vTempValues = m_vTimePoints;
 	if( !m_vTimePoints.empty() )
 		UnCacheData(m_vTimePoints.front(),m_vTimePoints.back());
@@ -1792,11 +1833,13 @@ bool CMDMatrix::IsNormalized(double _dTime)
 
 bool CMDMatrix::CopyFrom(const CMDMatrix& _Source, double _dTime)
 {
+	MarkModified(_dTime);
 	return CopyFrom( _Source, _dTime, _dTime );
 }
 
 bool CMDMatrix::CopyFrom(const CMDMatrix& _Source, double _dStart, double _dEnd)
 {
+	MarkModified(_dStart);
 	if( !CompareDims( _Source ) )
 		return false;
 
@@ -1828,6 +1871,7 @@ bool CMDMatrix::CopyFrom(const CMDMatrix& _Source, double _dStart, double _dEnd)
 
 bool CMDMatrix::CopyFromTimePoint(const CMDMatrix& _Source, double _dTimeSrc, double _dTimeDest)
 {
+	MarkModified(_dTimeDest);
 	if( !CompareDims( _Source ) )
 		return false;
 
@@ -1886,8 +1930,17 @@ void CMDMatrix::SaveToFile(CH5Handler& _h5File, const std::string& _sPath) const
 	/// save classes
 	_h5File.WriteData(_sPath, StrConst::MDM_H5Classes, m_vClasses);
 
+	/// number of time points that are already stored in the file and not modified since then
+	size_t nUnchanged = 0;
+	size_t nStored = 0;
+	if (_h5File.IsAppending())
+	{
+		nStored = _h5File.ReadSize(_sPath, StrConst::MDM_H5TimePoints);
+		nUnchanged = std::min(static_cast<size_t>(std::lower_bound(m_vTimePoints.begin(), m_vTimePoints.end(), m_dModifiedFrom) - m_vTimePoints.begin()), nStored);
+	}
+
 	/// save time points
-	_h5File.WriteData(_sPath, StrConst::MDM_H5TimePoints, m_vTimePoints);
+	_h5File.WriteExtendible(_sPath, StrConst::MDM_H5TimePoints, m_vTimePoints, nUnchanged);
 
 	/// calculate total length of 1d array to store one matrix
 	size_t cnt = 0, mul = 1;
@@ -1898,15 +1951,21 @@ void CMDMatrix::SaveToFile(CH5Handler& _h5File, const std::string& _sPath) const
 	}
 	std::vector<std::vector<double>> vvBufData(cnt);
 
-	/// save multidimensional data
+	/// save multidimensional data, skipping unchanged blocks
 	unsigned iCnt;
 	unsigned nBlocksNum = static_cast<unsigned>(m_vTimePoints.size() / DATA_SAVE_BLOCK);
-	for (iCnt = 0; iCnt < nBlocksNum; ++iCnt)
+	for (iCnt = static_cast<unsigned>(nUnchanged / DATA_SAVE_BLOCK); iCnt < nBlocksNum; ++iCnt)
 		SaveMDBlockToFile(_h5File, _sPath, iCnt * DATA_SAVE_BLOCK, iCnt * DATA_SAVE_BLOCK + DATA_SAVE_BLOCK - 1, vvBufData);
 	unsigned nModulo = m_vTimePoints.size() % DATA_SAVE_BLOCK;
 	if (nModulo != 0)
 		SaveMDBlockToFile(_h5File, _sPath, iCnt * DATA_SAVE_BLOCK, iCnt * DATA_SAVE_BLOCK + nModulo - 1, vvBufData);
 
+	/// remove blocks that are not needed anymore
+	const size_t nBlocksTotal = (m_vTimePoints.size() + DATA_SAVE_BLOCK - 1) / DATA_SAVE_BLOCK;
+	for (size_t i = nBlocksTotal; i < (nStored + DATA_SAVE_BLOCK - 1) / DATA_SAVE_BLOCK; ++i)
+		_h5File.RemoveData(_sPath, StrConst::MDM_H5Data + std::to_string(i));
+
+	m_dModifiedFrom = std::numeric_limits<double>::max();
 	CheckCacheNeed();
 }
 
@@ -1940,6 +1999,23 @@ void CMDMatrix::LoadFromFile(const CH5Handler& _h5File, const std::string& _sPat
 	/// load time points
 	_h5File.ReadData(_sPath, StrConst::MDM_H5TimePoints, m_vTimePoints);
 
+	/// keep the file to load data later on demand
+	if (_h5File.IsLazyLoading() && !m_vTimePoints.empty())
+	{
+		m_pSource = _h5File.Share();
+		if (m_pSource)
+		{
+			m_sSourcePath = _sPath;
+			m_vSourceTimePoints = m_vTimePoints;
+			m_vLoadedBlocks.assign((m_vTimePoints.size() + DATA_SAVE_BLOCK - 1) / DATA_SAVE_BLOCK, false);
+			m_bCacheSuspended = m_bCacheEnabled;
+			m_bCacheEnabled = false;
+			m_bCacheCoherent = true;
+			m_dModifiedFrom = std::numeric_limits<double>::max();
+			return;
+		}
+	}
+
 	m_dCurrWinStart = 0;
 	m_nCurrOffset = 0;
 	unsigned iCnt;
@@ -1950,6 +2026,8 @@ void CMDMatrix::LoadFromFile(const CH5Handler& _h5File, const std::string& _sPat
 	unsigned nModulo = m_vTimePoints.size() % DATA_SAVE_BLOCK;
 	if (nModulo != 0)
 		LoadMDBlockFromFile(_h5File, _sPath, iCnt * DATA_SAVE_BLOCK, iCnt * DATA_SAVE_BLOCK + nModulo - 1, vvBufData);
+
+	m_dModifiedFrom = std::numeric_limits<double>::max();
 }
 
 void CMDMatrix::LoadMDBlockFromFile(const CH5Handler& _h5File, const std::string& _sPath, unsigned _iFirst, unsigned _iLast, std::vector<std::vector<double>>& vvBuf)
@@ -1965,8 +2043,30 @@ void CMDMatrix::LoadMDBlockFromFile(const CH5Handler& _h5File, const std::string
 	CheckCacheNeed();
 }
 
+void CMDMatrix::DetachFromFile()
+{
+	if (!m_pSource) return;
+	LoadFromSource(m_vSourceTimePoints.front(), m_vSourceTimePoints.back());
+	ReleaseSource();
+}
+
+void CMDMatrix::UnloadFileData() const
+{
+	// data changed after loading can not be restored from file
+	if (!m_pSource || !m_bCacheCoherent) return;
+	m_data = RemoveFractionsRecursive(m_data);
+	std::fill(m_vLoadedBlocks.begin(), m_vLoadedBlocks.end(), false);
+}
+
 void CMDMatrix::SetCacheParams(bool _bEnabled, size_t _nWindow)
 {
+	// cache is applied when all data are loaded from file
+	if (m_pSource)
+	{
+		m_bCacheSuspended = _bEnabled;
+		m_nCacheWindow = _nWindow;
+		return;
+	}
 	m_bCacheEnabled = _bEnabled;
 	m_nCacheWindow = _nWindow;
 	if( ( _bEnabled ) && ( !m_sCachePath.empty() ) )
@@ -1982,6 +2082,7 @@ void CMDMatrix::SetCacheParams(bool _bEnabled, size_t _nWindow)
 
 void CMDMatrix::CompressData( double _dStartTime, double _dEndTime, double _dATol, double _dRTol )
 {
+	MarkModified(_dStartTime);
 	if( _dStartTime < _dEndTime )
 	{
 		m_dTempT1 = _dStartTime;
@@ -1995,6 +2096,7 @@ void CMDMatrix::CompressData( double _dStartTime, double _dEndTime, double _dATo
 
 void CMDMatrix::ExtrapolateToPoint( double _dT1, double _dT2, double _dTExtra )
 {
+	MarkModified(_dTExtra);
 	UnCacheData(_dT1,_dTExtra);
 
 	m_dTempT1 = _dT1;
@@ -2009,6 +2111,7 @@ void CMDMatrix::ExtrapolateToPoint( double _dT1, double _dT2, double _dTExtra )
 
 void CMDMatrix::ExtrapolateToPoint( double _dT0, double _dT1, double _dT2, double _dTExtra )
 {
+	MarkModified(_dTExtra);
 	UnCacheData(_dT0,_dTExtra);
 
 	m_vTempValues.resize( 4 );
@@ -2122,6 +2225,7 @@ bool CMDMatrix::IncrementCoords(std::vector<unsigned>& _vCoords, const std::vect
 
 bool CMDMatrix::SortMatrix(double _dSrcTime, double _dDstTime, CMDMatrix& _dstMatrix)
 {
+	_dstMatrix.MarkModified(_dDstTime);
 	if( m_vDimensions.size() != _dstMatrix.m_vDimensions.size() ) // dimensions are not similar in length
 		return false;
 
@@ -2160,6 +2264,7 @@ bool CMDMatrix::SortMatrix(double _dSrcTime, double _dDstTime, CMDMatrix& _dstMa
 
 bool CMDMatrix::SortMatrix( CMDMatrix& _dstMatrix )
 {
+	_dstMatrix.MarkModified();
 	if( m_vDimensions.size() != _dstMatrix.m_vDimensions.size() ) // dimensions are not similar in length
 		return false;
 
@@ -2203,6 +2308,8 @@ bool CMDMatrix::SortMatrix( CMDMatrix& _dstMatrix )
 
 void CMDMatrix::DeleteDimsWithSort(const std::vector<unsigned>& _vDims, std::vector<unsigned>& _vNewDims, std::vector<unsigned>& _vNewClasses, CMDMatrix& _sortMatr)
 {
+	MarkModified();
+	_sortMatr.MarkModified();
 	// get new sequence of dimensions for sorting
 	std::vector<unsigned> vDims;
 	std::vector<unsigned> vClasses;
@@ -2321,7 +2428,7 @@ sFraction* CMDMatrix::CopyFractionsRecursive(sFraction *_pSrc, unsigned _nNestin
 	return pDst;
 }
 
-sFraction* CMDMatrix::RemoveFractionsRecursive( sFraction *_pFraction, unsigned _nNesting /*= 0 */)
+sFraction* CMDMatrix::RemoveFractionsRecursive( sFraction *_pFraction, unsigned _nNesting /*= 0 */) const
 {
 	if( ( _nNesting >= m_vDimensions.size() ) || ( _pFraction == NULL ) )
 		return NULL;
@@ -2702,78 +2809,120 @@ bool CMDMatrix::SetVectorValueRecursive(sFraction *_pFraction, unsigned _nNestin
 	return true;
 }
 
-void CMDMatrix::TransformRecurcive(const CTransformMatrix& _TMatr)
+void CMDMatrix::GetFlatValuesRecursive(sFraction* _pFraction, unsigned _nLevels, std::vector<double>& _vFactors, std::vector<double>& _vRes, unsigned _nNesting /*= 0*/) const
 {
-	std::vector<unsigned> vDims = _TMatr.GetDimensions();
-	std::vector<unsigned> vClasses = _TMatr.GetClasses();
-
-	// transformation of required dimension
-	std::vector<unsigned> vSrcCoords( vDims.size()-1, 0 );
-	std::vector<unsigned> vDestCoords( vDims.size(), 0 );
+	if( _pFraction == NULL ) // no sub-distribution: all values are zero
+	{
+		size_t nCells = 1;
+		for( unsigned i=_nNesting; i<_nLevels; ++i )
+			nCells *= m_vClasses[i];
+		_vRes.insert( _vRes.end(), nCells, 0 );
+		return;
+	}
 
-	// get transforming values
-	std::vector<double> vCurrValues;
-	bool bIsEmpty = true;
-	bool bRes;
-	do
+	if( _nNesting != _nLevels-1 ) // go deeper
 	{
-		std::vector<double> vRes;
-		//if( m_pSortMatr->GetVectorValue( 0, vDims, vSrcCoords, vRes ) )
-		m_pSortMatr->GetVectorValue(0, vDims, vSrcCoords, vRes);
-		vCurrValues.insert( vCurrValues.end(), vRes.begin(), vRes.end() );
-		if( bIsEmpty ) // check if values contains only zeros
+		for( unsigned i=0; i<m_vClasses[_nNesting]; ++i )
 		{
-			unsigned index;
-			for( index=0; index<vRes.size(); ++index )
-				if( vRes[index] != 0 )
-					break;
-			if( index != vRes.size() )
-				bIsEmpty = false;
+			_vFactors.push_back( _pFraction[i].tdArray.GetValue( m_dTempT1 ) );
+			GetFlatValuesRecursive( _pFraction[i].pNext, _nLevels, _vFactors, _vRes, _nNesting+1 );
+			_vFactors.pop_back();
 		}
-		bRes = IncrementCoords( vSrcCoords, vClasses );
 	}
-	while( bRes );
+	else // the search is over
+		for( unsigned i=0; i<m_vClasses[_nNesting]; ++i )
+		{
+			// multiply in the same order as GetVectorValueRecursive does
+			double dValue = _pFraction[i].tdArray.GetValue( m_dTempT1 );
+			for( size_t j=_vFactors.size(); j-- > 0; )
+				dValue *= _vFactors[j];
+			_vRes.push_back( dValue < m_dMinFraction ? 0 : dValue );
+		}
+}
 
-	if( !bIsEmpty )
+void CMDMatrix::SetFlatValuesRecursive(sFraction* _pFraction, unsigned _nLevels, const std::vector<double>& _vValues, size_t& _iValue, std::vector<double>& _vFactors, unsigned _nNesting /*= 0*/)
+{
+	if( _nNesting != _nLevels-1 ) // go deeper
 	{
-		bool bResDest;
-		do // for each value in vCurrValues
+		size_t nCells = 1; // number of cells below one class of the current dimension
+		for( unsigned i=_nNesting+1; i<_nLevels; ++i )
+			nCells *= m_vClasses[i];
+		for( unsigned i=0; i<m_vClasses[_nNesting]; ++i )
 		{
-			std::fill( vSrcCoords.begin(), vSrcCoords.end(), 0 ); // set coords	to zero
-
-			std::vector<double> vTFactors;
-			std::vector<double> vBufTFactors;
-			double dNewValue = 0;
-			bool bTransRes;
-			do
-			{
-				_TMatr.GetVectorValue( vDims, vSrcCoords, vDims, vDestCoords, vBufTFactors ); // get current factors
-				vTFactors.insert( vTFactors.end(), vBufTFactors.begin(), vBufTFactors.end() );
-				bTransRes = IncrementCoords( vSrcCoords, vClasses );
-			}
-			while( bTransRes );
-
-			for (unsigned i = 0; i < vCurrValues.size(); ++i)
+			const double dFactor = _pFraction[i].tdArray.GetValue( m_dTempT1 );
+			// create next dimension
+			if( _pFraction[i].pNext == NULL )
 			{
-				if ((vTFactors[i] != 0) && (vCurrValues[i] != 0))
+				if( dFactor != 0 ) // cannot set value if previous dimension is not set
+					_pFraction[i].pNext = IitialiseDimension( m_vClasses[_nNesting+1] );
+				else
 				{
-					dNewValue += vCurrValues[i] * vTFactors[i];
+					_iValue += nCells;
+					continue;
 				}
 			}
-
-			m_pSortMatr->SetValue( 1, vDims, vDestCoords, dNewValue, false ); // set new value
-
-			// prepare to the next iteration
-			bResDest = IncrementCoords( vDestCoords, vClasses );
+			_vFactors.push_back( dFactor );
+			SetFlatValuesRecursive( _pFraction[i].pNext, _nLevels, _vValues, _iValue, _vFactors, _nNesting+1 );
+			_vFactors.pop_back();
 		}
-		while( bResDest );
 	}
+	else // the search is over
+		for( unsigned i=0; i<m_vClasses[_nNesting]; ++i )
+		{
+			const double dValue = _vValues[_iValue++];
+			m_dTempValue = dValue > m_dMinFraction ? dValue : 0;
+			// correct data in the same order as SetValueRecursive does
+			for( const double dFactor : _vFactors )
+				if( dFactor != 0 )
+					m_dTempValue /= dFactor;
+			m_vTempCoords.back() = i;
+			SetValueRecursive( _pFraction, false, _nLevels, _nNesting );
+		}
+}
 
-	if( vDims.size() > 1 ) // transformation of upper dimensions
+void CMDMatrix::TransformRecurcive(const CTransformMatrix& _TMatr)
+{
+	std::vector<unsigned> vDims = _TMatr.GetDimensions();
+	std::vector<unsigned> vClasses = _TMatr.GetClasses();
+
+	// non-zero factors of the matrix for each dimension, starting from the lowest one
+	for (const auto& sparse : _TMatr.GetSparseLevels())
 	{
-		CTransformMatrix newTMatr;
-		_TMatr.ReduceLastDim( newTMatr );
-		TransformRecurcive( newTMatr );
+		// get transforming values of all cells of the current levels with one pass over the sorted matrix
+		std::vector<double> vCurrValues;
+		std::vector<double> vFactors;
+		m_pSortMatr->m_dTempT1 = 0;
+		m_pSortMatr->GetFlatValuesRecursive( m_pSortMatr->m_data, static_cast<unsigned>(vDims.size()), vFactors, vCurrValues );
+		const bool bIsEmpty = std::all_of( vCurrValues.begin(), vCurrValues.end(), [](double _v) { return _v == 0; } );
+
+		if( !bIsEmpty )
+		{
+			// source and destination classes are enumerated in the same order as values in vCurrValues
+			const size_t* pCols = sparse.cols.data();
+			const double* pFactors = sparse.values.data();
+			const double* pValues = vCurrValues.data();
+			std::vector<double> vNewValues( vCurrValues.size() );
+			for( size_t iDest = 0; iDest < vNewValues.size(); ++iDest )
+				for( size_t i = sparse.rows[iDest]; i < sparse.rows[iDest + 1]; ++i )
+					vNewValues[iDest] += pValues[pCols[i]] * pFactors[i];
+
+			// write new values back with one pass over the sorted matrix
+			m_pSortMatr->MarkModified( 1 );
+			m_pSortMatr->UnCacheData( 1 );
+			m_pSortMatr->m_bCacheCoherent = false;
+			m_pSortMatr->m_dTempT1 = 1;
+			m_pSortMatr->m_vTempDims = vDims;
+			m_pSortMatr->m_vTempCoords.assign( vDims.size(), 0 );
+			if( m_pSortMatr->m_data == NULL )
+				m_pSortMatr->m_data = m_pSortMatr->IitialiseDimension( m_pSortMatr->m_vClasses.front() );
+			size_t iValue = 0;
+			vFactors.clear();
+			m_pSortMatr->SetFlatValuesRecursive( m_pSortMatr->m_data, static_cast<unsigned>(vDims.size()), vNewValues, iValue, vFactors );
+		}
+
+		// transformation of upper dimensions
+		vDims.pop_back();
+		vClasses.pop_back();
 	}
 }
 
@@ -3203,6 +3352,7 @@ void CMDMatrix::Extrapolate3ToPointRecursive( sFraction *_pFraction, unsigned _n
 
 void CMDMatrix::UnCacheData(double _dTP) const
 {
+	LoadFromSource(_dTP, _dTP);
 	if( !m_bCacheEnabled ) return;
 
 	if( ( m_nNonCachedTPNum == 0 ) && ( m_nCurrOffset == 0 ) ) return;
@@ -3233,6 +3383,7 @@ void CMDMatrix::UnCacheData(double _dTP) const
 
 void CMDMatrix::UnCacheData(double _dT1, double _dT2) const
 {
+	LoadFromSource(_dT1, _dT2);
 	if( !m_bCacheEnabled ) return;
 
 	if( ( m_nNonCachedTPNum == 0 ) && ( m_nCurrOffset == 0 ) ) return;
@@ -3373,6 +3524,61 @@ void CMDMatrix::ClearCache() const
 	m_bCacheCoherent = false;
 }
 
+void CMDMatrix::LoadFromSource(double _dT1, double _dT2) const
+{
+	if (!m_pSource) return;
+
+	// blocks with neighboring time points are also needed for interpolation
+	const auto& vTP = m_vSourceTimePoints;
+	const size_t iBeg = std::lower_bound(vTP.begin(), vTP.end(), std::min(_dT1, _dT2)) - vTP.begin();
+	const size_t iEnd = std::upper_bound(vTP.begin(), vTP.end(), std::max(_dT1, _dT2)) - vTP.begin();
+	const size_t iFirstBlock = (iBeg > 1 ? iBeg - 2 : 0) / DATA_SAVE_BLOCK;
+	const size_t iLastBlock = std::min(iEnd + 1, vTP.size() - 1) / DATA_SAVE_BLOCK;
+	if (std::all_of(m_vLoadedBlocks.begin() + iFirstBlock, m_vLoadedBlocks.begin() + iLastBlock + 1, [](bool _b) { return _b; }))
+		return;
+
+	// temporary variables may be in use by the caller
+	std::vector<double> vTempValues;
+	m_vTempValues.swap(vTempValues);
+	const unsigned nCounter = m_nCounter;
+
+	std::lock_guard<std::mutex> lock(sourceMutex);
+	std::vector<std::vector<double>> vvBuf;
+	for (size_t iBlock = iFirstBlock; iBlock <= iLastBlock; ++iBlock)
+	{
+		if (m_vLoadedBlocks[iBlock]) continue;
+		m_pSource->ReadData(m_sSourcePath, StrConst::MDM_H5Data + std::to_string(iBlock), vvBuf);
+		m_vTempValues.assign(vTP.begin() + iBlock * DATA_SAVE_BLOCK, vTP.begin() + std::min((iBlock + 1) * DATA_SAVE_BLOCK, vTP.size()));
+		m_nCounter = 0;
+		m_data = SetDataForLoadRecursive(m_data, vvBuf);
+		m_vLoadedBlocks[iBlock] = true;
+	}
+
+	m_vTempValues.swap(vTempValues);
+	m_nCounter = nCounter;
+}
+
+void CMDMatrix::MarkModified(double _dTime /*= std::numeric_limits<double>::lowest()*/) const
+{
+	m_dModifiedFrom = std::min(m_dModifiedFrom, _dTime);
+}
+
+void CMDMatrix::ReleaseSource()
+{
+	if (!m_pSource) return;
+	m_pSource.reset();
+	m_sSourcePath.clear();
+	m_vSourceTimePoints.clear();
+	m_vLoadedBlocks.clear();
+	m_nNonCachedTPNum = static_cast<unsigned>(m_vTimePoints.size());
+	m_nCurrOffset = 0;
+	m_dCurrWinStart = 0;
+	m_dCurrWinEnd = m_vTimePoints.empty() ? 0 : m_vTimePoints.back();
+	m_bCacheCoherent = false;
+	SetCacheParams(m_bCacheSuspended, m_nCacheWindow);
+	m_bCacheSuspended = false;
+}
+
 sFraction* CMDMatrix::UnCacheDataRecursive( sFraction *_pFraction, std::vector<std::vector<double>>& _vData, unsigned _nNesting /*= 0*/ ) const
 {
 	if( _nNesting >= m_vDimensions.size() )
@@ -7,6 +7,8 @@
 #include "Matrix2D.h"
 #include "TransformMatrix.h"
 #include "MDMatrCacher.h"
+#include <limits>
+#include <memory>
 
 #define DATA_SAVE_BLOCK	100
 
@@ -50,6 +52,15 @@ private:
 	mutable unsigned m_nNonCachedTPNum{ 0 };
 	mutable size_t m_nCurrOffset{ 0 };
 	mutable bool m_bCacheCoherent{ false };
+	bool m_bCacheSuspended{ false };		///< Cache is enabled, but suspended while data are loaded from file on demand.
+
+	// ===== Variables for loading of data from file on demand
+	std::shared_ptr<const CH5Handler> m_pSource;	///< File with data that are not loaded yet.
+	std::string m_sSourcePath;						///< Path to the matrix in the file.
+	std::vector<double> m_vSourceTimePoints;		///< Time points stored in the file.
+	mutable std::vector<bool> m_vLoadedBlocks;		///< Flags for each block of time points stored in the file, whether it is already loaded.
+
+	mutable double m_dModifiedFrom{ std::numeric_limits<double>::lowest() };	///< Earliest time point, whose data were modified since the last saving or loading.
 
 public:
 	CMDMatrix() = default;
@@ -299,9 +310,13 @@ public:
 	/** Save data to file.*/
 	void SaveToFile( CH5Handler& _h5File, const std::string& _sPath ) const;
 	void SaveMDBlockToFile(CH5Handler& _h5File, const std::string& _sPath, unsigned _iFirst, unsigned _iLast, std::vector<std::vector<double>>& _vvBuf) const;
-	/** Load data from file*/
+	/** Load data from file. If lazy loading is set in the file handler, only time points are loaded and the data are loaded later block-wise on demand.*/
 	void LoadFromFile(const CH5Handler& _h5File, const std::string& _sPath );
 	void LoadMDBlockFromFile(const CH5Handler& _h5File, const std::string& _sPath, unsigned _iFirst, unsigned _iLast, std::vector<std::vector<double>>& vvBuf);
+	/** Loads all data that are not loaded yet from the file and releases the file.*/
+	void DetachFromFile();
+	/** Removes from memory all data loaded on demand from the file, if they were not changed since then. They will be loaded again when needed.*/
+	void UnloadFileData() const;
 
 	void SetCachePath(const std::wstring& _sPath);
 	void SetCacheParams(bool _bEnabled, size_t _nWindow);
@@ -337,7 +352,7 @@ private:
 	/** Copies all data from _pSrc to a current matrix.*/
 	sFraction* CopyFractionsRecursive( sFraction *_pSrc, unsigned _nNesting = 0 );
 	/** Removes all fractions starting from _pFraction.*/
-	sFraction* RemoveFractionsRecursive( sFraction *_pFraction, unsigned _nNesting = 0 );
+	sFraction* RemoveFractionsRecursive( sFraction *_pFraction, unsigned _nNesting = 0 ) const;
 	/** Adds specified time point m_dTempT1 to each fraction. Data to a new time point will be copied from m_dTempT2.*/
 	void AddTimePointRecursive( sFraction *_pFraction, unsigned _nNesting = 0 );
 	/** Changes time point m_dTempT1 to a m_dTempT2.*/
@@ -355,6 +370,13 @@ private:
 	/*	Sets vector value m_vTempValues for time m_dTempT1 according to specified dimensions m_vTempDims and coordinates m_vTempCoords.
 	*	Dimensions set can be reduced. Returns false on error.*/
 	bool SetVectorValueRecursive( sFraction *_pFraction, unsigned _nNesting = 0 );
+	/** Appends to _vRes absolute values for time m_dTempT1 of all cells of the first _nLevels dimensions in the order of IncrementCoords,
+	*	putting zeros for missing sub-distributions. _vFactors holds fractions of the upper levels on the current path.*/
+	void GetFlatValuesRecursive(sFraction* _pFraction, unsigned _nLevels, std::vector<double>& _vFactors, std::vector<double>& _vRes, unsigned _nNesting = 0) const;
+	/** Sets absolute values _vValues starting from _iValue for time m_dTempT1 to all cells of the first _nLevels dimensions in the order of IncrementCoords,
+	*	as SetValue( m_dTempT1, m_vTempDims, coords, value, false ) does for each cell. m_vTempDims must contain the first _nLevels dimensions.
+	*	_vFactors holds fractions of the upper levels on the current path.*/
+	void SetFlatValuesRecursive(sFraction* _pFraction, unsigned _nLevels, const std::vector<double>& _vValues, size_t& _iValue, std::vector<double>& _vFactors, unsigned _nNesting = 0);
 	/** Transforms matrix m_pSortMatr according to a transformation matrix _TMatr.
 	*	Doesn't check the correspondence of dimensions between m_pSortMatr, _TMatr and this matrix.*/
 	void TransformRecurcive( const CTransformMatrix& _TMatr );
@@ -391,6 +413,13 @@ private:
 	void CorrectWinBoundary() const;
 	void ClearCache() const;
 
+	/** Loads all blocks of data from the file, that are needed to get values in the time interval and are not loaded yet.*/
+	void LoadFromSource(double _dT1, double _dT2) const;
+	/** Releases the file with data and resumes suspended cache.*/
+	void ReleaseSource();
+	/** Notifies that data starting from the time point were modified and must be saved again. By default, all data are marked.*/
+	void MarkModified(double _dTime = std::numeric_limits<double>::lowest()) const;
+
 	sFraction* UnCacheDataRecursive( sFraction *_pFraction, std::vector<std::vector<double>>& _vData, unsigned _nNesting = 0 ) const;
 	void CacheDataRecursive( sFraction *_pFraction, std::vector<std::vector<double>>& _vData, unsigned _nNesting = 0 ) const;
 
@@ -0,0 +1,146 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#include "MixtureEnthalpyCache.h"
+#include "DyssolUtilities.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace
+{
+	// Combines a hash value with a seed.
+	void HashCombine(size_t& _seed, size_t _value)
+	{
+		_seed ^= _value + 0x9e3779b97f4a7c15ULL + (_seed << 6) + (_seed >> 2);
+	}
+}
+
+size_t CMixtureEnthalpyCache::SKeyHash::operator()(const SKey& _key) const
+{
+	size_t seed = std::hash<const void*>{}(_key.materialsDB);
+	for (const auto& c : _key.compounds)
+		HashCombine(seed, std::hash<std::string>{}(c));
+	HashCombine(seed, std::hash<double>{}(_key.limits.min));
+	HashCombine(seed, std::hash<double>{}(_key.limits.max));
+	HashCombine(seed, std::hash<size_t>{}(_key.intervals));
+	for (const auto f : _key.fractions)
+		HashCombine(seed, std::hash<int64_t>{}(f));
+	return seed;
+}
+
+CMixtureEnthalpyCache::CMixtureEnthalpyCache(size_t _capacity, double _resolution)
+	: m_capacity{ _capacity }
+	, m_resolution{ _resolution }
+{
+}
+
+void CMixtureEnthalpyCache::SetCapacity(size_t _capacity)
+{
+	std::lock_guard lock{ m_mutex };
+	m_capacity = _capacity;
+	Shrink();
+}
+
+size_t CMixtureEnthalpyCache::GetCapacity() const
+{
+	std::lock_guard lock{ m_mutex };
+	return m_capacity;
+}
+
+void CMixtureEnthalpyCache::SetResolution(double _resolution)
+{
+	std::lock_guard lock{ m_mutex };
+	if (m_resolution == _resolution) return;
+	m_resolution = _resolution;
+	m_entries.clear();
+	m_index.clear();
+}
+
+double CMixtureEnthalpyCache::GetResolution() const
+{
+	std::lock_guard lock{ m_mutex };
+	return m_resolution;
+}
+
+std::shared_ptr<const CMixtureEnthalpyLookup> CMixtureEnthalpyCache::Get(const CMixtureEnthalpyLookup& _base, const std::vector<double>& _fractions)
+{
+	// filter and normalize fractions the same way as the lookup table does it
+	std::vector<double> filtered(_fractions.size());
+	std::replace_copy_if(_fractions.begin(), _fractions.end(), filtered.begin(), [](double v) { return v < 0; }, 0.0);
+	Normalize(filtered);
+
+	std::unique_lock lock{ m_mutex };
+
+	// build key
+	SKey key{ _base.GetMaterialsDatabase(), _base.GetCompounds(), _base.GetLimits(), _base.GetIntervalsNumber(), std::vector<int64_t>(filtered.size()) };
+	for (size_t i = 0; i < filtered.size(); ++i)
+		key.fractions[i] = m_resolution > 0 ? std::llround(filtered[i] / m_resolution) : static_cast<int64_t>(std::bit_cast<uint64_t>(filtered[i]));
+
+	// look up
+	if (const auto it = m_index.find(key); it != m_index.end())
+	{
+		m_entries.splice(m_entries.begin(), m_entries, it->second);
+		++m_hits;
+		return it->second->second;
+	}
+	++m_misses;
+
+	// restore fractions from the quantised values, so that the table does not depend on the order of requests
+	std::vector<double> quantised(filtered.size());
+	for (size_t i = 0; i < filtered.size(); ++i)
+		quantised[i] = m_resolution > 0 ? static_cast<double>(key.fractions[i]) * m_resolution : filtered[i];
+
+	// build the table without holding the lock
+	lock.unlock();
+	auto table = std::make_shared<CMixtureEnthalpyLookup>(_base);
+	table->SetCompoundFractions(quantised);
+	lock.lock();
+
+	// another thread could have added the same table meanwhile
+	if (const auto it = m_index.find(key); it != m_index.end())
+	{
+		m_entries.splice(m_entries.begin(), m_entries, it->second);
+		return it->second->second;
+	}
+	m_entries.emplace_front(key, table);
+	m_index.emplace(std::move(key), m_entries.begin());
+	Shrink();
+	return table;
+}
+
+size_t CMixtureEnthalpyCache::Size() const
+{
+	std::lock_guard lock{ m_mutex };
+	return m_entries.size();
+}
+
+size_t CMixtureEnthalpyCache::Hits() const
+{
+	std::lock_guard lock{ m_mutex };
+	return m_hits;
+}
+
+size_t CMixtureEnthalpyCache::Misses() const
+{
+	std::lock_guard lock{ m_mutex };
+	return m_misses;
+}
+
+void CMixtureEnthalpyCache::Clear()
+{
+	std::lock_guard lock{ m_mutex };
+	m_entries.clear();
+	m_index.clear();
+	m_hits = 0;
+	m_misses = 0;
+}
+
+void CMixtureEnthalpyCache::Shrink()
+{
+	while (m_entries.size() > m_capacity && !m_entries.empty())
+	{
+		m_index.erase(m_entries.back().first);
+		m_entries.pop_back();
+	}
+}
@@ -0,0 +1,124 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+
+#include "MixtureEnthalpyLookup.h"
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * \private
+ * \brief Least-recently-used cache of mixture enthalpy lookup tables.
+ * \details Building a weighted mixture table from compound tables is expensive, but compositions often repeat between time points and streams.
+ * The cache stores ready mixture tables keyed by the configuration of the base table (materials database, compounds, temperature limits and intervals)
+ * and by the composition quantised with the given resolution. The mixture table for a key is always built from the quantised composition,
+ * so the result does not depend on the order of requests. Intended to be shared between all streams of one flowsheet. Thread-safe.
+ */
+class CMixtureEnthalpyCache
+{
+	/**
+	 * \brief Key of a cache entry.
+	 */
+	struct SKey
+	{
+		const CMaterialsDatabase* materialsDB{};	///< Pointer to materials database.
+		std::vector<std::string> compounds;			///< Keys of compounds.
+		SInterval limits{};							///< Temperature limits.
+		size_t intervals{};							///< Number of temperature intervals.
+		std::vector<int64_t> fractions;				///< Quantised compounds fractions.
+		bool operator==(const SKey& _other) const = default;
+	};
+	/**
+	 * \brief Hash function for cache keys.
+	 */
+	struct SKeyHash
+	{
+		size_t operator()(const SKey& _key) const;
+	};
+
+	using entry_t = std::pair<SKey, std::shared_ptr<const CMixtureEnthalpyLookup>>;
+
+	size_t m_capacity{ DEFAULT_ENTHALPY_CACHE_SIZE };			///< Maximum number of stored tables.
+	double m_resolution{ DEFAULT_ENTHALPY_CACHE_RESOLUTION };	///< Quantisation step for compounds fractions.
+
+	std::list<entry_t> m_entries;												///< Stored tables, the most recently used first.
+	std::unordered_map<SKey, std::list<entry_t>::iterator, SKeyHash> m_index;	///< Index to find stored tables by their keys.
+	mutable std::mutex m_mutex;													///< Guards access to entries.
+
+	size_t m_hits{};	///< Number of requests served from the cache.
+	size_t m_misses{};	///< Number of requests that required building a new table.
+
+public:
+	/**
+	 * \brief Default constructor.
+	 */
+	CMixtureEnthalpyCache() = default;
+	/**
+	 * \brief Constructs cache with the given capacity and quantisation resolution.
+	 * \param _capacity Maximum number of stored tables.
+	 * \param _resolution Quantisation step for compounds fractions.
+	 */
+	CMixtureEnthalpyCache(size_t _capacity, double _resolution);
+
+	/**
+	 * \brief Sets the maximum number of stored tables. Removes the least recently used tables if needed.
+	 * \param _capacity Maximum number of stored tables.
+	 */
+	void SetCapacity(size_t _capacity);
+	/**
+	 * \brief Returns the maximum number of stored tables.
+	 * \return Maximum number of stored tables.
+	 */
+	[[nodiscard]] size_t GetCapacity() const;
+	/**
+	 * \brief Sets quantisation step for compounds fractions. Removes all stored tables.
+	 * \param _resolution Quantisation step.
+	 */
+	void SetResolution(double _resolution);
+	/**
+	 * \brief Returns quantisation step for compounds fractions.
+	 * \return Quantisation step.
+	 */
+	[[nodiscard]] double GetResolution() const;
+
+	/**
+	 * \brief Returns a mixture table for the given composition.
+	 * \details Takes the table from the cache if available, otherwise builds it from the base table and stores it.
+	 * The base table must contain all compound tables, its own fractions are ignored.
+	 * \param _base Base lookup table with the pointer to materials database, compounds, limits and intervals.
+	 * \param _fractions Compounds fractions.
+	 * \return Mixture table.
+	 */
+	[[nodiscard]] std::shared_ptr<const CMixtureEnthalpyLookup> Get(const CMixtureEnthalpyLookup& _base, const std::vector<double>& _fractions);
+
+	/**
+	 * \brief Returns the number of currently stored tables.
+	 * \return Number of stored tables.
+	 */
+	[[nodiscard]] size_t Size() const;
+	/**
+	 * \brief Returns the number of requests served from the cache.
+	 * \return Number of hits.
+	 */
+	[[nodiscard]] size_t Hits() const;
+	/**
+	 * \brief Returns the number of requests that required building a new table.
+	 * \return Number of misses.
+	 */
+	[[nodiscard]] size_t Misses() const;
+
+	/**
+	 * \brief Removes all stored tables and resets statistics.
+	 * \details Must be called if the materials database has been modified.
+	 */
+	void Clear();
+
+private:
+	/**
+	 * \brief Removes the least recently used tables until the capacity is respected. Must be called under lock.
+	 */
+	void Shrink();
+};
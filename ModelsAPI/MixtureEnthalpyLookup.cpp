@@ -42,12 +42,22 @@ void CMixtureEnthalpyLookup::SetMaterialsDatabase(const CMaterialsDatabase* _mat
 	UpdateCompoundsEnthalpies();
 }
 
+const CMaterialsDatabase* CMixtureEnthalpyLookup::GetMaterialsDatabase() const
+{
+	return m_materialsDB;
+}
+
 void CMixtureEnthalpyLookup::SetCompounds(const std::vector<std::string>& _compounds)
 {
 	m_compounds = _compounds;
 	UpdateCompoundsEnthalpies();
 }
 
+const std::vector<std::string>& CMixtureEnthalpyLookup::GetCompounds() const
+{
+	return m_compounds;
+}
+
 void CMixtureEnthalpyLookup::SetCompoundFractions(const std::vector<double>& _fractions)
 {
 	std::vector<double> filteredFractions(_fractions.size());
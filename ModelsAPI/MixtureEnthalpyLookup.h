@@ -67,11 +67,21 @@ public:
 	 * \param _materialsDB Pointer to materials database.
 	 */
 	void SetMaterialsDatabase(const CMaterialsDatabase* _materialsDB);
+	/**
+	 * \brief Returns pointer to materials database.
+	 * \return Pointer to materials database.
+	 */
+	[[nodiscard]] const CMaterialsDatabase* GetMaterialsDatabase() const;
 	/**
 	 * \brief Sets new list of _compounds.
 	 * \param _compounds List of compounds.
 	 */
 	void SetCompounds(const std::vector<std::string>& _compounds);
+	/**
+	 * \brief Returns current list of compounds.
+	 * \return List of compounds.
+	 */
+	[[nodiscard]] const std::vector<std::string>& GetCompounds() const;
 	/**
 	 * \brief Sets new fractions of all compounds.
 	 * \details The length of fractions must be equal to the number of previously defined compounds.
@@ -192,6 +192,16 @@ void CPhase::SetCacheSettings(const SCacheSettings& _cache)
 	m_distribution.SetCacheParams(_cache.isEnabled, _cache.window);
 }
 
+void CPhase::DetachFromFile()
+{
+	m_distribution.DetachFromFile();
+}
+
+void CPhase::UnloadFileData() const
+{
+	m_distribution.UnloadFileData();
+}
+
 void CPhase::SetGrid(const CMultidimensionalGrid& _grid)
 {
 	if (m_state != EPhase::SOLID) return;
@@ -88,6 +88,10 @@ public:
 
 	// Sets new caching parameters.
 	void SetCacheSettings(const SCacheSettings& _cache);
+	// Loads all data, which are loaded from file on demand, and releases the file.
+	void DetachFromFile();
+	// Removes from memory unchanged data loaded from file on demand. They will be loaded again when accessed.
+	void UnloadFileData() const;
 
 	// Sets grids of distributed parameters.
 	void SetGrid(const CMultidimensionalGrid& _grid);
@@ -0,0 +1,145 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#include "PhasePropertyKernels.h"
+#include "MaterialsDatabase.h"
+#include <cmath>
+#include <utility>
+
+CPhasePropertyKernels::CPhasePropertyKernels(const CMaterialsDatabase* _materialsDB, std::vector<std::string> _compounds)
+	: m_materialsDB{ _materialsDB }
+	, m_compounds{ std::move(_compounds) }
+{
+	const size_t n = m_compounds.size();
+	m_molarMasses.resize(n);
+	m_sqrtMolarMasses.resize(n);
+	for (size_t i = 0; i < n; ++i)
+	{
+		m_molarMasses[i] = m_materialsDB ? m_materialsDB->GetConstPropertyValue(m_compounds[i], MOLAR_MASS) : 0.0;
+		m_sqrtMolarMasses[i] = std::sqrt(m_molarMasses[i]);
+	}
+	m_massRatios.resize(n * n);
+	m_massFactors.resize(n * n);
+	for (size_t i = 0; i < n; ++i)
+		for (size_t j = 0; j < n; ++j)
+			if (m_molarMasses[i] != 0.0 && m_molarMasses[j] != 0.0)
+			{
+				m_massRatios[i * n + j] = std::pow(m_molarMasses[j] / m_molarMasses[i], 1. / 4.);
+				m_massFactors[i * n + j] = std::sqrt(8 * (1 + m_molarMasses[i] / m_molarMasses[j]));
+			}
+}
+
+double CPhasePropertyKernels::MolarMass(const std::vector<double>& _fractions) const
+{
+	double res = 0.0;
+	for (size_t i = 0; i < m_molarMasses.size(); ++i)
+		if (m_molarMasses[i] != 0.0)
+			res += _fractions[i] / m_molarMasses[i];
+	if (res != 0.0)
+		return 1.0 / res;
+	return {};
+}
+
+std::vector<double> CPhasePropertyKernels::MolFractions(const std::vector<double>& _fractions) const
+{
+	const double molarMass = MolarMass(_fractions);
+	std::vector<double> res(m_molarMasses.size());
+	for (size_t i = 0; i < m_molarMasses.size(); ++i)
+		res[i] = _fractions[i] * molarMass / m_molarMasses[i];
+	return res;
+}
+
+double CPhasePropertyKernels::Viscosity(EPhase _phase, const std::vector<double>& _fractions, double _temperature, double _pressure) const
+{
+	const auto values = CompoundsValues(VISCOSITY, _temperature, _pressure);
+	double res = 0.0;
+	switch (_phase)
+	{
+	case EPhase::LIQUID:
+		for (size_t i = 0; i < values.size(); ++i)
+			if (values[i] > 0.0)
+				res += _fractions[i] * std::log(values[i]);
+		if (res != 0.0)
+			return std::exp(res);
+		break;
+	case EPhase::VAPOR:
+	{
+		const auto molFractions = MolFractions(_fractions);
+		double numerator = 0.0, denominator = 0.0;
+		for (size_t i = 0; i < values.size(); ++i)
+		{
+			numerator += molFractions[i] * values[i] * m_sqrtMolarMasses[i];
+			denominator += molFractions[i] * m_sqrtMolarMasses[i];
+		}
+		if (denominator != 0.0)
+			return numerator / denominator;
+		break;
+	}
+	case EPhase::SOLID:
+		for (size_t i = 0; i < values.size(); ++i)
+			res += _fractions[i] * values[i];
+		return res;
+	case EPhase::UNDEFINED: break;
+	}
+	return {};
+}
+
+double CPhasePropertyKernels::ThermalConductivity(EPhase _phase, const std::vector<double>& _fractions, double _temperature, double _pressure) const
+{
+	const auto values = CompoundsValues(THERMAL_CONDUCTIVITY, _temperature, _pressure);
+	const size_t n = values.size();
+	double res = 0.0;
+	switch (_phase)
+	{
+	case EPhase::LIQUID:
+	{
+		const auto molFractions = MolFractions(_fractions);
+		for (size_t i = 0; i < n; ++i)
+			if (values[i] != 0.0)
+				res += molFractions[i] / std::pow(values[i], 2.0);
+		if (res != 0.0)
+			return 1.0 / std::sqrt(res);
+		break;
+	}
+	case EPhase::VAPOR:
+	{
+		const auto molFractions = MolFractions(_fractions);
+		for (size_t i = 0; i < n; ++i)
+		{
+			const double numerator = molFractions[i] * values[i];
+			double denominator = 0.0;
+			for (size_t j = 0; j < n; ++j)
+				if (m_molarMasses[i] != 0.0 && m_molarMasses[j] != 0.0 && values[j] != 0.0)
+					denominator += molFractions[j] * std::pow(1 + std::sqrt(values[i] / values[j]) * m_massRatios[i * n + j], 2) / m_massFactors[i * n + j];
+			if (denominator != 0.0)
+				res += numerator / denominator;
+		}
+		return res;
+	}
+	case EPhase::SOLID:
+		for (size_t i = 0; i < n; ++i)
+			res += _fractions[i] * values[i];
+		return res;
+	case EPhase::UNDEFINED: break;
+	}
+	return {};
+}
+
+double CPhasePropertyKernels::Density(const std::vector<double>& _fractions, double _temperature, double _pressure) const
+{
+	const auto values = CompoundsValues(DENSITY, _temperature, _pressure);
+	double res = 0.0;
+	for (size_t i = 0; i < values.size(); ++i)
+		if (values[i] != 0.0)
+			res += _fractions[i] / values[i];
+	return 1. / res;
+}
+
+std::vector<double> CPhasePropertyKernels::CompoundsValues(ECompoundTPProperties _property, double _temperature, double _pressure) const
+{
+	std::vector<double> res(m_compounds.size());
+	if (!m_materialsDB) return res;
+	for (size_t i = 0; i < m_compounds.size(); ++i)
+		res[i] = m_materialsDB->GetTPPropertyValue(m_compounds[i], _property, _temperature, _pressure);
+	return res;
+}
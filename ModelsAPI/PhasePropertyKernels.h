@@ -0,0 +1,88 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+
+#include "DefinesMDB.h"
+#include "DyssolDefines.h"
+#include <string>
+#include <vector>
+
+class CMaterialsDatabase;
+
+/**
+ * \private
+ * \brief Mixing rules to calculate temperature/pressure-dependent properties of a phase from properties of its compounds.
+ * \details Data of compounds that do not depend on temperature, pressure and composition (molar masses and their combinations used in mixing rules)
+ * are calculated once on construction, so the object must be re-created if the list of compounds or the materials database changes.
+ * Values of temperature/pressure-dependent properties are requested from the materials database once per compound for each evaluation.
+ * All compositions are given as mass fractions of compounds in the phase in the order of the compounds passed on construction.
+ */
+class CPhasePropertyKernels
+{
+	const CMaterialsDatabase* m_materialsDB{};	///< Pointer to a materials database.
+	std::vector<std::string> m_compounds;		///< Keys of compounds.
+
+	std::vector<double> m_molarMasses;			///< Molar masses of compounds.
+	std::vector<double> m_sqrtMolarMasses;		///< Square roots of molar masses of compounds.
+	std::vector<double> m_massRatios;			///< Mass ratio terms (M_j/M_i)^(1/4) for the gas thermal conductivity, stored row-wise for each pair (i,j).
+	std::vector<double> m_massFactors;			///< Mass factors sqrt(8(1+M_i/M_j)) for the gas thermal conductivity, stored row-wise for each pair (i,j).
+
+public:
+	/**
+	 * \brief Constructs kernels for the given compounds and precalculates constant data of compounds.
+	 * \param _materialsDB Pointer to materials database.
+	 * \param _compounds Keys of compounds.
+	 */
+	CPhasePropertyKernels(const CMaterialsDatabase* _materialsDB, std::vector<std::string> _compounds);
+
+	/**
+	 * \brief Returns molar mass of the phase.
+	 * \param _fractions Mass fractions of compounds in the phase.
+	 * \return Molar mass of the phase.
+	 */
+	[[nodiscard]] double MolarMass(const std::vector<double>& _fractions) const;
+	/**
+	 * \brief Returns mole fractions of compounds in the phase.
+	 * \param _fractions Mass fractions of compounds in the phase.
+	 * \return Mole fractions of compounds.
+	 */
+	[[nodiscard]] std::vector<double> MolFractions(const std::vector<double>& _fractions) const;
+
+	/**
+	 * \brief Returns viscosity of the phase using the mixing rule of the given phase type.
+	 * \param _phase Phase type.
+	 * \param _fractions Mass fractions of compounds in the phase.
+	 * \param _temperature Temperature [K].
+	 * \param _pressure Pressure [Pa].
+	 * \return Viscosity of the phase.
+	 */
+	[[nodiscard]] double Viscosity(EPhase _phase, const std::vector<double>& _fractions, double _temperature, double _pressure) const;
+	/**
+	 * \brief Returns thermal conductivity of the phase using the mixing rule of the given phase type.
+	 * \param _phase Phase type.
+	 * \param _fractions Mass fractions of compounds in the phase.
+	 * \param _temperature Temperature [K].
+	 * \param _pressure Pressure [Pa].
+	 * \return Thermal conductivity of the phase.
+	 */
+	[[nodiscard]] double ThermalConductivity(EPhase _phase, const std::vector<double>& _fractions, double _temperature, double _pressure) const;
+	/**
+	 * \brief Returns density of the phase without taking porosity into account.
+	 * \param _fractions Mass fractions of compounds in the phase.
+	 * \param _temperature Temperature [K].
+	 * \param _pressure Pressure [Pa].
+	 * \return Density of the phase.
+	 */
+	[[nodiscard]] double Density(const std::vector<double>& _fractions, double _temperature, double _pressure) const;
+
+private:
+	/**
+	 * \brief Returns values of the property for all compounds.
+	 * \param _property Identifier of temperature/pressure-dependent property.
+	 * \param _temperature Temperature [K].
+	 * \param _pressure Pressure [Pa].
+	 * \return Values of the property.
+	 */
+	[[nodiscard]] std::vector<double> CompoundsValues(ECompoundTPProperties _property, double _temperature, double _pressure) const;
+};
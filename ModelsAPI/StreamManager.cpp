@@ -581,6 +581,12 @@ void CStreamManager::UpdateCacheSettings()
 		stream->SetCacheSettings(*m_cache);
 }
 
+void CStreamManager::DetachFromFile()
+{
+	for (auto& stream : AllObjects())
+		stream->DetachFromFile();
+}
+
 void CStreamManager::UpdateThermodynamicsSettings()
 {
 	for (auto& stream : AllObjects())
@@ -596,6 +602,21 @@ void CStreamManager::ReduceTimePoints(double _timeBeg, double _timeEnd, double _
 	for (auto& s : m_streamsStored)	s->ReduceTimePoints(_timeBeg, _timeEnd, _step);
 }
 
+void CStreamManager::CopyUserData(const CStreamManager& _other)
+{
+	for (auto* object : GetAllInit())
+	{
+		const auto* other = _other.GetObjectInit(object->GetName());
+		if (!other) continue;
+		object->RemoveAllTimePoints();
+		if (!other->GetAllTimePoints().empty())
+			object->Copy(0.0, other->GetLastTimePoint(), *other);
+	}
+
+	// ensure init holdups and feeds have at least one time point
+	InitializeInitStreams();
+}
+
 void CStreamManager::SaveToFile(CH5Handler& _h5File, const std::string& _path) const
 {
 	if (!_h5File.IsValid()) return;
@@ -217,12 +217,17 @@ public:
 	void UpdateToleranceSettings();
 	// Updates cache settings in all streams.
 	void UpdateCacheSettings();
+	// Loads all data, which are loaded from file on demand, in all streams and releases the file.
+	void DetachFromFile();
 	// Updates thermodynamics settings in all streams.
 	void UpdateThermodynamicsSettings();
 
 	// Removes time points within the specified interval [timeBeg; timeEnd) that are closer together than step.
 	void ReduceTimePoints(double _timeBeg, double _timeEnd, double _step);
 
+	// Copies data of initial feeds and holdups with the same names from another manager. Objects themselves are not added or removed, so that pointers to them stay valid.
+	void CopyUserData(const CStreamManager& _other);
+
 	// Saves data to file.
 	void SaveToFile(CH5Handler& _h5File, const std::string& _path) const;
 	// Loads data from file.
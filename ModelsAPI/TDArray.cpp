@@ -2,6 +2,7 @@
 
 #include "TDArray.h"
 #include "DyssolUtilities.h"
+#include <algorithm>
 
 CTDArray::CTDArray(void):
 	m_nLastTimePos(0)
@@ -251,14 +252,16 @@ bool CTDArray::SetDataForLoad(const std::vector<double>& _vTP, const std::vector
 			return false;
 		}
 	}
-	size_t nEmptyCnt = 0;
+	const size_t nOldSize = m_data.size();
 	for (size_t i = 0; i < _vTP.size(); ++i)
 		if ((vData[i] != -1) && (_vTP[i] != -1))
 			m_data.push_back(STDValue(_vTP[i], vData[i]));
-		else
-			nEmptyCnt++;
 
-	return vData.size() != nEmptyCnt;
+	// blocks are usually loaded in order, but when loaded on demand, they may precede already loaded ones
+	if (nOldSize != 0 && nOldSize != m_data.size() && m_data[nOldSize].time < m_data[nOldSize - 1].time)
+		std::rotate(std::upper_bound(m_data.begin(), m_data.begin() + nOldSize, m_data[nOldSize]), m_data.begin() + nOldSize, m_data.end());
+
+	return m_data.size() != nOldSize;
 }
 
 void CTDArray::Clear()
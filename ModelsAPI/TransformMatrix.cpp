@@ -3,6 +3,7 @@
 #include "TransformMatrix.h"
 #include "DyssolUtilities.h"
 #include <cstring>
+#include <iterator>
 
 CTransformMatrix::CTransformMatrix(void)
 {
@@ -123,10 +124,12 @@ void CTransformMatrix::Clear()
 	m_nSize = 0;
 	m_vDimensions.clear();
 	m_vClasses.clear();
+	m_vSparse.clear();
 }
 
 void CTransformMatrix::ClearData()
 {
+	m_vSparse.clear();
 	if( m_pData != NULL )
 		for( unsigned i=0; i<m_nSize; ++i )
 			m_pData[i] = 0;
@@ -312,6 +315,7 @@ bool CTransformMatrix::SetValue(const std::vector<unsigned>& _vCoordsSrc, const
 	if( ( index == static_cast<size_t>(-1) ) || ( index >= m_nSize ) ) // wrong index
 		return false;
 
+	m_vSparse.clear();
 	m_pData[index] = _dValue;
 
 	return true;
@@ -329,6 +333,7 @@ bool CTransformMatrix::SetValue(const std::vector<unsigned>& _vDimsSrc, const st
 	if( ( index == static_cast<size_t>(-1) ) || ( index >= m_nSize ) ) // wrong index
 		return false;
 
+	m_vSparse.clear();
 	m_pData[index] = _dValue;
 
 	return true;
@@ -347,6 +352,7 @@ bool CTransformMatrix::SetVectorValue(const std::vector<unsigned>& _vCoordsSrc,
 
 	if (nVecLength != _vValue.size())  // wrong size of values vector
 		return false;
+	m_vSparse.clear();
 	for (unsigned i = 0; i < nVecLength; ++i)
 		if (index < m_nSize)
 		{
@@ -372,6 +378,7 @@ bool CTransformMatrix::SetVectorValue(const std::vector<unsigned>& _vDimsSrc, co
 
 	if (nVecLength != _vValue.size())  // wrong size of values vector
 		return false;
+	m_vSparse.clear();
 	for (unsigned i = 0; i < nVecLength; ++i)
 		if (index < m_nSize)
 		{
@@ -394,6 +401,7 @@ bool CTransformMatrix::SetMatrix(const CMatrix2D& _matrix)
 {
 	if (m_vDimensions.size() != 1) return false;
 	if (m_vClasses[0] != _matrix.Rows() || m_vClasses[0] != _matrix.Cols()) return false;
+	m_vSparse.clear();
 	for (size_t i = 0; i < _matrix.Cols(); ++i)
 		std::memcpy(m_pData + i * m_vClasses[0], _matrix.GetCol(i).data(), sizeof(double)*m_vClasses[0]);
 	return true;
@@ -410,40 +418,81 @@ void CTransformMatrix::ReduceLastDim( CTransformMatrix& _newTMatr ) const
 	vNewClasses.pop_back();
 	_newTMatr.SetDimensions(vNewDims, vNewClasses);
 
-	// prepare all parameters
-	const unsigned nLastDimSize = m_vClasses.back();
-	std::vector<unsigned> vSrcCoord(vNewDims.size());
-	std::vector<unsigned> vDstCoord(vNewDims.size());
-	std::vector<unsigned> vSrcCoordFull(m_vDimensions.size());
-	std::vector<unsigned> vDstCoordFull(m_vDimensions.size());
-
-	bool bSrc;
-	do
-	{
-		bool bDst;
-		do
+	// data are stored with the first source dimension changing fastest and the last destination dimension changing slowest,
+	// so the last dimension of source and destination are the outer strides of the reduced matrix
+	const size_t nLastDimSize = m_vClasses.back();
+	size_t nNewSize = 1;									// number of classes in the reduced matrix
+	for (const unsigned count : vNewClasses)
+		nNewSize *= count;
+	const size_t nOldSize = nNewSize * nLastDimSize;		// number of classes in this matrix
+	for (size_t iDst = 0; iDst < nNewSize; ++iDst)
+		for (size_t iSrc = 0; iSrc < nNewSize; ++iSrc)
 		{
 			double dVal = 0;
-			std::copy(vSrcCoord.begin(), vSrcCoord.end(), vSrcCoordFull.begin());
 			for (size_t i = 0; i < nLastDimSize; ++i)	// for src
 			{
-				vSrcCoordFull.back() = static_cast<unsigned>(i);
-				std::copy(vDstCoord.begin(), vDstCoord.end(), vDstCoordFull.begin());
-				const std::vector<unsigned> vDstCoordPart(vDstCoordFull.begin(), vDstCoordFull.begin() + vDstCoordFull.size() - 1);
-				std::vector<double> vals = GetVectorValue(vSrcCoordFull, vDstCoordPart);
-				dVal += VectorSum(vals);
+				const double* pData = m_pData + iSrc + i * nNewSize + iDst * nOldSize;
+				double dSum = 0;
+				for (size_t j = 0; j < nLastDimSize; ++j)	// for dst
+					dSum += pData[j * nNewSize * nOldSize];
+				dVal += dSum;
 			}
-			dVal /= nLastDimSize;
-			_newTMatr.SetValue(vSrcCoord, vDstCoord, dVal);
-
-			bDst = IncrementCoordsOld(vDstCoord, vNewClasses);
+			_newTMatr.m_pData[iSrc + iDst * nNewSize] = dVal / static_cast<double>(nLastDimSize);
 		}
-		while (bDst);
+}
 
-		std::fill(vDstCoord.begin(), vDstCoord.end(), 0);
-		bSrc = IncrementCoordsOld(vSrcCoord, vNewClasses);
+const std::vector<CTransformMatrix::SSparseRows>& CTransformMatrix::GetSparseLevels() const
+{
+	if (!m_vSparse.empty() || m_vDimensions.empty()) return m_vSparse;
+
+	m_vSparse.push_back(MakeSparseRows());
+	if (m_vDimensions.size() > 1)
+	{
+		CTransformMatrix reduced;
+		ReduceLastDim(reduced);
+		reduced.GetSparseLevels();
+		std::move(reduced.m_vSparse.begin(), reduced.m_vSparse.end(), std::back_inserter(m_vSparse));
 	}
-	while (bSrc);
+	return m_vSparse;
+}
+
+CTransformMatrix::SSparseRows CTransformMatrix::MakeSparseRows() const
+{
+	// positions of classes in m_pData, enumerated with the last dimension changing fastest
+	size_t nClasses = 1;
+	std::vector<size_t> vStrides(m_vClasses.size());
+	for (size_t i = 0; i < m_vClasses.size(); ++i)
+	{
+		vStrides[i] = nClasses;
+		nClasses *= m_vClasses[i];
+	}
+	std::vector<size_t> vOffsets(nClasses);
+	std::vector<unsigned> vCoords(m_vClasses.size(), 0);
+	for (size_t iClass = 0; iClass < nClasses; ++iClass)
+	{
+		size_t offset = 0;
+		for (size_t i = 0; i < vCoords.size(); ++i)
+			offset += vCoords[i] * vStrides[i];
+		vOffsets[iClass] = offset;
+		IncrementCoordsOld(vCoords, m_vClasses);
+	}
+
+	// collect non-zero values
+	SSparseRows res;
+	res.rows.reserve(nClasses + 1);
+	res.rows.push_back(0);
+	for (size_t iDst = 0; iDst < nClasses; ++iDst)
+	{
+		const double* pRow = m_pData + vOffsets[iDst] * nClasses;
+		for (size_t iSrc = 0; iSrc < nClasses; ++iSrc)
+			if (const double dVal = pRow[vOffsets[iSrc]]; dVal != 0)
+			{
+				res.cols.push_back(iSrc);
+				res.values.push_back(dVal);
+			}
+		res.rows.push_back(res.cols.size());
+	}
+	return res;
 }
 
 bool CTransformMatrix::CheckDuplicates(const std::vector<unsigned>& _vDims) const
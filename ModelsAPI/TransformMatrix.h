@@ -16,11 +16,26 @@
  */
 class CTransformMatrix
 {
+public:
+	/**
+	 * \private
+	 * \brief Non-zero values of the matrix in compressed sparse row format. For MDMatrix use.
+	 * \details Rows correspond to destination classes, columns to source classes.
+	 * Multidimensional classes are enumerated in the order of dimensions with the last dimension changing fastest.
+	 */
+	struct SSparseRows
+	{
+		std::vector<size_t> rows;	///< Position of the first value of each row in cols and values, followed by the total number of values.
+		std::vector<size_t> cols;	///< Source class of each value.
+		std::vector<double> values;	///< Non-zero values.
+	};
+
 private:
 	std::vector<unsigned> m_vDimensions;	///< Types of the distributions
 	std::vector<unsigned> m_vClasses;		///< Number of classes of the distributions
 	double *m_pData;						///< Data itself
 	size_t m_nSize;							///< Current matrix size
+	mutable std::vector<SSparseRows> m_vSparse;	///< Sparse representation of the matrix and of its reductions, built on demand. Empty if outdated.
 
 public:
 	/**
@@ -286,8 +301,18 @@ public:
 	 * \brief Removes last dimension in transformation matrix and recalculates others. For MDMatrix use.
 	 */
 	void ReduceLastDim( CTransformMatrix& _newTMatr ) const;
+	/**
+	 * \private
+	 * \brief Returns non-zero values of the matrix and of all matrices obtained from it by successive calls of ReduceLastDim(). For MDMatrix use.
+	 * \details Element i describes the matrix with i last dimensions removed. Calculated on the first call after the matrix has been changed.
+	 * \return Sparse representations of the matrix and its reductions.
+	 */
+	const std::vector<SSparseRows>& GetSparseLevels() const;
 
 private:
+	/** Builds sparse representation of the current matrix.*/
+	SSparseRows MakeSparseRows() const;
+
 	/** Checks the duplicates in dimensions vector. Return true if check is passed.*/
 	bool CheckDuplicates( const std::vector<unsigned>& _vDims ) const;
 
@@ -847,6 +847,47 @@ void CUnitParametersManager::SaveToFile(CH5Handler& _h5Saver, const std::string&
 	_h5Saver.WriteData(_path, StrConst::UParam_H5Names, names);
 }
 
+namespace
+{
+	// Assigns a unit parameter of the given type.
+	template<typename T>
+	void Assign(CBaseUnitParameter* _dst, const CBaseUnitParameter* _src)
+	{
+		*dynamic_cast<T*>(_dst) = *dynamic_cast<const T*>(_src);
+	}
+}
+
+void CUnitParametersManager::CopyUserData(const CUnitParametersManager& _other)
+{
+	for (auto& parameter : m_parameters)
+	{
+		const auto* other = _other.GetParameter(parameter->GetName());
+		if (!other || other->GetType() != parameter->GetType()) continue;
+		switch (parameter->GetType())
+		{
+		case EUnitParameter::CONSTANT:			Assign<CConstUnitParameter<double>>  (parameter.get(), other); break;
+		case EUnitParameter::CONSTANT_DOUBLE:	Assign<CConstUnitParameter<double>>  (parameter.get(), other); break;
+		case EUnitParameter::CONSTANT_INT64:	Assign<CConstUnitParameter<int64_t>> (parameter.get(), other); break;
+		case EUnitParameter::CONSTANT_UINT64:	Assign<CConstUnitParameter<uint64_t>>(parameter.get(), other); break;
+		case EUnitParameter::PARAM_DEPENDENT:	Assign<CDependentUnitParameter>      (parameter.get(), other); break;
+		case EUnitParameter::TIME_DEPENDENT:	Assign<CTDUnitParameter>             (parameter.get(), other); break;
+		case EUnitParameter::STRING:			Assign<CStringUnitParameter>         (parameter.get(), other); break;
+		case EUnitParameter::CHECKBOX:			Assign<CCheckBoxUnitParameter>       (parameter.get(), other); break;
+		case EUnitParameter::COMBO:				Assign<CComboUnitParameter>          (parameter.get(), other); break;
+		case EUnitParameter::GROUP:				Assign<CComboUnitParameter>          (parameter.get(), other); break;
+		case EUnitParameter::COMPOUND:			Assign<CCompoundUnitParameter>       (parameter.get(), other); break;
+		case EUnitParameter::MDB_COMPOUND:		Assign<CMDBCompoundUnitParameter>    (parameter.get(), other); break;
+		case EUnitParameter::REACTION:			Assign<CReactionUnitParameter>       (parameter.get(), other); break;
+		case EUnitParameter::LIST_DOUBLE:		Assign<CListRealUnitParameter>       (parameter.get(), other); break;
+		case EUnitParameter::LIST_INT64:		Assign<CListIntUnitParameter>        (parameter.get(), other); break;
+		case EUnitParameter::LIST_UINT64:		Assign<CListUIntUnitParameter>       (parameter.get(), other); break;
+		// the solver itself belongs to the unit it was loaded for
+		case EUnitParameter::SOLVER:			dynamic_cast<CSolverUnitParameter*>(parameter.get())->SetKey(dynamic_cast<const CSolverUnitParameter*>(other)->GetKey()); break;
+		case EUnitParameter::UNKNOWN: break;
+		}
+	}
+}
+
 void CUnitParametersManager::LoadFromFile(const CH5Handler& _h5Loader, const std::string& _path)
 {
 	if (!_h5Loader.IsValid()) return;
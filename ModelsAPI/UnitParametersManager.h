@@ -973,6 +973,14 @@ public:
 	 */
 	void ClearGroups();
 
+	/**
+	 * \private
+	 * \brief Copies values of parameters with the same names and types from another manager.
+	 * \details Parameters themselves are not added or removed, so that pointers to them stay valid. For solver parameters, only the key of the solver is copied.
+	 * \param _other Manager to copy from.
+	 */
+	void CopyUserData(const CUnitParametersManager& _other);
+
 	/**
 	 * \private
 	 * \brief Saves data to file.
@@ -265,6 +265,14 @@ public:
 	 */
 	void Clear();
 
+	/**
+	 * \private
+	 * \brief Copies connections of ports with the same names from another manager.
+	 * \details Ports themselves are not added or removed, so that pointers to them stay valid.
+	 * \param _other Manager to copy from.
+	 */
+	void CopyUserData(const CPortsManager& _other);
+
 	/**
 	 * \private
 	 * \brief Saves data to file.
@@ -0,0 +1,131 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#include "BenchmarkReport.h"
+#include "DyssolSystemDefines.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <numeric>
+
+CBenchmarkReport::CBenchmarkReport(std::filesystem::path _script)
+	: m_script{ std::move(_script) }
+{
+}
+
+void CBenchmarkReport::AddRun(SRun _run)
+{
+	m_runs.push_back(std::move(_run));
+}
+
+void CBenchmarkReport::SetPeakMemory(size_t _bytes)
+{
+	m_peakMemory = _bytes;
+}
+
+void CBenchmarkReport::Write(std::ostream& _out) const
+{
+	std::vector<double> times;
+	for (const auto& run : m_runs)
+		times.push_back(run.time);
+	const bool success = std::all_of(m_runs.begin(), m_runs.end(), [](const SRun& _run)
+	{
+		return std::all_of(_run.jobs.begin(), _run.jobs.end(), [](const SJobRun& _job) { return _job.success; });
+	});
+	const auto [min, max] = std::minmax_element(times.begin(), times.end());
+
+	_out << "{\n";
+	_out << "  \"version\": " << String(CURRENT_VERSION_STR) << ",\n";
+	_out << "  \"script\": " << String(std::filesystem::absolute(m_script).make_preferred().string()) << ",\n";
+	_out << "  \"repetitions\": " << m_runs.size() << ",\n";
+	_out << "  \"success\": " << (success ? "true" : "false") << ",\n";
+	_out << "  \"peak_rss\": " << m_peakMemory << ",\n";
+	_out << "  \"wall_time\": { ";
+	if (!times.empty())
+		_out << "\"min\": " << Number(*min) << ", \"mean\": " << Number(std::accumulate(times.begin(), times.end(), 0.0) / static_cast<double>(times.size())) << ", \"max\": " << Number(*max);
+	_out << " },\n";
+	_out << "  \"runs\": [";
+	for (size_t i = 0; i < m_runs.size(); ++i)
+	{
+		_out << (i ? "," : "") << "\n    {\n";
+		_out << "      \"wall_time\": " << Number(m_runs[i].time) << ",\n";
+		_out << "      \"jobs\": [";
+		for (size_t j = 0; j < m_runs[i].jobs.size(); ++j)
+		{
+			const auto& job = m_runs[i].jobs[j];
+			_out << (j ? "," : "") << "\n        {\n";
+			_out << "          \"wall_time\": " << Number(job.time) << ",\n";
+			_out << "          \"success\": " << (job.success ? "true" : "false") << ",\n";
+			_out << "          \"simulations\": [";
+			for (size_t k = 0; k < job.simulations.size(); ++k)
+			{
+				_out << (k ? "," : "") << "\n            ";
+				WriteSimulation(_out, job.simulations[k]);
+			}
+			_out << (job.simulations.empty() ? "" : "\n          ") << "]\n";
+			_out << "        }";
+		}
+		_out << (m_runs[i].jobs.empty() ? "" : "\n      ") << "]\n";
+		_out << "    }";
+	}
+	_out << (m_runs.empty() ? "" : "\n  ") << "]\n";
+	_out << "}\n";
+}
+
+void CBenchmarkReport::WriteSimulation(std::ostream& _out, const CScriptRunner::SSimulationStatistics& _simulation)
+{
+	_out << "{ \"wall_time\": " << Number(_simulation.time) << ", \"iterations\": " << _simulation.iterations << ", \"units\": [";
+	for (size_t i = 0; i < _simulation.units.size(); ++i)
+	{
+		const auto& unit = _simulation.units[i];
+		_out << (i ? "," : "") << "\n              { \"name\": " << String(unit.name) << ", \"model\": " << String(unit.model) << ", \"time\": " << Number(unit.time) << ", \"solvers\": [";
+		for (size_t j = 0; j < unit.solvers.size(); ++j)
+		{
+			const auto& [name, s] = unit.solvers[j];
+			_out << (j ? ", " : " ") << "{ \"name\": " << String(name)
+				<< ", \"calls\": " << s.calls << ", \"steps\": " << s.steps
+				<< ", \"residual_evaluations\": " << s.residualEvaluations << ", \"jacobian_evaluations\": " << s.jacobianEvaluations
+				<< ", \"linear_solver_setups\": " << s.linearSolverSetups << ", \"nonlinear_iterations\": " << s.nonlinearIterations
+				<< ", \"nonlinear_failures\": " << s.nonlinearFailures << ", \"error_test_failures\": " << s.errorTestFailures
+				<< ", \"last_step\": " << Number(s.lastStep) << ", \"solver_time\": " << Number(s.solverTime) << ", \"residual_time\": " << Number(s.residualTime) << " }";
+		}
+		_out << (unit.solvers.empty() ? "" : " ") << "] }";
+	}
+	_out << (_simulation.units.empty() ? "" : "\n            ") << "] }";
+}
+
+std::string CBenchmarkReport::String(const std::string& _value)
+{
+	std::string res = "\"";
+	for (const char c : _value)
+	{
+		switch (c)
+		{
+		case '"':  res += "\\\"";	break;
+		case '\\': res += "\\\\";	break;
+		case '\n': res += "\\n";	break;
+		case '\r': res += "\\r";	break;
+		case '\t': res += "\\t";	break;
+		default:
+			if (static_cast<unsigned char>(c) < 0x20)
+			{
+				char buf[8];
+				std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned>(c));
+				res += buf;
+			}
+			else
+				res += c;
+		}
+	}
+	return res + "\"";
+}
+
+std::string CBenchmarkReport::Number(double _value)
+{
+	if (!std::isfinite(_value))
+		return "null";
+	char buf[64];
+	const auto res = std::to_chars(std::begin(buf), std::end(buf), _value);
+	return { buf, res.ptr };
+}
@@ -0,0 +1,58 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+#include "ScriptRunner.h"
+#include "DyssolFilesystem.h"
+#include <ostream>
+#include <string>
+#include <vector>
+
+/*
+ * Collects performance data of repeated executions of a script and writes them in JSON format.
+ * The report contains wall-clock times of all executions with their minimum, mean and maximum, the peak memory usage of the process,
+ * and for each execution, each job and each simulation: wall-clock time, number of iterations over tear streams, time spent in each unit and statistics of its equation solvers.
+ */
+class CBenchmarkReport
+{
+public:
+	// Performance data of one execution of a script job.
+	struct SJobRun
+	{
+		double time{};													// Wall-clock time of the job [s].
+		bool success{ false };											// Whether the job has been executed successfully.
+		std::vector<CScriptRunner::SSimulationStatistics> simulations;	// Statistics of all simulations of the job.
+	};
+
+	// Performance data of one execution of the script.
+	struct SRun
+	{
+		double time{};				// Wall-clock time of all jobs [s].
+		std::vector<SJobRun> jobs;	// Data of all jobs.
+	};
+
+private:
+	std::filesystem::path m_script;	// Benchmarked script file.
+	std::vector<SRun> m_runs;		// All executions of the script.
+	size_t m_peakMemory{ 0 };		// Peak resident set size of the process [B].
+
+public:
+	explicit CBenchmarkReport(std::filesystem::path _script);
+
+	// Adds data of one execution of the script.
+	void AddRun(SRun _run);
+	// Sets the peak resident set size of the process in bytes.
+	void SetPeakMemory(size_t _bytes);
+
+	// Writes the report in JSON format.
+	void Write(std::ostream& _out) const;
+
+private:
+	// Writes statistics of one simulation.
+	static void WriteSimulation(std::ostream& _out, const CScriptRunner::SSimulationStatistics& _simulation);
+
+	// Returns the string as a quoted JSON string.
+	static std::string String(const std::string& _value);
+	// Returns the value as a JSON number, or null if the value is not finite.
+	static std::string Number(double _value);
+};
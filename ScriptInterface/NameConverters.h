@@ -5,6 +5,8 @@
 #pragma once
 #include "DistributionFunctions.h"
 #include "DyssolDefines.h"
+#include "ParameterSweep.h"
+#include "ResultsExporter.h"
 #include <vector>
 #include <string>
 #include <map>
@@ -39,6 +41,19 @@ namespace
 		{ EExtrapolationMethod::NEAREST, { "NEAREST_NEIGHBOR" } },
 	};
 
+	template<> std::map<EExportFormat, std::vector<std::string>>SEnumStrings<EExportFormat>::data
+	{
+		{ EExportFormat::TEXT  , { "TEXT"   } },
+		{ EExportFormat::BINARY, { "BINARY" } },
+		{ EExportFormat::HDF5  , { "HDF5"   } },
+	};
+
+	template<> std::map<ESweepMethod, std::vector<std::string>>SEnumStrings<ESweepMethod>::data
+	{
+		{ ESweepMethod::GRID           , { "GRID"                   } },
+		{ ESweepMethod::LATIN_HYPERCUBE, { "LATIN_HYPERCUBE", "LHS" } },
+	};
+
 	template<> std::map<EPhase, std::vector<std::string>>SEnumStrings<EPhase>::data
 	{
 		{ EPhase::SOLID , { "SOLID"        } },
@@ -0,0 +1,60 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#include "ParameterSweep.h"
+#include <random>
+
+std::vector<std::vector<double>> ParameterSweep::Grid(const std::vector<SSweepRange>& _ranges)
+{
+	if (_ranges.empty()) return {};
+
+	// values of each range
+	std::vector<std::vector<double>> levels;
+	for (const auto& r : _ranges)
+	{
+		auto& values = levels.emplace_back();
+		for (size_t i = 0; i < r.points; ++i)
+			values.push_back(r.points == 1 ? r.min : r.min + (r.max - r.min) * static_cast<double>(i) / static_cast<double>(r.points - 1));
+		if (values.empty()) return {};
+	}
+
+	// all combinations, counting in a mixed radix system
+	std::vector<std::vector<double>> res;
+	std::vector<size_t> index(_ranges.size(), 0);
+	while (true)
+	{
+		auto& sample = res.emplace_back();
+		for (size_t i = 0; i < index.size(); ++i)
+			sample.push_back(levels[i][index[i]]);
+		size_t i = index.size();
+		while (i > 0 && ++index[i - 1] == levels[i - 1].size())
+			index[--i] = 0;
+		if (i == 0) break;
+	}
+	return res;
+}
+
+std::vector<std::vector<double>> ParameterSweep::LatinHypercube(const std::vector<SSweepRange>& _ranges, size_t _samples, uint64_t _seed)
+{
+	if (_ranges.empty() || _samples == 0) return {};
+
+	// distributions of the standard library are implementation-defined, so random numbers are derived from the generator directly
+	std::mt19937_64 generator{ _seed };
+	const auto Uniform = [&] { return static_cast<double>(generator() >> 11) * 0x1.0p-53; };
+	const auto Index = [&](size_t _n) { return static_cast<size_t>(generator() % _n); };
+
+	std::vector<std::vector<double>> res(_samples, std::vector<double>(_ranges.size()));
+	std::vector<size_t> intervals(_samples);
+	for (size_t r = 0; r < _ranges.size(); ++r)
+	{
+		// random permutation of intervals
+		for (size_t i = 0; i < _samples; ++i)
+			intervals[i] = i;
+		for (size_t i = _samples - 1; i > 0; --i)
+			std::swap(intervals[i], intervals[Index(i + 1)]);
+		// random point within each interval
+		for (size_t i = 0; i < _samples; ++i)
+			res[i][r] = _ranges[r].min + (_ranges[r].max - _ranges[r].min) * (static_cast<double>(intervals[i]) + Uniform()) / static_cast<double>(_samples);
+	}
+	return res;
+}
@@ -0,0 +1,35 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Methods to sample values of parameters in a parameter sweep.
+enum class ESweepMethod : uint32_t
+{
+	GRID            = 0, // Full factorial grid of equidistant points of all parameters.
+	LATIN_HYPERCUBE = 1, // Latin hypercube sampling with a given number of samples.
+};
+
+// Range of values of a swept parameter.
+struct SSweepRange
+{
+	double min{};		// Minimum value.
+	double max{};		// Maximum value.
+	size_t points{ 2 };	// Number of equidistant points within the range for grid sampling.
+};
+
+/*
+ * Generation of samples for parameter sweeps.
+ * Each sample is a vector with one value for each range, in the order of ranges.
+ */
+namespace ParameterSweep
+{
+	// Returns all combinations of equidistant points of the ranges. The value of the last range changes first.
+	std::vector<std::vector<double>> Grid(const std::vector<SSweepRange>& _ranges);
+	// Returns _samples Latin hypercube samples of the ranges: each range is divided into _samples equal intervals and each interval is used exactly once.
+	// The same seed always results in the same samples on all platforms.
+	std::vector<std::vector<double>> LatinHypercube(const std::vector<SSweepRange>& _ranges, size_t _samples, uint64_t _seed);
+}
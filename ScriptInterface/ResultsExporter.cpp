@@ -0,0 +1,132 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#include "ResultsExporter.h"
+#include "StringFunctions.h"
+
+bool CResultsExporter::Open(const std::filesystem::path& _fileName, EExportFormat _format, const SH5StorageSettings& _storage)
+{
+	Close();
+	m_format = _format;
+	m_counter = 0;
+
+	switch (m_format)
+	{
+	case EExportFormat::TEXT:
+		m_file.open(_fileName);
+		return m_file.is_open();
+	case EExportFormat::BINARY:
+		m_file.open(_fileName, std::ios::binary);
+		if (!m_file.is_open()) return false;
+		m_file.write(m_signature, sizeof(m_signature));
+		WriteBinaryValue(m_version);
+		return m_file.good();
+	case EExportFormat::HDF5:
+		m_h5File.SetStorageSettings(_storage);
+		m_h5File.Create(_fileName);
+		if (!m_h5File.IsValid()) return false;
+		m_h5File.WriteAttribute("/", "Version", static_cast<int>(m_version));
+		return true;
+	}
+
+	return false;
+}
+
+bool CResultsExporter::Close()
+{
+	bool success = true;
+	if (m_file.is_open())
+	{
+		m_file.flush();
+		success = m_file.good();
+		m_file.close();
+	}
+	if (m_h5File.IsValid())
+		m_h5File.Close();
+	return success;
+}
+
+void CResultsExporter::SetPrecision(int _precision)
+{
+	m_precision = std::max(_precision, 0);
+}
+
+void CResultsExporter::SetFixedPoint(bool _fixed)
+{
+	m_charsFormat = _fixed ? std::chars_format::fixed : std::chars_format::scientific;
+}
+
+void CResultsExporter::Write(const SExportTable& _table)
+{
+	switch (m_format)
+	{
+	case EExportFormat::TEXT:	WriteText(_table);		break;
+	case EExportFormat::BINARY:	WriteBinary(_table);	break;
+	case EExportFormat::HDF5:	WriteHDF5(_table);		break;
+	}
+	++m_counter;
+}
+
+void CResultsExporter::WriteText(const SExportTable& _table)
+{
+	m_buffer = _table.tag;
+	for (const auto& name : _table.names)
+		m_buffer.append(" ").append(StringFunctions::Quote(name));
+	for (size_t i = 0; i < _table.values.size(); ++i)
+	{
+		m_buffer.push_back(' ');
+		AppendValue(_table.values[i], i % _table.columns < _table.integers);
+	}
+	m_buffer.push_back('\n');
+	m_file.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+}
+
+void CResultsExporter::WriteBinary(const SExportTable& _table)
+{
+	const uint64_t rows = _table.values.size() / _table.columns;
+	WriteBinaryString(_table.tag);
+	WriteBinaryValue(static_cast<uint32_t>(_table.names.size()));
+	for (const auto& name : _table.names)
+		WriteBinaryString(name);
+	WriteBinaryValue(rows);
+	WriteBinaryValue(static_cast<uint64_t>(_table.columns));
+	std::vector<double> column(rows);
+	for (size_t c = 0; c < _table.columns; ++c)
+	{
+		for (size_t r = 0; r < rows; ++r)
+			column[r] = _table.values[r * _table.columns + c];
+		m_file.write(reinterpret_cast<const char*>(column.data()), static_cast<std::streamsize>(rows * sizeof(double)));
+	}
+}
+
+void CResultsExporter::WriteHDF5(const SExportTable& _table)
+{
+	const size_t rows = _table.values.size() / _table.columns;
+	std::vector<std::vector<double>> columns(_table.columns, std::vector<double>(rows));
+	for (size_t r = 0; r < rows; ++r)
+		for (size_t c = 0; c < _table.columns; ++c)
+			columns[c][r] = _table.values[r * _table.columns + c];
+
+	const std::string group = m_h5File.CreateGroup("/", "Table" + std::to_string(m_counter));
+	m_h5File.WriteData(group, "Tag", _table.tag);
+	m_h5File.WriteData(group, "Names", _table.names);
+	m_h5File.WriteData(group, "Columns", columns);
+}
+
+void CResultsExporter::AppendValue(double _value, bool _integer)
+{
+	char buf[512];
+	auto res = _integer
+		? std::to_chars(std::begin(buf), std::end(buf), static_cast<uint64_t>(_value))
+		: std::to_chars(std::begin(buf), std::end(buf), _value, m_charsFormat, m_precision);
+	// too long in fixed notation
+	if (res.ec != std::errc{})
+		res = std::to_chars(std::begin(buf), std::end(buf), _value);
+	m_buffer.append(buf, res.ptr);
+}
+
+void CResultsExporter::WriteBinaryString(const std::string& _value)
+{
+	WriteBinaryValue(static_cast<uint32_t>(_value.size()));
+	m_file.write(_value.data(), static_cast<std::streamsize>(_value.size()));
+}
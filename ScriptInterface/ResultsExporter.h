@@ -0,0 +1,78 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+#include "H5Handler.h"
+#include "DyssolFilesystem.h"
+#include <charconv>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Formats of files with exported results.
+enum class EExportFormat : uint32_t
+{
+	TEXT   = 0, // Each table in one line of a text file.
+	BINARY = 1, // Tables with values stored column by column in a binary file.
+	HDF5   = 2, // Each table in a separate group of an HDF5 file.
+};
+
+// Exported values of one script entry.
+struct SExportTable
+{
+	std::string tag;				// Type of exported data, e.g. STREAM_MASS.
+	std::vector<std::string> names;	// Names of exported objects, e.g. unit and holdup.
+	size_t columns{ 1 };			// Number of values in each row, e.g. time point followed by values at this time point.
+	size_t integers{ 0 };			// Number of first columns holding integer values.
+	std::vector<double> values;		// All values, row by row.
+};
+
+/*
+ * Writes exported results to a file.
+ * Text format keeps the layout of previous versions: a tag, quoted names and all values of the table row by row, separated by spaces.
+ * Binary format starts with a signature and a version, followed by all tables. Each table is stored as:
+ * tag, number of names, names, number of rows, number of columns, values of the first column, values of the second column, etc.
+ * Strings are stored as their length followed by characters; all numbers are 32-bit (lengths) or 64-bit (counts, values) in the native byte order.
+ */
+class CResultsExporter
+{
+	static constexpr char m_signature[8]{ 'D', 'Y', 'S', 'S', 'O', 'L', 'E', 'X' };	// Signature of binary files.
+	static constexpr uint32_t m_version{ 1 };										// Version of binary and HDF5 formats.
+
+	EExportFormat m_format{ EExportFormat::TEXT };		// Format of the file.
+	std::ofstream m_file;								// Text or binary file.
+	CH5Handler m_h5File;								// HDF5 file.
+	size_t m_counter{ 0 };								// Number of written tables.
+	int m_precision{ 6 };								// Precision of values in text format.
+	std::chars_format m_charsFormat{ std::chars_format::general };	// Notation of values in text format.
+	std::string m_buffer;								// Buffer to format one row of text.
+
+public:
+	// Creates a file with the given format. Returns success flag.
+	bool Open(const std::filesystem::path& _fileName, EExportFormat _format, const SH5StorageSettings& _storage = {});
+	// Closes the file. Returns whether all data were written successfully.
+	bool Close();
+
+	// Sets precision of values in text format.
+	void SetPrecision(int _precision);
+	// Sets notation of values in text format: fixed or scientific. If not set, the shortest of them is used.
+	void SetFixedPoint(bool _fixed);
+
+	// Writes the table to the file.
+	void Write(const SExportTable& _table);
+
+private:
+	void WriteText(const SExportTable& _table);
+	void WriteBinary(const SExportTable& _table);
+	void WriteHDF5(const SExportTable& _table);
+
+	// Appends the value to the text buffer.
+	void AppendValue(double _value, bool _integer);
+	// Writes the value to the binary file.
+	template<typename T> void WriteBinaryValue(const T& _value)
+	{
+		m_file.write(reinterpret_cast<const char*>(&_value), sizeof(T));
+	}
+	// Writes the string to the binary file.
+	void WriteBinaryString(const std::string& _value);
+};
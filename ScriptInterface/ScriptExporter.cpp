@@ -163,6 +163,36 @@ namespace ScriptInterface
 				job.AddEntry(e.keyStr)->value = SNamedEnum{ static_cast<EExtrapolationMethod>(_flowsheet.GetParameters()->extrapolationMethod) };
 				break;
 			}
+			case EScriptKeys::FILE_COMPRESSION:
+			{
+				job.AddEntry(e.keyStr)->value = static_cast<uint64_t>(_flowsheet.GetParameters()->fileCompression);
+				break;
+			}
+			case EScriptKeys::FILE_SHUFFLE:
+			{
+				job.AddEntry(e.keyStr)->value = static_cast<bool>(_flowsheet.GetParameters()->fileShuffleFlag);
+				break;
+			}
+			case EScriptKeys::FILE_CHECKSUM:
+			{
+				job.AddEntry(e.keyStr)->value = static_cast<bool>(_flowsheet.GetParameters()->fileChecksumFlag);
+				break;
+			}
+			case EScriptKeys::FILE_CHUNK_SIZE:
+			{
+				job.AddEntry(e.keyStr)->value = static_cast<uint64_t>(_flowsheet.GetParameters()->fileChunkSize);
+				break;
+			}
+			case EScriptKeys::FILE_CACHE_SIZE:
+			{
+				job.AddEntry(e.keyStr)->value = static_cast<uint64_t>(_flowsheet.GetParameters()->fileCacheSize);
+				break;
+			}
+			case EScriptKeys::FILE_INCREMENTAL:
+			{
+				job.AddEntry(e.keyStr)->value = static_cast<bool>(_flowsheet.GetParameters()->fileIncrementalFlag);
+				break;
+			}
 			case EScriptKeys::COMPOUNDS:
 			{
 				job.AddEntry(e.keyStr)->value = _materialsDB.GetCompoundsNames(_flowsheet.GetCompounds());
@@ -366,10 +396,17 @@ namespace ScriptInterface
 				}
 				break;
 			}
+			case EScriptKeys::WARM_START_TEAR_STREAMS:
+			case EScriptKeys::SWEEP_PARAMETER:
+			case EScriptKeys::SWEEP_METHOD:
+			case EScriptKeys::SWEEP_SAMPLES:
+			case EScriptKeys::SWEEP_SEED:
 			case EScriptKeys::EXPORT_FILE:
+			case EScriptKeys::EXPORT_FORMAT:
 			case EScriptKeys::EXPORT_PRECISION:
 			case EScriptKeys::EXPORT_FIXED_POINT:
 			case EScriptKeys::EXPORT_SIGNIFICANCE_LIMIT:
+			case EScriptKeys::LAZY_LOADING:
 			case EScriptKeys::EXPORT_ONLY:
 			case EScriptKeys::EXPORT_STREAM_MASS:
 			case EScriptKeys::EXPORT_STREAM_TEMPERATURE:
@@ -389,6 +426,7 @@ namespace ScriptInterface
 			case EScriptKeys::EXPORT_HOLDUP_DISTRIBUTIONS:
 			case EScriptKeys::EXPORT_UNIT_STATE_VARIABLE:
 			case EScriptKeys::EXPORT_UNIT_PLOT:
+			case EScriptKeys::EXPORT_SOLVERS_STATISTICS:
 				break;
 			}
 		}
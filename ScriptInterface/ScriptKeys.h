@@ -43,6 +43,7 @@ namespace ScriptInterface
 		RESULT_FILE                      ,
 		MATERIALS_DATABASE               ,
 		MODELS_PATH                      ,
+		LAZY_LOADING                     ,
 		SIMULATION_TIME                  ,
 		RELATIVE_TOLERANCE               ,
 		ABSOLUTE_TOLERANCE               ,
@@ -64,6 +65,13 @@ namespace ScriptInterface
 		RELAXATION_PARAMETER             ,
 		ACCELERATION_LIMIT               ,
 		EXTRAPOLATION_METHOD             ,
+		WARM_START_TEAR_STREAMS          ,
+		FILE_COMPRESSION                 ,
+		FILE_SHUFFLE                     ,
+		FILE_CHECKSUM                    ,
+		FILE_CHUNK_SIZE                  ,
+		FILE_CACHE_SIZE                  ,
+		FILE_INCREMENTAL                 ,
 		COMPOUNDS                        ,
 		PHASES                           ,
 		KEEP_EXISTING_GRIDS_VALUES       ,
@@ -78,7 +86,12 @@ namespace ScriptInterface
 		HOLDUP_PHASES                    ,
 		HOLDUP_COMPOUNDS                 ,
 		HOLDUP_DISTRIBUTION              ,
+		SWEEP_PARAMETER                  ,
+		SWEEP_METHOD                     ,
+		SWEEP_SAMPLES                    ,
+		SWEEP_SEED                       ,
 		EXPORT_FILE                      ,
+		EXPORT_FORMAT                    ,
 		EXPORT_PRECISION                 ,
 		EXPORT_FIXED_POINT               ,
 		EXPORT_SIGNIFICANCE_LIMIT        ,
@@ -101,6 +114,7 @@ namespace ScriptInterface
 		EXPORT_HOLDUP_DISTRIBUTIONS      ,
 		EXPORT_UNIT_STATE_VARIABLE       ,
 		EXPORT_UNIT_PLOT                 ,
+		EXPORT_SOLVERS_STATISTICS        ,
 	};
 
 	// All possible types of script entries.
@@ -126,6 +140,7 @@ namespace ScriptInterface
 		EXPORT_HOLDUP      , // SExportHoldupSE
 		EXPORT_STATE_VAR   , // SExportStateVarSE
 		EXPORT_PLOT        , // SExportPlotSE
+		SWEEP_PARAMETER    , // SSweepParameterSE
 	};
 
 	// Descriptor for an entry of the script file.
@@ -143,7 +158,8 @@ namespace ScriptInterface
 		std::variant<bool, int64_t, uint64_t, double, std::string, std::vector<std::string>, std::filesystem::path,
 			SNamedEnum, SUnitParameterSE, SHoldupDependentSE, SHoldupCompoundsSE, SHoldupDistributionSE,
 			SGridDimensionSE, SPhasesSE, SStreamSE,
-			SExportStreamSE, SExportHoldupSE, SExportStateVarSE, SExportPlotSE> value{};
+			SExportStreamSE, SExportHoldupSE, SExportStateVarSE, SExportPlotSE,
+			SSweepParameterSE> value{};
 
 		SScriptEntry() = default;
 		SScriptEntry(const SScriptEntryDescriptor& _descr) : SScriptEntryDescriptor{ _descr } {}
@@ -174,6 +190,7 @@ namespace ScriptInterface
 		case EEntryType::EXPORT_HOLDUP:			_entry.value = StringFunctions::GetValueFromStream<SExportHoldupSE>(is);									break;
 		case EEntryType::EXPORT_STATE_VAR:		_entry.value = StringFunctions::GetValueFromStream<SExportStateVarSE>(is);									break;
 		case EEntryType::EXPORT_PLOT:			_entry.value = StringFunctions::GetValueFromStream<SExportPlotSE>(is);										break;
+		case EEntryType::SWEEP_PARAMETER:		_entry.value = StringFunctions::GetValueFromStream<SSweepParameterSE>(is);									break;
 		}
 	}
 
@@ -203,6 +220,7 @@ namespace ScriptInterface
 		case EEntryType::EXPORT_HOLDUP:			{ os << std::get<SExportHoldupSE>(_entry.value);																	break; }
 		case EEntryType::EXPORT_STATE_VAR:		{ os << std::get<SExportStateVarSE>(_entry.value);																	break; }
 		case EEntryType::EXPORT_PLOT:			{ os << std::get<SExportPlotSE>(_entry.value);																		break; }
+		case EEntryType::SWEEP_PARAMETER:		{ os << std::get<SSweepParameterSE>(_entry.value);																	break; }
 		}
 		os << std::endl;
 	}
@@ -226,6 +244,7 @@ namespace ScriptInterface
 		MAKE_SED(EScriptKeys::RESULT_FILE                      , EEntryType::PATH)               ,
 		MAKE_SED(EScriptKeys::MATERIALS_DATABASE               , EEntryType::PATH)               ,
 		MAKE_SED(EScriptKeys::MODELS_PATH                      , EEntryType::PATH)               ,
+		MAKE_SED(EScriptKeys::LAZY_LOADING                     , EEntryType::BOOL)               ,
 		// flowsheet parameters
 		MAKE_SED(EScriptKeys::SIMULATION_TIME                  , EEntryType::DOUBLE)             ,
 		MAKE_SED(EScriptKeys::RELATIVE_TOLERANCE               , EEntryType::DOUBLE)             ,
@@ -248,6 +267,13 @@ namespace ScriptInterface
 		MAKE_SED(EScriptKeys::RELAXATION_PARAMETER             , EEntryType::DOUBLE)             ,
 		MAKE_SED(EScriptKeys::ACCELERATION_LIMIT               , EEntryType::DOUBLE)             ,
 		MAKE_SED(EScriptKeys::EXTRAPOLATION_METHOD             , EEntryType::NAME_OR_KEY)        ,
+		MAKE_SED(EScriptKeys::WARM_START_TEAR_STREAMS          , EEntryType::BOOL)               ,
+		MAKE_SED(EScriptKeys::FILE_COMPRESSION                 , EEntryType::UINT)               ,
+		MAKE_SED(EScriptKeys::FILE_SHUFFLE                     , EEntryType::BOOL)               ,
+		MAKE_SED(EScriptKeys::FILE_CHECKSUM                    , EEntryType::BOOL)               ,
+		MAKE_SED(EScriptKeys::FILE_CHUNK_SIZE                  , EEntryType::UINT)               ,
+		MAKE_SED(EScriptKeys::FILE_CACHE_SIZE                  , EEntryType::UINT)               ,
+		MAKE_SED(EScriptKeys::FILE_INCREMENTAL                 , EEntryType::BOOL)               ,
 		// flowsheet settings
 		MAKE_SED(EScriptKeys::COMPOUNDS                        , EEntryType::STRINGS)            ,
 		MAKE_SED(EScriptKeys::PHASES                           , EEntryType::PHASES)             ,
@@ -264,8 +290,14 @@ namespace ScriptInterface
 		MAKE_SED(EScriptKeys::HOLDUP_PHASES                    , EEntryType::HOLDUP_DEPENDENT)   ,
 		MAKE_SED(EScriptKeys::HOLDUP_COMPOUNDS                 , EEntryType::HOLDUP_COMPOUNDS)   ,
 		MAKE_SED(EScriptKeys::HOLDUP_DISTRIBUTION              , EEntryType::HOLDUP_DISTRIBUTION),
+		// parameter sweep
+		MAKE_SED(EScriptKeys::SWEEP_PARAMETER                  , EEntryType::SWEEP_PARAMETER)    ,
+		MAKE_SED(EScriptKeys::SWEEP_METHOD                     , EEntryType::NAME_OR_KEY)        ,
+		MAKE_SED(EScriptKeys::SWEEP_SAMPLES                    , EEntryType::UINT)               ,
+		MAKE_SED(EScriptKeys::SWEEP_SEED                       , EEntryType::UINT)               ,
 		// export
 		MAKE_SED(EScriptKeys::EXPORT_FILE                      , EEntryType::PATH)               ,
+		MAKE_SED(EScriptKeys::EXPORT_FORMAT                    , EEntryType::NAME_OR_KEY)        ,
 		MAKE_SED(EScriptKeys::EXPORT_PRECISION                 , EEntryType::INT)                ,
 		MAKE_SED(EScriptKeys::EXPORT_FIXED_POINT               , EEntryType::BOOL)               ,
 		MAKE_SED(EScriptKeys::EXPORT_SIGNIFICANCE_LIMIT        , EEntryType::DOUBLE)             ,
@@ -288,6 +320,7 @@ namespace ScriptInterface
 		MAKE_SED(EScriptKeys::EXPORT_HOLDUP_DISTRIBUTIONS      , EEntryType::EXPORT_HOLDUP)      ,
 		MAKE_SED(EScriptKeys::EXPORT_UNIT_STATE_VARIABLE       , EEntryType::EXPORT_STATE_VAR)   ,
 		MAKE_SED(EScriptKeys::EXPORT_UNIT_PLOT                 , EEntryType::EXPORT_PLOT)        ,
+		MAKE_SED(EScriptKeys::EXPORT_SOLVERS_STATISTICS        , EEntryType::BOOL)               ,
 	};
 
 	// Returns a vector of string representations all possible script keys.
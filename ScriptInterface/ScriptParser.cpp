@@ -82,5 +82,9 @@ void CScriptParser::NamesToKeys() const
 			param->FillAndWarn<EConvergenceMethod>();
 		for (auto* param : job->GetValuesPtr<SNamedEnum>(EScriptKeys::EXTRAPOLATION_METHOD))
 			param->FillAndWarn<EExtrapolationMethod>();
+		for (auto* param : job->GetValuesPtr<SNamedEnum>(EScriptKeys::EXPORT_FORMAT))
+			param->FillAndWarn<EExportFormat>();
+		for (auto* param : job->GetValuesPtr<SNamedEnum>(EScriptKeys::SWEEP_METHOD))
+			param->FillAndWarn<ESweepMethod>();
 	}
 }
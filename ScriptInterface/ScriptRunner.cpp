@@ -4,18 +4,47 @@
 
 #include "ScriptRunner.h"
 #include "ScriptJob.h"
+#include "ParameterSweep.h"
+#include "ResultsExporter.h"
 #include "SaveLoadManager.h"
 #include "DyssolStringConstants.h"
 #include "DyssolUtilities.h"
+#include "ContainerFunctions.h"
+#include "ThreadPool.h"
 #include <sstream>
 #include <fstream>
 #include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
 
 using namespace ScriptInterface;
 using namespace StrConst;
 namespace fs = std::filesystem;
 namespace ch = std::chrono;
 
+CScriptRunner::CScriptRunner(const CMaterialsDatabase* _materialsDatabase, CModelsManager* _modelsManager, std::ostream& _output)
+	: m_sharedMaterialsDatabase{ _materialsDatabase }
+	, m_sharedModelsManager{ _modelsManager }
+	, m_output{ &_output }
+{
+	m_simulator.GetLog().SetConsole(_output);
+}
+
+CScriptRunner::CScriptRunner(const CFlowsheet& _flowsheet, const CMaterialsDatabase* _materialsDatabase, CModelsManager* _modelsManager, std::ostream& _output)
+	: m_sharedMaterialsDatabase{ _materialsDatabase }
+	, m_sharedModelsManager{ _modelsManager }
+	, m_output{ &_output }
+	, m_flowsheet{ _flowsheet }
+{
+	m_simulator.GetLog().SetConsole(_output);
+}
+
+void CScriptRunner::SetSweepThreads(size_t _threads)
+{
+	m_sweepThreads = std::max<size_t>(_threads, 1);
+}
+
 bool CScriptRunner::RunJob(const CScriptJob& _job)
 {
 	const auto tStart = ch::steady_clock::now();
@@ -23,8 +52,15 @@ bool CScriptRunner::RunJob(const CScriptJob& _job)
 	Clear();
 	bool success = true;
 	if (success) success &= CreateFlowsheet(_job);
-	if (success) success &= RunSimulation(_job);
-	if (success) success &= ExportResults(_job);
+	if (_job.HasKey(EScriptKeys::SWEEP_PARAMETER))
+	{
+		if (success) success &= RunSweep(_job);
+	}
+	else
+	{
+		if (success) success &= RunSimulation(_job);
+		if (success) success &= ExportResults(_job);
+	}
 
 	const auto tEnd = ch::steady_clock::now();
 
@@ -39,6 +75,11 @@ bool CScriptRunner::RunJob(const CScriptJob& _job)
 	return success;
 }
 
+const std::vector<CScriptRunner::SSimulationStatistics>& CScriptRunner::GetStatistics() const
+{
+	return m_statistics;
+}
+
 bool CScriptRunner::CreateFlowsheet(const CScriptJob& _job)
 {
 	bool success = true;
@@ -63,15 +104,18 @@ bool CScriptRunner::LoadFiles(const CScriptJob& _job)
 	// load materials database
 	const auto MDBfile = fs::absolute(_job.GetValue<fs::path>(EScriptKeys::MATERIALS_DATABASE).make_preferred());
 	PrintMessage(DyssolC_LoadMDB(MDBfile.string()));
-	if (!m_materialsDatabase.LoadFromFile(MDBfile))
+	if (!m_sharedMaterialsDatabase && !m_materialsDatabase.LoadFromFile(MDBfile))
 		return PrintMessage(DyssolC_ErrorMDB());
 
 	// set paths to models
-	auto modelsPaths = _job.GetValues<fs::path>(EScriptKeys::MODELS_PATH);
-	modelsPaths.insert(modelsPaths.begin(), fs::current_path()); // add current path
-	for (const auto& dir : modelsPaths)
-		m_modelsManager.AddDir(dir);
-	for (auto& dir : m_modelsManager.GetAllActiveDirFullPaths())
+	if (!m_sharedModelsManager)
+	{
+		auto modelsPaths = _job.GetValues<fs::path>(EScriptKeys::MODELS_PATH);
+		modelsPaths.insert(modelsPaths.begin(), fs::current_path()); // add current path
+		for (const auto& dir : modelsPaths)
+			m_modelsManager.AddDir(dir);
+	}
+	for (auto& dir : ModelsManager().GetAllActiveDirFullPaths())
 		PrintMessage(DyssolC_LoadModels(dir.make_preferred().string()));
 
 	// load flowsheet
@@ -84,8 +128,17 @@ bool CScriptRunner::LoadFiles(const CScriptJob& _job)
 		data.flowsheet = &m_flowsheet;
 
 		CSaveLoadManager loader{ data };
+		// when only exporting, distributions are read from file just for the exported streams
+		loader.SetLazyLoading(_job.HasKey(EScriptKeys::LAZY_LOADING) ? _job.GetValue<bool>(EScriptKeys::LAZY_LOADING) : onlyExport);
+		const auto tStart = ch::steady_clock::now();
 		if (!loader.LoadFromFile(srcFile))
 			return PrintMessage(DyssolC_ErrorLoad());
+		const auto elapsed_time = ch::steady_clock::now() - tStart;
+		const auto elapsed_s = ch::duration_cast<ch::seconds>(elapsed_time);
+		const auto elapsed_ms = ch::duration_cast<ch::milliseconds>(elapsed_time - elapsed_s);
+		std::error_code ec;
+		const auto size = fs::file_size(loader.GetFileName(), ec);
+		PrintMessage(DyssolC_LoadFinished(elapsed_s.count(), elapsed_ms.count(), ec ? 0 : size));
 	}
 
 	return true;
@@ -276,6 +329,9 @@ bool CScriptRunner::SetupFlowsheetParameters(const CScriptJob& _job)
 	if (_job.HasKey(EScriptKeys::INIT_TIME_WINDOW))             params->InitTimeWindow                                       (_job.GetValue<double  >  (EScriptKeys::INIT_TIME_WINDOW             ));
 	if (_job.HasKey(EScriptKeys::SAVE_TIME_STEP_HINT))          params->SaveTimeStep                                         (_job.GetValue<double  >  (EScriptKeys::SAVE_TIME_STEP_HINT          ));
 	if (_job.HasKey(EScriptKeys::SAVE_FLAG_FOR_HOLDUPS))        params->SaveTimeStepFlagHoldups                              (_job.GetValue<bool    >  (EScriptKeys::SAVE_FLAG_FOR_HOLDUPS        ));
+	if (_job.HasKey(EScriptKeys::FILE_SHUFFLE))                 params->FileShuffleFlag                                      (_job.GetValue<bool    >  (EScriptKeys::FILE_SHUFFLE                 ));
+	if (_job.HasKey(EScriptKeys::FILE_CHECKSUM))                params->FileChecksumFlag                                     (_job.GetValue<bool    >  (EScriptKeys::FILE_CHECKSUM                ));
+	if (_job.HasKey(EScriptKeys::FILE_INCREMENTAL))             params->FileIncrementalFlag                                  (_job.GetValue<bool    >  (EScriptKeys::FILE_INCREMENTAL             ));
 	if (_job.HasKey(EScriptKeys::THERMO_TEMPERATURE_MIN))       params->EnthalpyMinT                                         (_job.GetValue<double  >  (EScriptKeys::THERMO_TEMPERATURE_MIN       ));
 	if (_job.HasKey(EScriptKeys::THERMO_TEMPERATURE_MAX))       params->EnthalpyMaxT                                         (_job.GetValue<double  >  (EScriptKeys::THERMO_TEMPERATURE_MAX       ));
 	if (_job.HasKey(EScriptKeys::MIN_TIME_WINDOW))              params->MinTimeWindow                                        (_job.GetValue<double  >  (EScriptKeys::MIN_TIME_WINDOW              ));
@@ -288,6 +344,9 @@ bool CScriptRunner::SetupFlowsheetParameters(const CScriptJob& _job)
 	if (_job.HasKey(EScriptKeys::ITERATIONS_UPPER_LIMIT))       params->ItersUpperLimit    (static_cast<uint32_t>            (_job.GetValue<uint64_t>  (EScriptKeys::ITERATIONS_UPPER_LIMIT)      ));
 	if (_job.HasKey(EScriptKeys::ITERATIONS_LOWER_LIMIT))       params->ItersLowerLimit    (static_cast<uint32_t>            (_job.GetValue<uint64_t>  (EScriptKeys::ITERATIONS_LOWER_LIMIT)      ));
 	if (_job.HasKey(EScriptKeys::ITERATIONS_UPPER_LIMIT_1ST))   params->Iters1stUpperLimit (static_cast<uint32_t>            (_job.GetValue<uint64_t>  (EScriptKeys::ITERATIONS_UPPER_LIMIT_1ST)  ));
+	if (_job.HasKey(EScriptKeys::FILE_COMPRESSION))             params->FileCompression    (static_cast<uint32_t>            (_job.GetValue<uint64_t>  (EScriptKeys::FILE_COMPRESSION)            ));
+	if (_job.HasKey(EScriptKeys::FILE_CHUNK_SIZE))              params->FileChunkSize      (static_cast<uint32_t>            (_job.GetValue<uint64_t>  (EScriptKeys::FILE_CHUNK_SIZE)             ));
+	if (_job.HasKey(EScriptKeys::FILE_CACHE_SIZE))              params->FileCacheSize      (static_cast<uint32_t>            (_job.GetValue<uint64_t>  (EScriptKeys::FILE_CACHE_SIZE)             ));
 	if (_job.HasKey(EScriptKeys::CONVERGENCE_METHOD))           params->ConvergenceMethod  (static_cast<EConvergenceMethod>  (_job.GetValue<SNamedEnum>(EScriptKeys::CONVERGENCE_METHOD).key      ));
 	if (_job.HasKey(EScriptKeys::EXTRAPOLATION_METHOD))         params->ExtrapolationMethod(static_cast<EExtrapolationMethod>(_job.GetValue<SNamedEnum>(EScriptKeys::EXTRAPOLATION_METHOD).key    ));
 
@@ -307,7 +366,9 @@ bool CScriptRunner::SetupUnitParameters(const CScriptJob& _job)
 		std::stringstream ss{ entry.values };	// create a stream with parameter values
 		param->ValueFromStream(ss);				// read unit parameter values
 		const auto [model, unit] = TryGetUnitAndModelPtr(EScriptKeys::UNIT_PARAMETER, entry.unit);
+		const CPortsManager ports{ model->GetPortsManager() };	// keep connections of ports loaded from file
 		model->DoCreateStructure();
+		model->GetPortsManager().CopyUserData(ports);
 	}
 
 	return true;
@@ -449,7 +510,7 @@ bool CScriptRunner::SetupHoldupsDistributions(const CScriptJob& _job)
 		if (manual && len != classes && len % (classes + 1) != 0 || !manual && len != 2 && len % 3 != 0)
 			return PrintMessage(DyssolC_ErrorArgumentsNumber(StrKey(EScriptKeys::HOLDUP_DISTRIBUTION), unit->GetName(), entry.holdup.name, entry.holdup.index));
 		// get and check compound key
-		const auto* compound = m_materialsDatabase.GetCompound(entry.compound) ? m_materialsDatabase.GetCompound(entry.compound) : m_materialsDatabase.GetCompoundByName(entry.compound);
+		const auto* compound = MaterialsDatabase().GetCompound(entry.compound) ? MaterialsDatabase().GetCompound(entry.compound) : MaterialsDatabase().GetCompoundByName(entry.compound);
 		const std::string key = compound ? compound->GetKey() : "";
 		if (!mix && key.empty())
 			return PrintMessage(DyssolC_ErrorNoCompound(StrKey(EScriptKeys::HOLDUP_DISTRIBUTION), unit->GetName(), entry.holdup.name, entry.holdup.index, key));
@@ -517,8 +578,15 @@ bool CScriptRunner::SaveFlowsheet(const CScriptJob& _job)
 	data.flowsheet = &m_flowsheet;
 
 	CSaveLoadManager saver{ data };
+	const auto tStart = ch::steady_clock::now();
 	if (!saver.SaveToFile(dstFile))
 		return PrintMessage(DyssolC_ErrorSave());
+	const auto elapsed_time = ch::steady_clock::now() - tStart;
+	const auto elapsed_s = ch::duration_cast<ch::seconds>(elapsed_time);
+	const auto elapsed_ms = ch::duration_cast<ch::milliseconds>(elapsed_time - elapsed_s);
+	std::error_code ec;
+	const auto size = fs::file_size(saver.GetFileName(), ec);
+	PrintMessage(DyssolC_SaveFinished(elapsed_s.count(), elapsed_ms.count(), ec ? 0 : size));
 	return true;
 }
 
@@ -526,12 +594,26 @@ bool CScriptRunner::RunSimulation(const CScriptJob& _job)
 {
 	if (_job.HasKey(EScriptKeys::EXPORT_ONLY) && _job.GetValue<bool>(EScriptKeys::EXPORT_ONLY)) return true;
 
+	if (!Simulate(_job)) return false;
+
+	// save simulation results
+	return SaveFlowsheet(_job);
+}
+
+bool CScriptRunner::Simulate(const CScriptJob& _job)
+{
 	// initialize flowsheet
 	PrintMessage(DyssolC_Initialize());
 	const std::string error = m_flowsheet.Initialize();
 	if (!error.empty())
 		return PrintMessage(DyssolC_ErrorInit(error));
 
+	// initialize tear streams with converged values of the previous simulation
+	const bool warmStart = _job.HasKey(EScriptKeys::WARM_START_TEAR_STREAMS) && _job.GetValue<bool>(EScriptKeys::WARM_START_TEAR_STREAMS);
+	const bool warmStarted = warmStart && RestoreTearStreams();
+	if (warmStart)
+		PrintMessage(warmStarted ? DyssolC_WarmStart() : DyssolC_WarmStartSkipped());
+
 	// run simulation
 	m_simulator.SetFlowsheet(&m_flowsheet);
 	PrintMessage(DyssolC_Start());
@@ -542,49 +624,121 @@ bool CScriptRunner::RunSimulation(const CScriptJob& _job)
 	const auto elapsed_s = ch::duration_cast<ch::seconds>(elapsed_time);
 	const auto elapsed_ms = ch::duration_cast<ch::milliseconds>(elapsed_time - elapsed_s);
 	PrintMessage(DyssolC_SimFinished(elapsed_s.count(), elapsed_ms.count()));
+	StoreStatistics(ch::duration<double>(elapsed_time).count());
 
-	// save simulation results
-	return SaveFlowsheet(_job);
+	const size_t iterations = m_simulator.GetIterationsNumber();
+	if (warmStarted)
+		PrintMessage(DyssolC_WarmStartIterations(iterations, m_tearStreams.iterations));
+	else
+		m_tearStreams.iterations = iterations;
+	if (!m_simulator.HasError())
+		StoreTearStreams();
+
+	return true;
+}
+
+void CScriptRunner::StoreStatistics(double _time)
+{
+	auto& statistics = m_statistics.emplace_back();
+	statistics.time = _time;
+	statistics.iterations = m_simulator.GetIterationsNumber();
+	const auto& unitsTime = m_simulator.GetUnitsTime();
+	for (const auto* unit : m_flowsheet.GetAllUnits())
+	{
+		const auto* model = unit->GetModel();
+		if (!model) continue;
+		const auto time = unitsTime.find(unit->GetKey());
+		statistics.units.push_back({ unit->GetName(), model->GetUnitName(), time != unitsTime.end() ? time->second : 0.0, model->GetSolversStatistics() });
+	}
+}
+
+void CScriptRunner::StoreTearStreams()
+{
+	const auto* sequence = m_flowsheet.GetCalculationSequence();
+	const double window = m_flowsheet.GetParameters()->initTimeWindow;
+	m_tearStreams.streams.clear();
+	for (size_t i = 0; i < sequence->PartitionsNumber(); ++i)
+	{
+		auto& partition = m_tearStreams.streams.emplace_back();
+		for (const auto* tear : sequence->PartitionTearStreams(i))
+		{
+			const auto& stream = partition.emplace_back(std::make_unique<CStream>());
+			stream->SetupStructure(tear);
+			stream->SetName(tear->GetName());
+			stream->CopyFromStream(0.0, window, tear);
+		}
+	}
+}
+
+bool CScriptRunner::RestoreTearStreams()
+{
+	auto* sequence = m_flowsheet.GetCalculationSequence();
+	const auto& stored = m_tearStreams.streams;
+
+	// tear streams must be the same in all partitions
+	if (sequence->PartitionsNumber() != stored.size()) return false;
+	bool any = false;
+	for (size_t i = 0; i < stored.size(); ++i)
+	{
+		const auto tears = sequence->PartitionTearStreams(i);
+		if (tears.size() != stored[i].size()) return false;
+		for (size_t j = 0; j < tears.size(); ++j)
+			if (tears[j]->GetName() != stored[i][j]->GetName() || !CBaseStream::HaveSameStructure(*tears[j], *stored[i][j]) || tears[j]->GetAllCompounds() != stored[i][j]->GetAllCompounds())
+				return false;
+		any |= !tears.empty();
+	}
+	if (!any) return false;
+
+	// replace initial values of tear streams
+	const double window = m_flowsheet.GetParameters()->initTimeWindow;
+	const auto inits = sequence->GetAllInitialStreams();
+	for (size_t i = 0; i < stored.size(); ++i)
+		for (size_t j = 0; j < stored[i].size(); ++j)
+		{
+			inits[i][j]->RemoveAllTimePoints();
+			inits[i][j]->CopyFromStream(0.0, window, stored[i][j].get());
+		}
+	return true;
 }
 
-// TODO: split
 bool CScriptRunner::ExportResults(const CScriptJob& _job)
 {
 	if (!_job.HasKey(EScriptKeys::EXPORT_FILE)) return true;
 
-	const auto exportFile = fs::absolute(_job.GetValue<fs::path>(EScriptKeys::EXPORT_FILE)).make_preferred();
-	PrintMessage(DyssolC_ExportResults(exportFile.string()));
+	PrintMessage(DyssolC_ExportResults(fs::absolute(_job.GetValue<fs::path>(EScriptKeys::EXPORT_FILE)).make_preferred().string()));
 
-	// open text file for export
-	std::ofstream file(exportFile);
-	if (!file)
-		return PrintMessage(DyssolC_ErrorExportFile());
+	CResultsExporter file;
+	if (!OpenExportFile(_job, file)) return false;
+	bool success = GatherResults(_job, [&](SExportTable&& _table) { file.Write(_table); });
+	// close file before exit
+	success &= file.Close();
+	return success;
+}
 
-	// setup export
-	if (_job.HasKey(EScriptKeys::EXPORT_PRECISION))
-		file.precision(_job.GetValue<int64_t>(EScriptKeys::EXPORT_PRECISION));
-	if (_job.HasKey(EScriptKeys::EXPORT_FIXED_POINT))
-		file.setf(_job.GetValue<bool>(EScriptKeys::EXPORT_FIXED_POINT) ? std::ios::fixed : std::ios::scientific);
+bool CScriptRunner::GatherResults(const CScriptJob& _job, const std::function<void(SExportTable&&)>& _write)
+{
 	const double limit = _job.HasKey(EScriptKeys::EXPORT_SIGNIFICANCE_LIMIT) ? std::abs(_job.GetValue<double>(EScriptKeys::EXPORT_SIGNIFICANCE_LIMIT)) : 0.0;
 	// replaces all values less than the limit with zeros
 	const auto Filter = [&](double v) { return limit == 0.0 ? v : std::abs(v) >= limit ? v : 0.0; };
 
-	// helper function to export values
-	const auto ExportValues = [&](const std::vector<double>& tp, const CBaseStream* s, const std::function<void(const CBaseStream*, double)>& fun)
+	// function to gather values of a stream at a time point
+	using gather_t = std::function<void(const CBaseStream*, double, std::vector<double>&)>;
+
+	// entry to export stream or holdup data
+	struct SStreamEntry
 	{
-		for (const double t : !tp.empty() ? tp : s->GetAllTimePoints())
-		{
-			file << " " << t;
-			fun(s, t);
-		}
-		file << std::endl;
+		const CBaseStream* stream;	// Stream or holdup.
+		std::vector<double> times;	// Time points to export, all if empty.
+		gather_t fun;				// Function to gather values.
+		SExportTable table;			// Gathered values.
 	};
+	std::vector<SStreamEntry> entries;
 
 	// flag to return
 	bool success{ true };
 
-	// helper function to export streams data
-	const auto ExportStreams = [&](const EScriptKeys& key, const std::string& tag, const std::function<void(const CBaseStream*, double)>& fun)
+	// helper function to collect streams entries
+	const auto ExportStreams = [&](const EScriptKeys& key, const std::string& tag, const gather_t& fun)
 	{
 		for (const auto& e : _job.GetValues<SExportStreamSE>(key))
 		{
@@ -592,14 +746,12 @@ bool CScriptRunner::ExportResults(const CScriptJob& _job)
 			const CBaseStream* stream = TryGetStreamPtr(key, e.stream);
 			success &= stream != nullptr;
 			if (!stream) continue;
-			// export
-			file << tag << " " << StringFunctions::Quote(stream->GetName());
-			ExportValues(e.times, stream, fun);
+			entries.push_back({ stream, e.times, fun, { tag, { stream->GetName() }, 1, 0, {} } });
 		}
 	};
 
-	// helper function to export holdups data
-	const auto ExportHoldups = [&](const EScriptKeys& key, const std::string& tag, const std::function<void(const CBaseStream*, double)>& fun)
+	// helper function to collect holdups entries
+	const auto ExportHoldups = [&](const EScriptKeys& key, const std::string& tag, const gather_t& fun)
 	{
 		for (const auto& e : _job.GetValues<SExportHoldupSE>(key))
 		{
@@ -607,53 +759,51 @@ bool CScriptRunner::ExportResults(const CScriptJob& _job)
 			auto [holdup, unit] = TryGetHoldupWorkPtr(key , e.unit, e.holdup);
 			success &= holdup != nullptr;
 			if (!holdup) continue;
-			// export
-			file << tag << " " << StringFunctions::Quote(unit->GetName()) << " " << StringFunctions::Quote(holdup->GetName());
-			ExportValues(e.times, holdup, fun);
+			entries.push_back({ holdup, e.times, fun, { tag, { unit->GetName(), holdup->GetName() }, 1, 0, {} } });
 		}
 	};
 
-	// helper functions to export specific data
-	const auto ExportMass = [&](const CBaseStream* s, double t)
+	// helper functions to gather specific data
+	const auto ExportMass = [&](const CBaseStream* s, double t, std::vector<double>& res)
 	{
-		file << " " << Filter(s->GetMass(t));
+		res.push_back(Filter(s->GetMass(t)));
 	};
-	const auto ExportTemperature = [&](const CBaseStream* s, double t)
+	const auto ExportTemperature = [&](const CBaseStream* s, double t, std::vector<double>& res)
 	{
-		file << " " << Filter(s->GetTemperature(t));
+		res.push_back(Filter(s->GetTemperature(t)));
 	};
-	const auto ExportPressure = [&](const CBaseStream* s, double t)
+	const auto ExportPressure = [&](const CBaseStream* s, double t, std::vector<double>& res)
 	{
-		file << " " << Filter(s->GetPressure(t));
+		res.push_back(Filter(s->GetPressure(t)));
 	};
-	const auto ExportOveralls = [&](const CBaseStream* s, double t)
+	const auto ExportOveralls = [&](const CBaseStream* s, double t, std::vector<double>& res)
 	{
 		for (const auto& o : m_flowsheet.GetOverallProperties())
-			file << " " << Filter(s->GetOverallProperty(t, o.type));
+			res.push_back(Filter(s->GetOverallProperty(t, o.type)));
 	};
-	const auto ExportPhases = [&](const CBaseStream* s, double t)
+	const auto ExportPhases = [&](const CBaseStream* s, double t, std::vector<double>& res)
 	{
 		for (const auto& p : m_flowsheet.GetPhases())
-			file << " " << Filter(s->GetPhaseFraction(t, p.state));
+			res.push_back(Filter(s->GetPhaseFraction(t, p.state)));
 	};
-	const auto ExportCompounds = [&](const CBaseStream* s, double t)
+	const auto ExportCompounds = [&](const CBaseStream* s, double t, std::vector<double>& res)
 	{
 		for (const auto& c : m_flowsheet.GetCompounds())
-			file << " " << Filter(s->GetCompoundFraction(t, c));
+			res.push_back(Filter(s->GetCompoundFraction(t, c)));
 	};
-	const auto ExportPSD = [&](const CBaseStream* s, double t)
+	const auto ExportPSD = [&](const CBaseStream* s, double t, std::vector<double>& res)
 	{
 		for (const double v : s->GetPSD(t, PSD_MassFrac))
-			file << " " << Filter(v);
+			res.push_back(Filter(v));
 	};
-	const auto ExportDistributions = [&](const CBaseStream* s, double t)
+	const auto ExportDistributions = [&](const CBaseStream* s, double t, std::vector<double>& res)
 	{
 		for (const auto& d : s->GetGrid().GetDimensionsTypes())
 			for (const double v : s->GetDistribution(t, d))
-				file << " " << Filter(v);
+				res.push_back(Filter(v));
 	};
 
-	// export streams' data
+	// streams' data
 	ExportStreams(EScriptKeys::EXPORT_STREAM_MASS               , "STREAM_MASS"         , ExportMass);
 	ExportStreams(EScriptKeys::EXPORT_STREAM_TEMPERATURE        , "STREAM_TEMPERATURE"  , ExportTemperature);
 	ExportStreams(EScriptKeys::EXPORT_STREAM_PRESSURE           , "STREAM_PRESSURE"     , ExportPressure);
@@ -663,7 +813,7 @@ bool CScriptRunner::ExportResults(const CScriptJob& _job)
 	ExportStreams(EScriptKeys::EXPORT_STREAM_PSD                , "STREAM_PSD"          , ExportPSD);
 	ExportStreams(EScriptKeys::EXPORT_STREAM_DISTRIBUTIONS      , "STREAM_DISTRIBUTIONS", ExportDistributions);
 
-	// export holdups' data
+	// holdups' data
 	ExportHoldups(EScriptKeys::EXPORT_HOLDUP_MASS               , "HOLDUP_MASS"         , ExportMass);
 	ExportHoldups(EScriptKeys::EXPORT_HOLDUP_TEMPERATURE        , "HOLDUP_TEMPERATURE"  , ExportTemperature);
 	ExportHoldups(EScriptKeys::EXPORT_HOLDUP_PRESSURE           , "HOLDUP_PRESSURE"     , ExportPressure);
@@ -673,6 +823,37 @@ bool CScriptRunner::ExportResults(const CScriptJob& _job)
 	ExportHoldups(EScriptKeys::EXPORT_HOLDUP_PSD                , "HOLDUP_PSD"          , ExportPSD);
 	ExportHoldups(EScriptKeys::EXPORT_HOLDUP_DISTRIBUTIONS      , "HOLDUP_DISTRIBUTIONS", ExportDistributions);
 
+	// gather values of streams and holdups in parallel; all entries of one stream are processed by the same thread, since reading of stream data is not thread-safe
+	std::map<const CBaseStream*, std::vector<size_t>> byStream;
+	for (size_t i = 0; i < entries.size(); ++i)
+		byStream[entries[i].stream].push_back(i);
+	const std::vector<std::vector<size_t>> groups = MapValues(byStream);
+	// finished tables are written in the order of entries, so only the tables, which wait for previous ones, are kept in memory
+	std::vector<bool> finished(entries.size(), false);
+	size_t written{ 0 };
+	std::mutex mutex;
+	ParallelFor(groups.size(), [&](size_t g)
+	{
+		for (const size_t i : groups[g])
+		{
+			auto& [stream, times, fun, table] = entries[i];
+			std::vector<double> row;
+			for (const double t : !times.empty() ? times : stream->GetAllTimePoints())
+			{
+				row.assign(1, t);
+				fun(stream, t, row);
+				table.columns = row.size();
+				table.values.insert(table.values.end(), row.begin(), row.end());
+			}
+			const std::lock_guard lock{ mutex };
+			finished[i] = true;
+			for (; written < entries.size() && finished[written]; ++written)
+				_write(std::move(entries[written].table));
+		}
+		// release data loaded from file on demand, they are not needed anymore
+		entries[groups[g].front()].stream->UnloadFileData();
+	});
+
 	// export state variables
 	for (const auto& e : _job.GetValues<SExportStateVarSE>(EScriptKeys::EXPORT_UNIT_STATE_VARIABLE))
 	{
@@ -681,16 +862,16 @@ bool CScriptRunner::ExportResults(const CScriptJob& _job)
 		success &= variable != nullptr;
 		if (!variable) continue;
 		// export
-		file << "UNIT_STATE_VAR" << " " << StringFunctions::Quote(variable->GetName());
+		SExportTable table{ "UNIT_STATE_VAR", { variable->GetName() }, 2, 0, {} };
 		if (!variable->HasHistory())
-			file << " " << variable->GetValue();
+			table = { "UNIT_STATE_VAR", { variable->GetName() }, 1, 0, { variable->GetValue() } };
 		else if (e.times.empty())
 			for (const auto& v : variable->GetHistory())
-				file << " " << v.time << " " << Filter(v.value);
+				table.values.insert(table.values.end(), { v.time, Filter(v.value) });
 		else
 			for (const double t : e.times)
-				file << " " << t << " " << Filter(variable->GetHistoryValue(t));
-		file << std::endl;
+				table.values.insert(table.values.end(), { t, Filter(variable->GetHistoryValue(t)) });
+		_write(std::move(table));
 	}
 
 	// export plots
@@ -701,23 +882,229 @@ bool CScriptRunner::ExportResults(const CScriptJob& _job)
 		success &= curve != nullptr;
 		if (!curve) continue;
 		// export
-		file << "UNIT_PLOT" << " " << StringFunctions::Quote(plot->GetName()) << " " << StringFunctions::Quote(curve->GetName());
+		SExportTable table{ "UNIT_PLOT", { plot->GetName(), curve->GetName() }, 2, 0, {} };
 		for (const auto& p : curve->GetPoints())
-			file << " " << p.x << " " << p.y;
-		file << std::endl;
+			table.values.insert(table.values.end(), { p.x, p.y });
+		_write(std::move(table));
 	}
 
-	// close file before exit
-	file.close();
+	// export statistics of equation solvers
+	if (_job.HasKey(EScriptKeys::EXPORT_SOLVERS_STATISTICS) && _job.GetValue<bool>(EScriptKeys::EXPORT_SOLVERS_STATISTICS))
+		for (const auto* unit : m_flowsheet.GetAllUnits())
+		{
+			const auto* model = unit->GetModel();
+			if (!model) continue;
+			for (const auto& [name, s] : model->GetSolversStatistics())
+				_write({ "SOLVER_STATISTICS", { unit->GetName(), name }, 11, 8, {
+					static_cast<double>(s.calls), static_cast<double>(s.steps), static_cast<double>(s.residualEvaluations), static_cast<double>(s.jacobianEvaluations),
+					static_cast<double>(s.linearSolverSetups), static_cast<double>(s.nonlinearIterations), static_cast<double>(s.nonlinearFailures), static_cast<double>(s.errorTestFailures),
+					s.lastStep, s.solverTime, s.residualTime } });
+		}
 
 	return success;
 }
 
+bool CScriptRunner::OpenExportFile(const CScriptJob& _job, CResultsExporter& _file)
+{
+	// open file for export
+	const auto exportFile = fs::absolute(_job.GetValue<fs::path>(EScriptKeys::EXPORT_FILE)).make_preferred();
+	const auto format = _job.HasKey(EScriptKeys::EXPORT_FORMAT) ? static_cast<EExportFormat>(_job.GetValue<SNamedEnum>(EScriptKeys::EXPORT_FORMAT).key) : EExportFormat::TEXT;
+	if (!_file.Open(exportFile, format, CSaveLoadManager::StorageSettings(*m_flowsheet.GetParameters())))
+		return PrintMessage(DyssolC_ErrorExportFile());
+
+	// setup export
+	if (_job.HasKey(EScriptKeys::EXPORT_PRECISION))
+		_file.SetPrecision(static_cast<int>(_job.GetValue<int64_t>(EScriptKeys::EXPORT_PRECISION)));
+	if (_job.HasKey(EScriptKeys::EXPORT_FIXED_POINT))
+		_file.SetFixedPoint(_job.GetValue<bool>(EScriptKeys::EXPORT_FIXED_POINT));
+
+	return true;
+}
+
+bool CScriptRunner::RunSweep(const CScriptJob& _job)
+{
+	const auto params = _job.GetValues<SSweepParameterSE>(EScriptKeys::SWEEP_PARAMETER);
+
+	// check swept parameters
+	std::vector<SSweepRange> ranges;
+	std::vector<EUnitParameter> types;
+	std::vector<std::string> names;
+	for (const auto& e : params)
+	{
+		const auto* param = TryGetUnitParamPtr(EScriptKeys::SWEEP_PARAMETER, e.unit, e.param);
+		if (!param) return false;
+		const auto type = param->GetType();
+		if (type != EUnitParameter::CONSTANT && type != EUnitParameter::CONSTANT_DOUBLE && type != EUnitParameter::CONSTANT_INT64 && type != EUnitParameter::CONSTANT_UINT64)
+			return PrintMessage(DyssolC_ErrorSweepParameter(StrKey(EScriptKeys::SWEEP_PARAMETER), GetUnitPtr(e.unit)->GetName(), param->GetName()));
+		ranges.push_back({ e.min, e.max, e.points });
+		types.push_back(type);
+		names.insert(names.end(), { GetUnitPtr(e.unit)->GetName(), param->GetName() });
+	}
+
+	// generate values of parameters for all runs
+	const auto method = _job.HasKey(EScriptKeys::SWEEP_METHOD) ? static_cast<ESweepMethod>(_job.GetValue<SNamedEnum>(EScriptKeys::SWEEP_METHOD).key) : ESweepMethod::GRID;
+	const size_t samples = _job.HasKey(EScriptKeys::SWEEP_SAMPLES) ? _job.GetValue<uint64_t>(EScriptKeys::SWEEP_SAMPLES) : 10;
+	const uint64_t seed = _job.HasKey(EScriptKeys::SWEEP_SEED) ? _job.GetValue<uint64_t>(EScriptKeys::SWEEP_SEED) : 0;
+	auto values = method == ESweepMethod::LATIN_HYPERCUBE ? ParameterSweep::LatinHypercube(ranges, samples, seed) : ParameterSweep::Grid(ranges);
+	if (values.empty())
+		return PrintMessage(DyssolC_ErrorSweepNoRuns(StrKey(EScriptKeys::SWEEP_PARAMETER)));
+	// integer parameters get the nearest allowed value
+	for (auto& run : values)
+		for (size_t i = 0; i < types.size(); ++i)
+			if (types[i] == EUnitParameter::CONSTANT_INT64)
+				run[i] = std::round(run[i]);
+			else if (types[i] == EUnitParameter::CONSTANT_UINT64)
+				run[i] = std::round(std::max(run[i], 0.0));
+
+	const bool warmStart = _job.HasKey(EScriptKeys::WARM_START_TEAR_STREAMS) && _job.GetValue<bool>(EScriptKeys::WARM_START_TEAR_STREAMS);
+	const size_t threads = std::min(m_sweepThreads, values.size());
+	PrintMessage(DyssolC_RunSweep(values.size(), threads));
+
+	// results of all runs are exported into one file, each run starts with its number, success flag and values of parameters
+	const bool exportResults = _job.HasKey(EScriptKeys::EXPORT_FILE);
+	CResultsExporter file;
+	if (exportResults)
+	{
+		PrintMessage(DyssolC_ExportResults(fs::absolute(_job.GetValue<fs::path>(EScriptKeys::EXPORT_FILE)).make_preferred().string()));
+		if (!OpenExportFile(_job, file)) return false;
+	}
+
+	// state of each run
+	struct SRun
+	{
+		std::ostringstream output;						// All messages of the run.
+		std::vector<SExportTable> tables;				// Exported results.
+		std::vector<SSimulationStatistics> statistics;	// Performance statistics of simulations.
+		STearStreams tears;								// Tear streams of the simulation.
+		bool success{ false };							// Whether the run has been executed successfully.
+		bool finished{ false };							// Whether the run is finished.
+		std::exception_ptr exception;					// Exception thrown during execution.
+	};
+	std::vector<SRun> runs(values.size());
+	size_t started{ 0 };	// Number of started runs.
+	size_t printed{ 0 };	// Number of runs, whose messages are already printed.
+	STearStreams lastTears;	// Tear streams of the last successful run among the printed ones.
+	std::mutex mutex;		// Guards states of runs and the output.
+
+	// executes runs as long as there are any not started ones
+	const auto Worker = [&]
+	{
+		std::unique_lock lock{ mutex };
+		while (started < runs.size())
+		{
+			const size_t i = started++;
+			auto& run = runs[i];
+			try
+			{
+				run.output << DyssolC_StartSweepRun(i + 1, runs.size()) << std::endl;
+				// copies are created one by one, since reading of stream data is not thread-safe
+				CScriptRunner runner{ m_flowsheet, &MaterialsDatabase(), &ModelsManager(), run.output };
+				// all runs start from the tear streams of the previous job, so results do not depend on the order in which runs finish
+				if (warmStart)
+				{
+					for (const auto& partition : m_tearStreams.streams)
+						runner.m_tearStreams.streams.push_back(DeepCopy(partition));
+					runner.m_tearStreams.iterations = m_tearStreams.iterations;
+				}
+				lock.unlock();
+				run.success = runner.RunSweepPoint(_job, params, values[i], run.tables);
+				run.statistics = std::move(runner.m_statistics);
+				run.tears = std::move(runner.m_tearStreams);
+			}
+			catch (...)
+			{
+				run.exception = std::current_exception();
+			}
+			if (!lock.owns_lock())
+				lock.lock();
+			run.finished = true;
+			// print messages and write results in the order of runs
+			for (; printed < runs.size() && runs[printed].finished; ++printed)
+			{
+				*m_output << runs[printed].output.str() << std::flush;
+				runs[printed].output = std::ostringstream{};
+				if (runs[printed].success && !runs[printed].tears.streams.empty())
+					lastTears = std::move(runs[printed].tears);
+				if (!exportResults) continue;
+				SExportTable header{ "SWEEP_RUN", names, 2 + params.size(), 2, { static_cast<double>(printed + 1), runs[printed].success ? 1.0 : 0.0 } };
+				header.values.insert(header.values.end(), values[printed].begin(), values[printed].end());
+				file.Write(header);
+				for (const auto& table : runs[printed].tables)
+					file.Write(table);
+				runs[printed].tables = std::vector<SExportTable>{};
+			}
+		}
+	};
+
+	std::vector<std::thread> workers;
+	for (size_t i = 1; i < threads; ++i)
+		workers.emplace_back(Worker);
+	Worker();
+	for (auto& worker : workers)
+		worker.join();
+	const bool written = !exportResults || file.Close();
+
+	// pass exceptions to the caller, as in a single run
+	for (const auto& run : runs)
+		if (run.exception)
+			std::rethrow_exception(run.exception);
+
+	bool success = std::all_of(runs.begin(), runs.end(), [](const SRun& _run) { return _run.success; });
+	for (auto& run : runs)
+		m_statistics.insert(m_statistics.end(), run.statistics.begin(), run.statistics.end());
+
+	// the following jobs start from the tear streams of the last successful run in the order of the sweep
+	if (!lastTears.streams.empty())
+		m_tearStreams = std::move(lastTears);
+
+	return success && written;
+}
+
+bool CScriptRunner::RunSweepPoint(const CScriptJob& _job, const std::vector<SSweepParameterSE>& _params, const std::vector<double>& _values, std::vector<SExportTable>& _tables)
+{
+	// set values of swept parameters
+	for (size_t i = 0; i < _params.size(); ++i)
+	{
+		auto* param = TryGetUnitParamPtr(EScriptKeys::SWEEP_PARAMETER, _params[i].unit, _params[i].param);
+		if (!param) return false;
+		switch (param->GetType())
+		{
+		case EUnitParameter::CONSTANT:
+		case EUnitParameter::CONSTANT_DOUBLE:	dynamic_cast<CConstRealUnitParameter*>(param)->SetValue(_values[i]);						break;
+		case EUnitParameter::CONSTANT_INT64:	dynamic_cast<CConstIntUnitParameter*>(param)->SetValue(static_cast<int64_t>(_values[i]));	break;
+		case EUnitParameter::CONSTANT_UINT64:	dynamic_cast<CConstUIntUnitParameter*>(param)->SetValue(static_cast<uint64_t>(_values[i]));	break;
+		default: break;
+		}
+	}
+
+	if (!Simulate(_job)) return false;
+	bool success = !m_simulator.HasError();
+	if (_job.HasKey(EScriptKeys::EXPORT_FILE))
+		success &= GatherResults(_job, [&](SExportTable&& _table) { _tables.push_back(std::move(_table)); });
+	return success;
+}
+
 void CScriptRunner::Clear()
 {
 	m_flowsheet.Clear();
 	m_modelsManager.Clear();
 	m_materialsDatabase.Clear();
+	m_statistics.clear();
+}
+
+const CMaterialsDatabase& CScriptRunner::MaterialsDatabase() const
+{
+	return m_sharedMaterialsDatabase ? *m_sharedMaterialsDatabase : m_materialsDatabase;
+}
+
+CModelsManager& CScriptRunner::ModelsManager()
+{
+	return m_sharedModelsManager ? *m_sharedModelsManager : m_modelsManager;
+}
+
+const CModelsManager& CScriptRunner::ModelsManager() const
+{
+	return m_sharedModelsManager ? *m_sharedModelsManager : m_modelsManager;
 }
 
 CUnitContainer* CScriptRunner::TryGetUnitPtr(EScriptKeys _sk, const SNameOrIndex& _unit)
@@ -772,7 +1159,7 @@ std::tuple<CBaseStream*, CUnitContainer*> CScriptRunner::TryGetHoldupWorkPtr(ESc
 	return std::make_tuple(holdup, unit);
 }
 
-CCompound* CScriptRunner::TryGetCompoundPtr(EScriptKeys _sk, const std::string& _compound)
+const CCompound* CScriptRunner::TryGetCompoundPtr(EScriptKeys _sk, const std::string& _compound)
 {
 	auto* compound = GetCompoundPtr(_compound);
 	if (!compound) PrintMessage(DyssolC_ErrorNoCompounds(StrKey(_sk), _compound));
@@ -859,10 +1246,10 @@ CBaseStream* CScriptRunner::GetHoldupWorkPtr(CBaseUnit* _model, const SNameOrInd
 	return holdup;														// return pointer
 }
 
-CCompound* CScriptRunner::GetCompoundPtr(const std::string& _nameOrKey)
+const CCompound* CScriptRunner::GetCompoundPtr(const std::string& _nameOrKey)
 {
-	auto* compound = m_materialsDatabase.GetCompound(_nameOrKey);					// try to access by key
-	if (!compound) compound = m_materialsDatabase.GetCompoundByName(_nameOrKey);	// try to access by name
+	auto* compound = MaterialsDatabase().GetCompound(_nameOrKey);					// try to access by key
+	if (!compound) compound = MaterialsDatabase().GetCompoundByName(_nameOrKey);	// try to access by name
 	return compound;
 }
 
@@ -904,7 +1291,7 @@ const CCurve* CScriptRunner::GetCurvePtr(const CPlot* _plot, const SNameOrIndex&
 std::string CScriptRunner::GetModelKey(const std::string& _value) const
 {
 	std::error_code ec;	// to use non-throwing version of fs::equivalent
-	for (const auto& m : m_modelsManager.GetAvailableUnits())
+	for (const auto& m : ModelsManager().GetAvailableUnits())
 	{
 		if (m.uniqueID == _value ||									// try to access by ID
 			m.name == _value ||										// try to access by name
@@ -914,8 +1301,8 @@ std::string CScriptRunner::GetModelKey(const std::string& _value) const
 	return {};
 }
 
-bool CScriptRunner::PrintMessage(const std::string& _message)
+bool CScriptRunner::PrintMessage(const std::string& _message) const
 {
-	std::cout << _message << std::endl;
+	*m_output << _message << std::endl;
 	return false;
 }
@@ -5,29 +5,80 @@
 #include "MaterialsDatabase.h"
 #include "ModelsManager.h"
 #include "Simulator.h"
+#include "SolverStatistics.h"
+#include <functional>
+#include <iostream>
 
 class CBaseStream;
 class CBaseUnitParameter;
 class CScriptJob;
+class CResultsExporter;
+struct SExportTable;
 namespace ScriptInterface
 {
 	enum class EScriptKeys;
 	struct SNameOrIndex;
+	struct SSweepParameterSE;
 }
 
 /* Executes a script job. */
 class CScriptRunner
 {
+public:
+	// Performance statistics of one simulation.
+	struct SSimulationStatistics
+	{
+		// Performance statistics of one unit.
+		struct SUnit
+		{
+			std::string name;												// Name of the unit.
+			std::string model;												// Name of the model.
+			double time{};													// Wall-clock time spent in initialization and simulation of the unit [s].
+			std::vector<std::pair<std::string, SSolverStatistics>> solvers;	// Statistics of equation solvers of the unit.
+		};
+
+		double time{};				// Wall-clock time of the simulation [s].
+		size_t iterations{};		// Number of iterations over tear streams.
+		std::vector<SUnit> units;	// Statistics of all units.
+	};
+
+private:
+	// Converged tear streams of a previous simulation, used to initialize tear streams of the following ones.
+	struct STearStreams
+	{
+		std::vector<std::vector<std::unique_ptr<CStream>>> streams;	// Tear streams of each partition on the initial time window.
+		size_t iterations{ 0 };										// Number of iterations in the last simulation without initialization.
+	};
+
 	CMaterialsDatabase m_materialsDatabase{};							// Database of materials.
 	CModelsManager m_modelsManager{};									// Units and solvers manager.
-	CFlowsheet m_flowsheet{ &m_modelsManager, &m_materialsDatabase };	// Flowsheet.
+	const CMaterialsDatabase* m_sharedMaterialsDatabase{};				// Database of materials loaded in advance and shared with other runners. If set, used instead of own database.
+	CModelsManager* m_sharedModelsManager{};							// Units and solvers manager set up in advance and shared with other runners. If set, used instead of own manager.
+	std::ostream* m_output{ &std::cout };								// Stream for all messages.
+	size_t m_sweepThreads{ 1 };											// Number of runs of a parameter sweep executed at the same time.
+	CFlowsheet m_flowsheet{ &ModelsManager(), &MaterialsDatabase() };	// Flowsheet.
 	CSimulator m_simulator{};											// Simulator.
+	STearStreams m_tearStreams{};										// Tear streams of the previous simulation.
+	std::vector<SSimulationStatistics> m_statistics{};					// Performance statistics of all simulations of the last job.
 
 public:
+	CScriptRunner() = default;
+	// Creates a runner that uses the given materials database and models manager, if they are set, instead of loading its own ones, and writes all messages to _output.
+	CScriptRunner(const CMaterialsDatabase* _materialsDatabase, CModelsManager* _modelsManager, std::ostream& _output);
+
+	// Sets the number of runs of a parameter sweep executed at the same time.
+	void SetSweepThreads(size_t _threads);
+
 	// Executes the job. Returns success flag.
 	bool RunJob(const CScriptJob& _job);
 
+	// Returns performance statistics of all simulations of the last executed job.
+	[[nodiscard]] const std::vector<SSimulationStatistics>& GetStatistics() const;
+
 private:
+	// Creates a runner for one run of a parameter sweep, which works on a copy of the given flowsheet.
+	CScriptRunner(const CFlowsheet& _flowsheet, const CMaterialsDatabase* _materialsDatabase, CModelsManager* _modelsManager, std::ostream& _output);
+
 	// Reads the simulation settings from the job and creates a flowsheet. Returns success flag.
 	bool CreateFlowsheet(const CScriptJob& _job);
 
@@ -62,18 +113,41 @@ private:
 
 	// Saves the flowsheet. Returns success flag.
 	bool SaveFlowsheet(const CScriptJob& _job);
-	// Performs the simulation. Returns success flag.
+	// Performs the simulation and saves results. Returns success flag.
 	bool RunSimulation(const CScriptJob& _job);
+	// Initializes and simulates the flowsheet. Returns success flag of the initialization.
+	bool Simulate(const CScriptJob& _job);
+	// Collects performance statistics of the last simulation.
+	void StoreStatistics(double _time);
+	// Stores tear streams of the simulated flowsheet to initialize the following simulations.
+	void StoreTearStreams();
+	// Initializes tear streams of the flowsheet with the stored ones, if the flowsheet has the same tear streams. Returns whether tear streams were initialized.
+	bool RestoreTearStreams();
 	// Exports results from file.
 	bool ExportResults(const CScriptJob& _job);
+	// Gathers all exported results of the flowsheet and passes each table to _write as soon as it and all previous tables are complete. Returns success flag.
+	bool GatherResults(const CScriptJob& _job, const std::function<void(SExportTable&&)>& _write);
+	// Opens the export file and sets up its format. Returns success flag.
+	bool OpenExportFile(const CScriptJob& _job, CResultsExporter& _file);
+
+	// Simulates copies of the flowsheet for all sampled values of swept parameters and exports their results. Returns success flag.
+	bool RunSweep(const CScriptJob& _job);
+	// Sets the values of swept parameters, simulates the flowsheet and gathers its results. Returns success flag.
+	bool RunSweepPoint(const CScriptJob& _job, const std::vector<ScriptInterface::SSweepParameterSE>& _params, const std::vector<double>& _values, std::vector<SExportTable>& _tables);
 
 	// Clears current state of the runner.
 	void Clear();
 
+	// Returns the used materials database: shared or own one.
+	[[nodiscard]] const CMaterialsDatabase& MaterialsDatabase() const;
+	// Returns the used models manager: shared or own one.
+	[[nodiscard]] CModelsManager& ModelsManager();
+	[[nodiscard]] const CModelsManager& ModelsManager() const;
+
 	// Tries to obtain a pointer to a required unit. Prints error message and returns nullptr if the search fails.
 	CUnitContainer* TryGetUnitPtr(ScriptInterface::EScriptKeys _sk, const ScriptInterface::SNameOrIndex& _unit);
 	// Tries to obtain a pointer to a required model. Prints error message and returns nullptr if the search fails.
-	static CBaseUnit* TryGetModelPtr(ScriptInterface::EScriptKeys _sk, CUnitContainer* _unit);
+	CBaseUnit* TryGetModelPtr(ScriptInterface::EScriptKeys _sk, CUnitContainer* _unit);
 	// Tries to obtain a pointer to a required model and unit. Prints error message and returns nullptr if the search fails.
 	std::tuple<CBaseUnit*, CUnitContainer*> TryGetUnitAndModelPtr(ScriptInterface::EScriptKeys _sk, const ScriptInterface::SNameOrIndex& _unit);
 	// Tries to obtain a pointer to a required stream. Prints error message and returns nullptr if the search fails.
@@ -85,7 +159,7 @@ private:
 	// Tries to obtain a pointer to a required holdup with final values. Prints error message and returns nullptr if the search fails.
 	std::tuple<CBaseStream*, CUnitContainer*> TryGetHoldupWorkPtr(ScriptInterface::EScriptKeys _sk, const ScriptInterface::SNameOrIndex& _unit, const ScriptInterface::SNameOrIndex& _holdup);
 	// Tries to obtain a pointer to required compound. Prints error message and returns nullptr if the search fails.
-	CCompound* TryGetCompoundPtr(ScriptInterface::EScriptKeys _sk, const std::string& _compound);
+	const CCompound* TryGetCompoundPtr(ScriptInterface::EScriptKeys _sk, const std::string& _compound);
 	// Tries to obtain a pointer to required port. Prints error message and returns nullptr if the search fails.
 	CUnitPort* TryGetPortPtr(ScriptInterface::EScriptKeys _sk, const ScriptInterface::SNameOrIndex& _unit, const ScriptInterface::SNameOrIndex& _port);
 	// Tries to obtain a pointer to required state variable. Prints error message and returns nullptr if the search fails.
@@ -108,7 +182,7 @@ private:
 	// Returns a pointer to a holdup with final values by its name or index. Returns nullptr if the search fails.
 	static CBaseStream* GetHoldupWorkPtr(CBaseUnit* _model, const ScriptInterface::SNameOrIndex& _nameOrIndex);
 	// Returns a pointer to a compound by its name or key. Returns nullptr if the search fails.
-	CCompound* GetCompoundPtr(const std::string& _nameOrKey);
+	const CCompound* GetCompoundPtr(const std::string& _nameOrKey);
 	// Returns a pointer to a unit port by its name or index. Returns nullptr if the search fails.
 	static CUnitPort* GetPortPtr(CBaseUnit* _model, const ScriptInterface::SNameOrIndex& _nameOrIndex);
 	// Returns a pointer to a state variable by its name or index. Returns nullptr if the search fails.
@@ -120,6 +194,6 @@ private:
 	// Returns a unique key of a model, trying to find it by its ID, name and file path. Returns empty string if the search fails.
 	std::string GetModelKey(const std::string& _value) const;
 
-	// Prints the message to the console and returns false.
-	static bool PrintMessage(const std::string& _message);
+	// Prints the message to the output stream and returns false.
+	bool PrintMessage(const std::string& _message) const;
 };
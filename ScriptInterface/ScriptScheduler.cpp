@@ -0,0 +1,161 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#include "ScriptScheduler.h"
+#include "ScriptJob.h"
+#include "ScriptRunner.h"
+#include "DyssolStringConstants.h"
+#include <algorithm>
+#include <iostream>
+#include <thread>
+
+using namespace ScriptInterface;
+using namespace StrConst;
+namespace fs = std::filesystem;
+
+CScriptScheduler::CScriptScheduler(size_t _threads)
+	: m_threads{ std::max<size_t>(_threads, 1) }
+{
+}
+
+bool CScriptScheduler::Run(const std::vector<const CScriptJob*>& _jobs)
+{
+	Prepare(_jobs);
+
+	std::vector<std::thread> threads;
+	for (size_t i = 0; i < std::min(m_threads, m_jobs.size()); ++i)
+		threads.emplace_back(&CScriptScheduler::Worker, this);
+	for (auto& thread : threads)
+		thread.join();
+
+	// pass exceptions to the caller, as in sequential execution
+	for (const auto& job : m_jobs)
+		if (job->exception)
+			std::rethrow_exception(job->exception);
+
+	return std::all_of(m_jobs.begin(), m_jobs.end(), [](const auto& _job) { return _job->success; });
+}
+
+void CScriptScheduler::Prepare(const std::vector<const CScriptJob*>& _jobs)
+{
+	m_jobs.clear();
+	m_printed = 0;
+
+	std::vector<std::vector<fs::path>> read, written;
+	for (size_t i = 0; i < _jobs.size(); ++i)
+	{
+		auto& job = *m_jobs.emplace_back(std::make_unique<SJob>());
+		job.job = _jobs[i];
+		job.index = i;
+
+		// a job must wait for previous jobs, which write files used by it or read files written by it
+		read.push_back(ReadFiles(*_jobs[i]));
+		written.push_back(WrittenFiles(*_jobs[i]));
+		const auto Intersect = [](const std::vector<fs::path>& _v1, const std::vector<fs::path>& _v2)
+		{
+			return std::any_of(_v1.begin(), _v1.end(), [&](const auto& _p) { return std::find(_v2.begin(), _v2.end(), _p) != _v2.end(); });
+		};
+		for (size_t j = 0; j < i; ++j)
+			if (Intersect(written[j], read[i]) || Intersect(written[j], written[i]) || Intersect(read[j], written[i]))
+				job.dependencies.push_back(j);
+
+		// materials database is loaded only once for all jobs using it; if loading fails, the job loads it itself and reports the error
+		const auto mdbFile = NormalPath(_jobs[i]->GetValue<fs::path>(EScriptKeys::MATERIALS_DATABASE));
+		if (!m_databases.count(mdbFile))
+		{
+			auto database = std::make_unique<CMaterialsDatabase>();
+			m_databases[mdbFile] = database->LoadFromFile(mdbFile) ? std::move(database) : nullptr;
+		}
+		job.materialsDatabase = m_databases[mdbFile].get();
+
+		// models are searched only once for all jobs with the same paths
+		auto modelsPaths = _jobs[i]->GetValues<fs::path>(EScriptKeys::MODELS_PATH);
+		modelsPaths.insert(modelsPaths.begin(), fs::current_path()); // add current path
+		auto& manager = m_managers[modelsPaths];
+		if (!manager)
+		{
+			manager = std::make_unique<CModelsManager>();
+			for (const auto& dir : modelsPaths)
+				manager->AddDir(dir);
+		}
+		job.modelsManager = manager.get();
+	}
+}
+
+void CScriptScheduler::Worker()
+{
+	std::unique_lock lock{ m_mutex };
+	while (true)
+	{
+		// the first waiting job, whose dependencies are all finished
+		const auto it = std::find_if(m_jobs.begin(), m_jobs.end(), [&](const auto& _job)
+		{
+			return _job->state == EState::WAITING && std::all_of(_job->dependencies.begin(), _job->dependencies.end(), [&](size_t _i) { return m_jobs[_i]->state == EState::FINISHED; });
+		});
+		if (it == m_jobs.end())
+		{
+			if (std::none_of(m_jobs.begin(), m_jobs.end(), [](const auto& _job) { return _job->state == EState::WAITING; }))
+				return;
+			m_event.wait(lock);
+			continue;
+		}
+
+		SJob& job = **it;
+		job.state = EState::RUNNING;
+		lock.unlock();
+
+		job.output << DyssolC_StartJob(job.index + 1) << std::endl;
+		try
+		{
+			CScriptRunner runner{ job.materialsDatabase, job.modelsManager, job.output };
+			job.success = runner.RunJob(*job.job);
+		}
+		catch (...)
+		{
+			job.exception = std::current_exception();
+		}
+
+		lock.lock();
+		job.state = EState::FINISHED;
+		PrintFinished();
+		m_event.notify_all();
+	}
+}
+
+void CScriptScheduler::PrintFinished()
+{
+	for (; m_printed < m_jobs.size() && m_jobs[m_printed]->state == EState::FINISHED; ++m_printed)
+	{
+		std::cout << m_jobs[m_printed]->output.str() << std::flush;
+		m_jobs[m_printed]->output = std::ostringstream{};
+	}
+}
+
+std::vector<fs::path> CScriptScheduler::ReadFiles(const CScriptJob& _job)
+{
+	std::vector<fs::path> res;
+	if (_job.HasKey(EScriptKeys::SOURCE_FILE))
+		res.push_back(NormalPath(_job.GetValue<fs::path>(EScriptKeys::SOURCE_FILE)));
+	return res;
+}
+
+std::vector<fs::path> CScriptScheduler::WrittenFiles(const CScriptJob& _job)
+{
+	std::vector<fs::path> res;
+	const bool onlyExport = _job.HasKey(EScriptKeys::EXPORT_ONLY) && _job.GetValue<bool>(EScriptKeys::EXPORT_ONLY);
+	if (!onlyExport)
+	{
+		if (_job.HasKey(EScriptKeys::RESULT_FILE))
+			res.push_back(NormalPath(_job.GetValue<fs::path>(EScriptKeys::RESULT_FILE)));
+		else if (_job.HasKey(EScriptKeys::SOURCE_FILE))
+			res.push_back(NormalPath(_job.GetValue<fs::path>(EScriptKeys::SOURCE_FILE)));
+	}
+	if (_job.HasKey(EScriptKeys::EXPORT_FILE))
+		res.push_back(NormalPath(_job.GetValue<fs::path>(EScriptKeys::EXPORT_FILE)));
+	return res;
+}
+
+fs::path CScriptScheduler::NormalPath(const fs::path& _path)
+{
+	return fs::absolute(_path).lexically_normal().make_preferred();
+}
@@ -0,0 +1,70 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+#include "MaterialsDatabase.h"
+#include "ModelsManager.h"
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+class CScriptJob;
+
+/*
+ * Executes script jobs in parallel, each with its own script runner.
+ * A job starts only after all previous jobs working with the same files are finished.
+ * Materials databases and models managers are prepared once and shared between all jobs using them.
+ * Messages of each job are collected separately and printed after the job is finished, in the order of jobs.
+ */
+class CScriptScheduler
+{
+	// State of a job.
+	enum class EState { WAITING, RUNNING, FINISHED };
+
+	// Job with its execution data.
+	struct SJob
+	{
+		const CScriptJob* job{};							// Script job.
+		size_t index{};										// Index of the job in the script.
+		std::vector<size_t> dependencies;					// Indices of previous jobs, which must be finished before this job starts.
+		const CMaterialsDatabase* materialsDatabase{};		// Shared materials database, if it has been loaded.
+		CModelsManager* modelsManager{};					// Shared models manager.
+		std::ostringstream output;							// All messages of the job.
+		EState state{ EState::WAITING };					// Current state.
+		bool success{ false };								// Whether the job has been executed successfully.
+		std::exception_ptr exception;						// Exception thrown during execution.
+	};
+
+	size_t m_threads{ 1 };																		// Number of jobs executed at the same time.
+	std::vector<std::unique_ptr<SJob>> m_jobs;													// All jobs.
+	std::map<std::filesystem::path, std::unique_ptr<CMaterialsDatabase>> m_databases;			// Shared materials databases by their files.
+	std::map<std::vector<std::filesystem::path>, std::unique_ptr<CModelsManager>> m_managers;	// Shared models managers by their paths to models.
+	size_t m_printed{ 0 };																		// Number of jobs, whose messages are already printed.
+	std::mutex m_mutex;																			// Guards states of jobs.
+	std::condition_variable m_event;															// Notifies about finished jobs.
+
+public:
+	// Creates a scheduler that executes up to _threads jobs at the same time.
+	explicit CScriptScheduler(size_t _threads);
+
+	// Executes all jobs. Returns success flag.
+	bool Run(const std::vector<const CScriptJob*>& _jobs);
+
+private:
+	// Determines dependencies between jobs and prepares shared materials databases and models managers.
+	void Prepare(const std::vector<const CScriptJob*>& _jobs);
+	// Executes jobs as long as there are any waiting ones.
+	void Worker();
+	// Prints messages of all finished jobs that are not yet printed, keeping the order of jobs. Must be called with the locked mutex.
+	void PrintFinished();
+
+	// Returns all files read by the job.
+	static std::vector<std::filesystem::path> ReadFiles(const CScriptJob& _job);
+	// Returns all files written by the job.
+	static std::vector<std::filesystem::path> WrittenFiles(const CScriptJob& _job);
+	// Returns absolute normalized path to the file.
+	static std::filesystem::path NormalPath(const std::filesystem::path& _path);
+};
@@ -46,6 +46,22 @@ namespace ScriptInterface
 		return _s;
 	}
 
+	std::istream& operator>>(std::istream& _s, SSweepParameterSE& _obj)
+	{
+		_obj.unit  = GetValueFromStream<SNameOrIndex>(_s);
+		_obj.param = GetValueFromStream<SNameOrIndex>(_s);
+		_obj.min   = GetValueFromStream<double>(_s);
+		_obj.max   = GetValueFromStream<double>(_s);
+		if (const auto points = GetValueFromStream<uint64_t>(_s)) // optional
+			_obj.points = points;
+		return _s;
+	}
+	std::ostream& operator<<(std::ostream& _s, const SSweepParameterSE& _obj)
+	{
+		_s << _obj.unit << " " << _obj.param << " " << _obj.min << " " << _obj.max << " " << _obj.points;
+		return _s;
+	}
+
 	std::istream& operator>>(std::istream& _s, SHoldupDependentSE& _obj)
 	{
 		_obj.unit   = GetValueFromStream<SNameOrIndex>(_s);
@@ -58,6 +58,18 @@ namespace ScriptInterface
 		friend std::ostream& operator<<(std::ostream& _s, const SUnitParameterSE& _obj);
 	};
 
+	// Struct to parse script entries (SE) with swept unit parameters.
+	struct SSweepParameterSE
+	{
+		SNameOrIndex unit{};	// Name or index of the unit container.
+		SNameOrIndex param{};	// Name or index of the parameter.
+		double min{};			// Minimum value of the parameter.
+		double max{};			// Maximum value of the parameter.
+		uint64_t points{ 2 };	// Number of values within the range for grid sampling.
+		friend std::istream& operator>>(std::istream& _s, SSweepParameterSE& _obj);
+		friend std::ostream& operator<<(std::ostream& _s, const SSweepParameterSE& _obj);
+	};
+
 	// Struct to parse script entries (SE) with unit holdups' time-dependent parameters (overall, phases).
 	struct SHoldupDependentSE
 	{
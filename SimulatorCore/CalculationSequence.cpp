@@ -368,6 +368,13 @@ void CCalculationSequence::UpdateCacheSettings(const SCacheSettings& _cache)
 			str->SetCacheSettings(_cache);
 }
 
+void CCalculationSequence::DetachFromFile()
+{
+	for (auto& part : m_initialTearStreams)
+		for (auto& str : part)
+			str->DetachFromFile();
+}
+
 void CCalculationSequence::UpdateToleranceSettings(const SToleranceSettings& _tolerance)
 {
 	for (auto& part : m_initialTearStreams)
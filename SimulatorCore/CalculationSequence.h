@@ -155,6 +155,8 @@ public:
 
 	// Updates cache settings in all initial tear streams.
 	void UpdateCacheSettings(const SCacheSettings& _cache);
+	// Loads all data, which are loaded from file on demand, in all initial tear streams and releases the file.
+	void DetachFromFile();
 	// Updates tolerance settings in all initial tear streams.
 	void UpdateToleranceSettings(const SToleranceSettings& _tolerance);
 	// Updates thermodynamics settings in all initial tear streams.
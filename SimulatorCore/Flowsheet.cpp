@@ -8,6 +8,8 @@
 #include "DyssolStringConstants.h"
 #include "DyssolUtilities.h"
 #include "H5Handler.h"
+#include "ThreadPool.h"
+#include <deque>
 
 CFlowsheet::CFlowsheet(CModelsManager* _modelsManager, const CMaterialsDatabase* _materialsDB)
 	: m_materialsDB{ _materialsDB }
@@ -18,6 +20,7 @@ CFlowsheet::CFlowsheet(CModelsManager* _modelsManager, const CMaterialsDatabase*
 
 CFlowsheet::CFlowsheet(const CFlowsheet& _other)
 	: m_fileName{ _other.m_fileName }
+	, m_lazySource{ _other.m_lazySource }
 	, m_materialsDB{ _other.m_materialsDB }
 	, m_modelsManager{ _other.m_modelsManager }
 	, m_parameters{ _other.m_parameters }
@@ -27,7 +30,8 @@ CFlowsheet::CFlowsheet(const CFlowsheet& _other)
 	, m_cacheStreams{ _other.m_cacheStreams }
 	, m_cacheHoldups{ _other.m_cacheHoldups }
 	, m_tolerance{ _other.m_tolerance }
-	, m_thermodynamics{ _other.m_thermodynamics }
+	// the copy gets its own cache of enthalpy tables, since the cache is cleared when any of the flowsheets is initialized
+	, m_thermodynamics{ _other.m_thermodynamics.limits, _other.m_thermodynamics.intervals, std::make_shared<CMixtureEnthalpyCache>(_other.m_thermodynamics.cache->GetCapacity(), _other.m_thermodynamics.cache->GetResolution()) }
 	, m_units{ DeepCopy(_other.m_units) }
 	, m_streams{ DeepCopy(_other.m_streams) }
 	, m_streamsI{ DeepCopy(_other.m_streamsI) }
@@ -35,6 +39,11 @@ CFlowsheet::CFlowsheet(const CFlowsheet& _other)
 	, m_topologyModified{ _other.m_topologyModified }
 {
 	m_calculationSequence.SetPointers(&m_units, &m_streams);
+	// copied units still refer to the structures of the other flowsheet
+	for (auto& unit : m_units)
+		unit->SetPointers(m_materialsDB, &m_mainGrid, &m_overall, &m_phases, &m_cacheHoldups, &m_tolerance, &m_thermodynamics);
+	// copied streams still use the cache of the other flowsheet
+	UpdateThermodynamicsSettings();
 }
 
 CFlowsheet::CFlowsheet(CFlowsheet&& _other) noexcept
@@ -59,6 +68,7 @@ void swap(CFlowsheet& _first, CFlowsheet& _second) noexcept
 {
 	using std::swap;
 	swap(_first.m_fileName           , _second.m_fileName);
+	swap(_first.m_lazySource         , _second.m_lazySource);
 	swap(_first.m_materialsDB        , _second.m_materialsDB);
 	swap(_first.m_modelsManager      , _second.m_modelsManager);
 	swap(_first.m_parameters         , _second.m_parameters);
@@ -86,6 +96,11 @@ std::filesystem::path CFlowsheet::GetFileName() const
 	return m_fileName;
 }
 
+std::filesystem::path CFlowsheet::GetLazySource() const
+{
+	return m_lazySource;
+}
+
 void CFlowsheet::Create()
 {
 	m_mainGrid.AddSymbolicDimension(DISTR_COMPOUNDS);
@@ -113,8 +128,9 @@ void CFlowsheet::Clear()
 	// set the topology is modified
 	SetTopologyModified(true);
 
-	// clear file name
+	// clear file names
 	m_fileName.clear();
+	m_lazySource.clear();
 
 	// initialize flowsheet with default structure
 	Create();
@@ -324,11 +340,11 @@ std::vector<CStream*> CFlowsheet::GetAllStreams()
 bool CFlowsheet::DetermineCalculationSequence()
 {
 	// TODO: move the whole function into CalculationSequence
-	// returns unique key of a stream connecting two units
+	// returns unique key of a stream going from the source unit to the destination unit
 	const auto ConnectionStreamKey = [&](size_t _iSrcUnit, size_t _iDstUnit) -> std::string
 	{
-		for (const auto& srcPort : m_units[_iSrcUnit]->GetModel()->GetPortsManager().GetAllPorts())
-			for (const auto& dstPort : m_units[_iDstUnit]->GetModel()->GetPortsManager().GetAllPorts())
+		for (const auto& srcPort : m_units[_iSrcUnit]->GetModel()->GetPortsManager().GetAllOutputPorts())
+			for (const auto& dstPort : m_units[_iDstUnit]->GetModel()->GetPortsManager().GetAllInputPorts())
 				if (srcPort->GetStreamKey() == dstPort->GetStreamKey())
 					return srcPort->GetStream()->GetKey();
 		return {};
@@ -645,6 +661,8 @@ std::string CFlowsheet::Initialize()
 {
 	// clear previous results
 	ClearSimulationResults();
+	// materials database could have been changed since the last run
+	m_thermodynamics.cache->Clear();
 
 	// check that all units have assigned models
 	for (const auto& unit : m_units)
@@ -837,6 +855,17 @@ void CFlowsheet::UpdateCacheSettings()
 	m_calculationSequence.UpdateCacheSettings(m_cacheStreams);
 }
 
+void CFlowsheet::DetachFromFile()
+{
+	for (auto& stream : m_streams)
+		stream->DetachFromFile();
+	for (auto& unit : m_units)
+		if (auto* model = unit->GetModel())
+			model->DetachFromFile();
+	m_calculationSequence.DetachFromFile();
+	m_lazySource.clear();
+}
+
 void CFlowsheet::UpdateToleranceSettings()
 {
 	m_tolerance = { m_parameters.absTol, m_parameters.relTol, m_parameters.minFraction };
@@ -851,7 +880,8 @@ void CFlowsheet::UpdateToleranceSettings()
 
 void CFlowsheet::UpdateThermodynamicsSettings()
 {
-	m_thermodynamics = { { m_parameters.enthalpyMinT, m_parameters.enthalpyMaxT }, m_parameters.enthalpyInt };
+	m_thermodynamics.limits = { m_parameters.enthalpyMinT, m_parameters.enthalpyMaxT };
+	m_thermodynamics.intervals = m_parameters.enthalpyInt;
 
 	for (auto& stream : m_streams)
 		stream->SetThermodynamicsSettings(m_thermodynamics);
@@ -909,17 +939,23 @@ bool CFlowsheet::SaveToFile(CH5Handler& _h5File, const std::string& _path)
 	// current version of save procedure
 	_h5File.WriteAttribute(_path, StrConst::H5AttrSaveVersion, m_saveVersion);
 
-	// units
+	// units and streams
 	_h5File.WriteAttribute(_path, StrConst::Flow_H5AttrUnitsNum, static_cast<int>(m_units.size()));
 	const std::string unitsGroup = _h5File.CreateGroup(_path, StrConst::Flow_H5GroupUnits);
-	for (size_t i = 0; i < m_units.size(); ++i)
-		m_units[i]->SaveToFile(_h5File, _h5File.CreateGroup(unitsGroup, StrConst::Flow_H5GroupUnitName + std::to_string(i)));
-
-	// streams
 	_h5File.WriteAttribute(_path, StrConst::Flow_H5AttrStreamsNum, static_cast<int>(m_streams.size()));
 	const std::string streamsGroup = _h5File.CreateGroup(_path, StrConst::Flow_H5GroupStreams);
+	std::vector<std::pair<std::string, std::string>> groups;
+	for (size_t i = 0; i < m_units.size(); ++i)
+		groups.emplace_back(unitsGroup, StrConst::Flow_H5GroupUnitName + std::to_string(i));
 	for (size_t i = 0; i < m_streams.size(); ++i)
-		m_streams[i]->SaveToFile(_h5File, _h5File.CreateGroup(streamsGroup, StrConst::Flow_H5GroupStreamName + std::to_string(i)));
+		groups.emplace_back(streamsGroup, StrConst::Flow_H5GroupStreamName + std::to_string(i));
+	SaveToFileParallel(_h5File, groups, [&](size_t _i, CH5Handler& _h5, const std::string& _group)
+	{
+		if (_i < m_units.size())
+			m_units[_i]->SaveToFile(_h5, _group);
+		else
+			m_streams[_i - m_units.size()]->SaveToFile(_h5, _group);
+	});
 
 	// calculation sequence
 	m_calculationSequence.SaveToFile(_h5File, _h5File.CreateGroup(_path, StrConst::Flow_H5GroupCalcSeq));
@@ -954,10 +990,60 @@ bool CFlowsheet::SaveToFile(CH5Handler& _h5File, const std::string& _path)
 	return true;
 }
 
+void CFlowsheet::SaveToFileParallel(CH5Handler& _h5File, const std::vector<std::pair<std::string, std::string>>& _groups, const std::function<void(size_t, CH5Handler&, const std::string&)>& _save)
+{
+	// one thread of the pool always stays free, in case saving functions use the pool themselves;
+	// this also limits the number of objects kept in memory at once
+	const size_t window = getThreadPool().GetThreadsNumber() > 1 ? getThreadPool().GetThreadsNumber() - 1 : 0;
+	// objects are saved directly when appending, since they need to read what is already stored in the file
+	if (window == 0 || _h5File.IsAppending())
+	{
+		for (size_t i = 0; i < _groups.size(); ++i)
+			_save(i, _h5File, _h5File.CreateGroup(_groups[i].first, _groups[i].second));
+		return;
+	}
+
+	std::vector<CH5Handler> buffers(_groups.size());
+	std::vector<std::exception_ptr> errors(_groups.size());
+	std::deque<ThreadPool::CTaskFuture<void>> futures;
+	size_t submitted = 0;
+	for (size_t i = 0; i < _groups.size(); ++i)
+	{
+		// serialize the next objects in parallel
+		for (; submitted < _groups.size() && submitted < i + window; ++submitted)
+			futures.push_back(ParallelJob([&, j = submitted]
+			{
+				try
+				{
+					buffers[j].CreateDeferred();
+					_save(j, buffers[j], _groups[j].first + "/" + _groups[j].second);
+				}
+				catch (...)
+				{
+					errors[j] = std::current_exception();
+				}
+			}));
+		// wait until the current object is serialized
+		futures.pop_front();
+		if (errors[i])
+		{
+			futures.clear();
+			std::rethrow_exception(errors[i]);
+		}
+		// write it to the file
+		[[maybe_unused]] const auto group = _h5File.CreateGroup(_groups[i].first, _groups[i].second);
+		_h5File.WriteDeferred(buffers[i]);
+	}
+}
+
 bool CFlowsheet::LoadFromFile(CH5Handler& _h5File, const std::string& _path)
 {
 	Clear();
 
+	// streams and units keep the file to read their distributed data later
+	if (_h5File.IsLazyLoading())
+		m_lazySource = _h5File.FileName();
+
 	// version of save procedure
 	const int version = _h5File.ReadAttribute(_path, StrConst::H5AttrSaveVersion);
 	if (version < 4)
@@ -10,6 +10,8 @@
 #include "ParametersHolder.h"
 #include "Phase.h"
 #include "MultidimensionalGrid.h"
+#include "MixtureEnthalpyCache.h"
+#include <functional>
 
 /*
  * Stores the whole information about the flowsheet.
@@ -27,6 +29,7 @@ class CFlowsheet
 	static constexpr unsigned m_saveVersion{ 5 };	// Current version of the saving procedure.
 
 	std::filesystem::path m_fileName{};		// Current file where the flowsheet is stored.
+	std::filesystem::path m_lazySource{};	// File from which the data of the flowsheet are still loaded on demand.
 
 	////////////////////////////////////////////////////////////////////////////////
 	// Global structural data and settings
@@ -41,7 +44,7 @@ class CFlowsheet
 	SCacheSettings m_cacheStreams{ m_parameters.cacheFlagStreams, m_parameters.cacheWindow, m_parameters.cachePath };				// Global cache settings for streams.
 	SCacheSettings m_cacheHoldups{ m_parameters.cacheFlagHoldups, m_parameters.cacheWindow, m_parameters.cachePath };				// Global cache settings for holdups in models.
 	SToleranceSettings m_tolerance{ m_parameters.absTol, m_parameters.relTol, m_parameters.minFraction };							// Global tolerance settings.
-	SThermodynamicsSettings m_thermodynamics{ { m_parameters.enthalpyMinT, m_parameters.enthalpyMaxT }, m_parameters.enthalpyInt };	// Global thermodynamics settings.
+	SThermodynamicsSettings m_thermodynamics{ { m_parameters.enthalpyMinT, m_parameters.enthalpyMaxT }, m_parameters.enthalpyInt, std::make_shared<CMixtureEnthalpyCache>() };	// Global thermodynamics settings.
 
 	////////////////////////////////////////////////////////////////////////////////
 	// Flowsheet structure
@@ -71,6 +74,12 @@ public:
 	 * \param _materialsDB Pointer to materials database.
 	 */
 	CFlowsheet(CModelsManager* _modelsManager, const CMaterialsDatabase* _materialsDB);
+	/**
+	 * \brief Copy constructor.
+	 * \details Creates an independent flowsheet sharing the models manager and the materials database.
+	 * Models of units are instantiated anew and receive all user-defined data, but not their simulation results.
+	 * \param _other Flowsheet to copy.
+	 */
 	CFlowsheet(const CFlowsheet& _other);
 	CFlowsheet(CFlowsheet&& _other) noexcept;
 	CFlowsheet& operator=(CFlowsheet _other);
@@ -94,6 +103,12 @@ public:
 	 * \return Full path to the file.
 	 */
 	[[nodiscard]] std::filesystem::path GetFileName() const;
+	/**
+	 * Returns the full name of the file, from which data of the flowsheet are loaded on demand.
+	 * \details Returns an empty path if all data are in memory.
+	 * \return Full path to the file.
+	 */
+	[[nodiscard]] std::filesystem::path GetLazySource() const;
 
 	// Makes initial preparations of the flowsheet structure.
 	void Create();
@@ -259,6 +274,8 @@ public:
 	void UpdateGrids();
 	// Updates cache settings in all units and streams.
 	void UpdateCacheSettings();
+	// Loads all data, which are loaded from file on demand, in all units and streams and releases the file. Must be called before the file is overwritten.
+	void DetachFromFile();
 	// Updates tolerance settings in all units and streams.
 	void UpdateToleranceSettings();
 	// Updates thermodynamics settings in all units and streams.
@@ -300,6 +317,8 @@ public:
 private:
 	// Loads the flowsheet from the HDF5 file. A compatibility version.
 	bool LoadFromFile_v3(CH5Handler& _h5File, const std::string& _path);
+	// Saves objects into groups _groups={parent, name} of the HDF5 file. Each object is serialized by _save(i, handler, group) in the thread pool into memory, and the results are written into the file by the calling thread in the order of objects.
+	static void SaveToFileParallel(CH5Handler& _h5File, const std::vector<std::pair<std::string, std::string>>& _groups, const std::function<void(size_t, CH5Handler&, const std::string&)>& _save);
 
 	// Returns a pointer to a stream with the specified unique key from the given vector. If no such stream defined, returns nullptr.
 	static CStream* DoGetStream(const std::string& _key, const std::vector<std::shared_ptr<CStream>>& _streams);
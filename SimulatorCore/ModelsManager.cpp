@@ -5,6 +5,10 @@
 #include "FileSystem.h"
 #include "DyssolStringConstants.h"
 #include "ContainerFunctions.h"
+#include "DyssolSystemDefines.h"
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
 #ifdef _MSC_VER
 #else
 #include <dlfcn.h>
@@ -115,6 +119,35 @@ void CModelsManager::Clear()
 	m_availableSolvers.clear();
 }
 
+void CModelsManager::SetCacheFile(const std::filesystem::path& _file)
+{
+	if (_file == m_cacheFile) return;
+	m_cacheFile = _file;
+	m_cache.clear();
+	m_cacheLoaded = false;
+	m_cacheChanged = false;
+}
+
+std::filesystem::path CModelsManager::DefaultCacheFile()
+{
+	// the cache is kept per user, so that users of the same machine neither share nor overwrite it
+#ifdef _MSC_VER
+	// the temporary directory is located in the profile of the user
+	std::error_code ec;
+	const auto dir = std::filesystem::temp_directory_path(ec);
+	if (ec) return {};
+#else
+	std::filesystem::path dir;
+	if (const char* xdg = std::getenv("XDG_CACHE_HOME"); xdg && *xdg)
+		dir = xdg;
+	else if (const char* home = std::getenv("HOME"); home && *home)
+		dir = std::filesystem::path{ home } / ".cache";
+	else
+		return {};
+#endif
+	return dir / StrConst::MM_CacheDirName / StrConst::MM_CacheFileName;
+}
+
 std::vector<SUnitDescriptor> CModelsManager::GetAvailableUnits() const
 {
 	return m_availableUnits;
@@ -164,6 +197,7 @@ CBaseUnit* CModelsManager::InstantiateUnit(const std::string& _key)
 			}
 			pUnit->CreateBasicInfo();
 			// save created unit and its library
+			std::lock_guard lock{ m_mutex };
 			m_loadedUnits[pUnit] = hLibrary;
 			// return instantiated unit
 			return pUnit;
@@ -195,6 +229,7 @@ CBaseSolver* CModelsManager::InstantiateSolver(const std::string& _key)
 			}
 			pSolver->CreateBasicInfo();
 			// save created solver and its library
+			std::lock_guard lock{ m_mutex };
 			m_loadedSolvers[pSolver] = hLibrary;
 			// return instantiated solver
 			return pSolver;
@@ -205,12 +240,15 @@ CBaseSolver* CModelsManager::InstantiateSolver(const std::string& _key)
 void CModelsManager::FreeUnit(CBaseUnit* _unit)
 {
 	if (!_unit) return;
-	// test if such unit exists
-	if (m_loadedUnits.find(_unit) == m_loadedUnits.end()) return;
-	// copy entry
-	//const DYSSOL_LIBRARY_INSTANCE hLibrary = m_loadedUnits[_unit];
-	// remove it from the list
-	m_loadedUnits.erase(_unit);
+	{
+		std::lock_guard lock{ m_mutex };
+		// test if such unit exists
+		if (m_loadedUnits.find(_unit) == m_loadedUnits.end()) return;
+		// copy entry
+		//const DYSSOL_LIBRARY_INSTANCE hLibrary = m_loadedUnits[_unit];
+		// remove it from the list
+		m_loadedUnits.erase(_unit);
+	}
 	// delete unit
 	delete _unit;
 	_unit = nullptr;
@@ -221,12 +259,15 @@ void CModelsManager::FreeUnit(CBaseUnit* _unit)
 void CModelsManager::FreeSolver(CBaseSolver* _solver)
 {
 	if (!_solver) return;
-	// test if such solver exists
-	if (m_loadedSolvers.find(_solver) == m_loadedSolvers.end()) return;
-	// copy entry
-	//const DYSSOL_LIBRARY_INSTANCE hLibrary = m_loadedSolvers[_solver];
-	// remove it from the list
-	m_loadedSolvers.erase(_solver);
+	{
+		std::lock_guard lock{ m_mutex };
+		// test if such solver exists
+		if (m_loadedSolvers.find(_solver) == m_loadedSolvers.end()) return;
+		// copy entry
+		//const DYSSOL_LIBRARY_INSTANCE hLibrary = m_loadedSolvers[_solver];
+		// remove it from the list
+		m_loadedSolvers.erase(_solver);
+	}
 	// delete unit
 	delete _solver;
 	_solver = nullptr;
@@ -259,6 +300,9 @@ void CModelsManager::UpdateAvailableModels()
 	for (auto& dir : m_dirsList)
 		if (dir.active && !dir.checked)
 		{
+			// read descriptors found during previous runs
+			if (!m_cacheLoaded)
+				LoadCache();
 			// get all models from directory
 			auto models = GetModelsList(dir.pathFull);
 			// set directory key to all found models
@@ -285,6 +329,9 @@ void CModelsManager::UpdateAvailableModels()
 	}
 	std::sort(m_availableUnits.begin(), m_availableUnits.end());
 	std::sort(m_availableSolvers.begin(), m_availableSolvers.end());
+
+	// store descriptors of new libraries for the next runs
+	SaveCache();
 }
 
 std::pair<std::vector<SUnitDescriptor>, std::vector<SSolverDescriptor>> CModelsManager::GetModelsList(const std::filesystem::path& _dir)
@@ -303,21 +350,136 @@ std::pair<std::vector<SUnitDescriptor>, std::vector<SSolverDescriptor>> CModelsM
 
 std::pair<std::vector<SUnitDescriptor>, std::vector<SSolverDescriptor>> CModelsManager::GetAllModelsInDir(const std::filesystem::path& _dir)
 {
+	// the same directory can be given in different ways, so files are identified by their canonical paths
+	const auto Canonical = [](const std::filesystem::path& _path)
+	{
+		std::error_code ec;
+		auto res = std::filesystem::weakly_canonical(_path, ec);
+		return ec ? _path : res;
+	};
+
 	std::vector<SUnitDescriptor> resUnits;
 	std::vector<SSolverDescriptor> resSolvers;
-	for (const auto& f : FileSystem::FilesList(_dir, StrConst::MM_LibraryFileExtension))
-		if(const DYSSOL_LIBRARY_INSTANCE lib = LoadDyssolLibrary(f))
+	auto files = FileSystem::FilesList(_dir, StrConst::MM_LibraryFileExtension);
+	std::transform(files.begin(), files.end(), files.begin(), Canonical);
+	for (const auto& f : files)
+	{
+		// identify the version of the file by its size and modification time
+		std::error_code ec1, ec2;
+		const SCacheEntry file{ std::filesystem::file_size(f, ec1), std::filesystem::last_write_time(f, ec2).time_since_epoch().count(), {}, {} };
+		const bool cacheable = !m_cacheFile.empty() && !ec1 && !ec2;
+
+		// use descriptors found previously, if the file has not been changed since
+		if (const auto it = m_cache.find(f); cacheable && it != m_cache.end() && it->second.size == file.size && it->second.time == file.time)
 		{
-			if(const SUnitDescriptor unit = TryGetUnitDescriptor(f, lib))             // try to load unit from library
-				resUnits.push_back(unit);
-			else if (const SSolverDescriptor solver = TryGetSolverDescriptor(f, lib)) // try to load solver from library
-				resSolvers.push_back(solver);
-			else
-				CloseDyssolLibrary(lib);
+			if (it->second.unit)
+				resUnits.push_back(it->second.unit);
+			else if (it->second.solver)
+				resSolvers.push_back(it->second.solver);
+			continue;
+		}
+
+		const DYSSOL_LIBRARY_INSTANCE lib = LoadDyssolLibrary(f);
+		if (!lib) continue; // do not cache, since it may be loadable later, e.g. when its dependencies are installed
+		SCacheEntry entry{ file };
+		if ((entry.unit = TryGetUnitDescriptor(f, lib)))             // try to load unit from library
+			resUnits.push_back(entry.unit);
+		else if ((entry.solver = TryGetSolverDescriptor(f, lib)))    // try to load solver from library
+			resSolvers.push_back(entry.solver);
+		else
+			CloseDyssolLibrary(lib);
+		if (cacheable)
+		{
+			m_cache[f] = entry;
+			m_cacheChanged = true;
 		}
+	}
+
+	// forget removed files
+	const auto dir = Canonical(_dir);
+	const auto IsRemoved = [&](const auto& _entry)
+	{
+		return Canonical(_entry.first.parent_path()) == dir && std::find(files.begin(), files.end(), _entry.first) == files.end();
+	};
+	m_cacheChanged |= std::erase_if(m_cache, IsRemoved) != 0;
+
 	return std::make_pair(resUnits, resSolvers);
 }
 
+void CModelsManager::LoadCache()
+{
+	m_cacheLoaded = true;
+	m_cache.clear();
+	m_cacheChanged = false;
+	if (m_cacheFile.empty()) return;
+	std::ifstream file{ m_cacheFile };
+	if (!file) return;
+
+	// the cache is valid only for the same version of the program
+	std::string signature, program;
+	unsigned version{};
+	file >> signature >> program >> version;
+	if (signature != StrConst::MM_CacheSignature || program != CURRENT_VERSION_STR || version != m_cacheVersion) return;
+
+	std::filesystem::path path;
+	SCacheEntry entry;
+	int type{};
+	while (file >> path >> entry.size >> entry.time >> type)
+	{
+		SModelDescriptor* model = type == 1 ? static_cast<SModelDescriptor*>(&entry.unit) : type == 2 ? static_cast<SModelDescriptor*>(&entry.solver) : nullptr;
+		entry.unit = {};
+		entry.solver = {};
+		if (model)
+		{
+			unsigned specific{};
+			file >> std::quoted(model->uniqueID) >> std::quoted(model->name) >> std::quoted(model->author) >> model->version >> specific;
+			model->fileLocation = StringFunctions::UnifyPath(path);
+			entry.unit.isDynamic = specific != 0;
+			entry.solver.solverType = static_cast<ESolverTypes>(specific);
+		}
+		if (!file) break;
+		m_cache[path] = entry;
+	}
+}
+
+void CModelsManager::SaveCache()
+{
+	if (!m_cacheChanged || m_cacheFile.empty()) return;
+	m_cacheChanged = false;
+
+	// write to a temporary file and replace the cache at once, so that simultaneously running programs always read a complete file
+	std::error_code ec;
+	std::filesystem::create_directories(m_cacheFile.parent_path(), ec);
+	std::filesystem::path tempFile = m_cacheFile;
+	tempFile += "." + StringFunctions::GenerateRandomKey(8);
+	{
+		std::ofstream file{ tempFile };
+		if (!file) return;
+		file << StrConst::MM_CacheSignature << " " << CURRENT_VERSION_STR << " " << m_cacheVersion << std::endl;
+		for (const auto& [path, entry] : m_cache)
+		{
+			file << path << " " << entry.size << " " << entry.time;
+			if (entry.unit)
+				file << " 1 " << std::quoted(entry.unit.uniqueID) << " " << std::quoted(entry.unit.name) << " " << std::quoted(entry.unit.author) << " " << entry.unit.version << " " << entry.unit.isDynamic;
+			else if (entry.solver)
+				file << " 2 " << std::quoted(entry.solver.uniqueID) << " " << std::quoted(entry.solver.name) << " " << std::quoted(entry.solver.author) << " " << entry.solver.version << " " << static_cast<unsigned>(entry.solver.solverType);
+			else
+				file << " 0";
+			file << std::endl;
+		}
+		// an incomplete file must never replace the cache
+		file.close();
+		if (!file)
+		{
+			std::filesystem::remove(tempFile, ec);
+			return;
+		}
+	}
+	std::filesystem::rename(tempFile, m_cacheFile, ec);
+	if (ec)
+		std::filesystem::remove(tempFile, ec);
+}
+
 SUnitDescriptor CModelsManager::TryGetUnitDescriptor(const std::filesystem::path& _pathToUnit, DYSSOL_LIBRARY_INSTANCE _library)
 {
 	// try to get constructor
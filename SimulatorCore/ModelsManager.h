@@ -7,6 +7,7 @@
 #include "BaseSolver.h"
 #include "DyssolFilesystem.h"
 #include <map>
+#include <mutex>
 #include <vector>
 
 #ifdef _MSC_VER
@@ -70,12 +71,29 @@ class CModelsManager
 		SModelDir(std::filesystem::path _path, std::string _key, bool _active);
 	};
 
+	// Descriptors of models found in a library file, stored between runs.
+	struct SCacheEntry
+	{
+		uintmax_t size{};			// Size of the file.
+		int64_t time{};				// Time of the last modification of the file.
+		SUnitDescriptor unit;		// Unit found in the file, if any.
+		SSolverDescriptor solver;	// Solver found in the file, if any.
+	};
+
+	static constexpr unsigned m_cacheVersion{ 1 }; // Current version of the cache file.
+
 	std::vector<SModelDir> m_dirsList;                 // Directories to look for libraries with models.
 	std::vector<SUnitDescriptor> m_availableUnits;	   // List of available units.
 	std::vector<SSolverDescriptor> m_availableSolvers; // List of available solvers.
 
 	std::map<CBaseUnit*, DYSSOL_LIBRARY_INSTANCE> m_loadedUnits;		 // List of loaded units with their libraries. Used for proper resource management.
 	std::map<CBaseSolver*, DYSSOL_LIBRARY_INSTANCE> m_loadedSolvers; // List of loaded solvers with their libraries. Used for proper resource management.
+	std::mutex m_mutex;												 // Guards lists of loaded models, so that models can be instantiated and freed from several threads.
+
+	std::filesystem::path m_cacheFile{ DefaultCacheFile() };	// File to store descriptors of models between runs. If empty, descriptors are not stored.
+	std::map<std::filesystem::path, SCacheEntry> m_cache;		// Descriptors of models in all scanned libraries by their files.
+	bool m_cacheLoaded{ false };								// Whether the cache file has been already read.
+	bool m_cacheChanged{ false };								// Whether the cache has been changed since it was read or written.
 
 public:
 	~CModelsManager();
@@ -103,6 +121,11 @@ public:
 	// Removes all paths and models.
 	void Clear();
 
+	// Sets a file to store descriptors of models between runs. Libraries are then loaded to read their models only if they are new or have been changed. Empty path disables the cache.
+	void SetCacheFile(const std::filesystem::path& _file);
+	// Returns the default file to store descriptors of models, located in the cache directory of the current user. Empty if there is no such directory.
+	static std::filesystem::path DefaultCacheFile();
+
 	// Returns a list of descriptors for all available units.
 	std::vector<SUnitDescriptor> GetAvailableUnits() const;
 	// Returns a list of descriptors for all available solvers.
@@ -130,9 +153,14 @@ private:
 	void UpdateAvailableModels();
 
 	// Returns a list of models available in the specified directory, treating it as relative or absolute path.
-	static std::pair<std::vector<SUnitDescriptor>, std::vector<SSolverDescriptor>> GetModelsList(const std::filesystem::path& _dir);
-	// Returns a list of models available in the specified directory.
-	static std::pair<std::vector<SUnitDescriptor>, std::vector<SSolverDescriptor>> GetAllModelsInDir(const std::filesystem::path& _dir);
+	std::pair<std::vector<SUnitDescriptor>, std::vector<SSolverDescriptor>> GetModelsList(const std::filesystem::path& _dir);
+	// Returns a list of models available in the specified directory. Uses cached descriptors for unchanged libraries.
+	std::pair<std::vector<SUnitDescriptor>, std::vector<SSolverDescriptor>> GetAllModelsInDir(const std::filesystem::path& _dir);
+
+	// Reads descriptors of models from the cache file.
+	void LoadCache();
+	// Writes descriptors of models to the cache file, if they have been changed.
+	void SaveCache();
 
 	// Tries to load unit from _library. If the model cannot be loaded, returns a structure with empty strings.
 	static SUnitDescriptor TryGetUnitDescriptor(const std::filesystem::path& _pathToUnit, DYSSOL_LIBRARY_INSTANCE _library);
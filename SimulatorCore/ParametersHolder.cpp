@@ -5,7 +5,7 @@
 #include "H5Handler.h"
 
 
-const unsigned CParametersHolder::m_cnSaveVersion = 7;
+const unsigned CParametersHolder::m_cnSaveVersion = 9;
 
 CParametersHolder::CParametersHolder()
 {
@@ -55,6 +55,12 @@ void CParametersHolder::SetDefaultValues()
 	enthalpyInt  = DEFAULT_ENTHALPY_INTERVALS;
 
 	fileSingleFlag = true;
+	fileCompression = DEFAULT_FILE_COMPRESSION;
+	fileShuffleFlag = DEFAULT_FILE_SHUFFLE_FLAG;
+	fileChecksumFlag = DEFAULT_FILE_CHECKSUM_FLAG;
+	fileChunkSize = DEFAULT_FILE_CHUNK_SIZE;
+	fileCacheSize = DEFAULT_FILE_CACHE_SIZE;
+	fileIncrementalFlag = DEFAULT_FILE_INCREMENTAL;
 }
 
 void CParametersHolder::SaveToFile(CH5Handler& _h5File, const std::string& _sPath)
@@ -103,6 +109,12 @@ void CParametersHolder::SaveToFile(CH5Handler& _h5File, const std::string& _sPat
 
 	// save file saving parameters
 	_h5File.WriteData(_sPath, StrConst::FlPar_H5FileSingleFlag, fileSingleFlag.data);
+	_h5File.WriteData(_sPath, StrConst::FlPar_H5FileCompression, fileCompression.data);
+	_h5File.WriteData(_sPath, StrConst::FlPar_H5FileShuffleFlag, fileShuffleFlag.data);
+	_h5File.WriteData(_sPath, StrConst::FlPar_H5FileChecksumFlag, fileChecksumFlag.data);
+	_h5File.WriteData(_sPath, StrConst::FlPar_H5FileChunkSize, fileChunkSize.data);
+	_h5File.WriteData(_sPath, StrConst::FlPar_H5FileCacheSize, fileCacheSize.data);
+	_h5File.WriteData(_sPath, StrConst::FlPar_H5FileIncrementalFlag, fileIncrementalFlag.data);
 
 	// save tear streams initialization parameters
 	_h5File.WriteData(_sPath, StrConst::FlPar_H5InitTearStreamsFlag, initializeTearStreamsAutoFlag.data);
@@ -181,6 +193,26 @@ void CParametersHolder::LoadFromFile(CH5Handler& _h5File, const std::string& _sP
 		fileSingleFlag = true;
 	else
 		_h5File.ReadData(_sPath, StrConst::FlPar_H5FileSingleFlag, fileSingleFlag.data);
+	if (nVer < 8)
+	{
+		fileCompression = DEFAULT_FILE_COMPRESSION;
+		fileShuffleFlag = DEFAULT_FILE_SHUFFLE_FLAG;
+		fileChecksumFlag = DEFAULT_FILE_CHECKSUM_FLAG;
+		fileChunkSize = DEFAULT_FILE_CHUNK_SIZE;
+		fileCacheSize = DEFAULT_FILE_CACHE_SIZE;
+	}
+	else
+	{
+		_h5File.ReadData(_sPath, StrConst::FlPar_H5FileCompression, fileCompression.data);
+		_h5File.ReadData(_sPath, StrConst::FlPar_H5FileShuffleFlag, fileShuffleFlag.data);
+		_h5File.ReadData(_sPath, StrConst::FlPar_H5FileChecksumFlag, fileChecksumFlag.data);
+		_h5File.ReadData(_sPath, StrConst::FlPar_H5FileChunkSize, fileChunkSize.data);
+		_h5File.ReadData(_sPath, StrConst::FlPar_H5FileCacheSize, fileCacheSize.data);
+	}
+	if (nVer < 9)
+		fileIncrementalFlag = DEFAULT_FILE_INCREMENTAL;
+	else
+		_h5File.ReadData(_sPath, StrConst::FlPar_H5FileIncrementalFlag, fileIncrementalFlag.data);
 
 	// load tear streams  initialization parameters
 	if (nVer < 4)
@@ -359,6 +391,38 @@ void CParametersHolder::FileSingleFlag(bool val)
 	fileSingleFlag = val;
 }
 
+void CParametersHolder::FileCompression(uint32_t val)
+{
+	// [0; 9]
+	fileCompression = val > 9 ? 9 : val;
+}
+
+void CParametersHolder::FileShuffleFlag(bool val)
+{
+	fileShuffleFlag = val;
+}
+
+void CParametersHolder::FileChecksumFlag(bool val)
+{
+	fileChecksumFlag = val;
+}
+
+void CParametersHolder::FileChunkSize(uint32_t val)
+{
+	fileChunkSize = val;
+}
+
+void CParametersHolder::FileCacheSize(uint32_t val)
+{
+	if (val > 0)
+		fileCacheSize = val;
+}
+
+void CParametersHolder::FileIncrementalFlag(bool val)
+{
+	fileIncrementalFlag = val;
+}
+
 void CParametersHolder::InitializeTearStreamsAutoFlag(bool val)
 {
 	initializeTearStreamsAutoFlag = val;
@@ -110,6 +110,18 @@ public:
 	// == File saving
 	proxy<bool> fileSingleFlag;		// true - single file, false - file is split on subfiles with MAX_FILE_SIZE size
 	void FileSingleFlag(bool val);
+	proxy<uint32_t> fileCompression;	// level of deflate compression of numeric data [0..9], 0 - no compression
+	void FileCompression(uint32_t val);
+	proxy<bool> fileShuffleFlag;		// whether to shuffle bytes of numeric data before compression
+	void FileShuffleFlag(bool val);
+	proxy<bool> fileChecksumFlag;		// whether to store checksums of numeric data
+	void FileChecksumFlag(bool val);
+	proxy<uint32_t> fileChunkSize;		// number of values in one chunk of numeric data, 0 - automatic
+	void FileChunkSize(uint32_t val);
+	proxy<uint32_t> fileCacheSize;		// size of the chunk cache [MB]
+	void FileCacheSize(uint32_t val);
+	proxy<bool> fileIncrementalFlag;	// whether to append new time points when saving to the same file instead of rewriting it
+	void FileIncrementalFlag(bool val);
 
 	// == Initialization of tear streams
 	proxy<bool> initializeTearStreamsAutoFlag;	// true - automatically calculate initialization values using previous calculations, false - user defined initial values
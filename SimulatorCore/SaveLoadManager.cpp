@@ -15,17 +15,40 @@ std::filesystem::path CSaveLoadManager::GetFileName() const
 	return m_fileHandler.FileName();
 }
 
+void CSaveLoadManager::SetLazyLoading(bool _flag)
+{
+	m_lazyLoading = _flag;
+}
+
 bool CSaveLoadManager::SaveToFile(const std::filesystem::path& _fileName)
 {
 	if (_fileName.empty()) return false;
 
+	const std::string root = "/";
+
 	// TODO: m_parameters.fileSingleFlag
-	m_fileHandler.Create(_fileName);
+	if (m_data.flowsheet)
+	{
+		// data loaded on demand must be read before the file they are read from is overwritten
+		std::error_code error;
+		if (!m_data.flowsheet->GetLazySource().empty() && std::filesystem::equivalent(_fileName, m_data.flowsheet->GetLazySource(), error))
+			m_data.flowsheet->DetachFromFile();
+		m_fileHandler.SetStorageSettings(StorageSettings(*m_data.flowsheet->GetParameters()));
+
+		// only the file, from which the flowsheet was loaded or to which it was saved last, contains data that may be kept
+		if (m_data.flowsheet->GetParameters()->fileIncrementalFlag && std::filesystem::equivalent(_fileName, m_data.flowsheet->GetFileName(), error))
+		{
+			m_fileHandler.OpenForAppend(_fileName);
+			if (m_fileHandler.IsValid() && m_fileHandler.ReadAttribute(root, StrConst::H5AttrSaveVersion) != static_cast<int>(m_saveVersion))
+				m_fileHandler.Close();
+		}
+	}
+	if (!m_fileHandler.IsAppending())
+		m_fileHandler.Create(_fileName);
+	m_fileHandler.SetFlatRowsLayout(true);
 
 	if (!m_fileHandler.IsValid()) return false;
 
-	const std::string root = "/";
-
 	// current version of save procedure
 	m_fileHandler.WriteAttribute(root, StrConst::H5AttrSaveVersion, m_saveVersion);
 
@@ -48,6 +71,9 @@ bool CSaveLoadManager::LoadFromFile(const std::filesystem::path& _fileName)
 {
 	if (_fileName.empty()) return false;
 
+	if (m_data.flowsheet)
+		m_fileHandler.SetStorageSettings(StorageSettings(*m_data.flowsheet->GetParameters()));
+	m_fileHandler.SetLazyLoading(m_lazyLoading);
 	m_fileHandler.Open(_fileName);
 
 	if (!m_fileHandler.IsValid()) return false;
@@ -56,6 +82,14 @@ bool CSaveLoadManager::LoadFromFile(const std::filesystem::path& _fileName)
 
 	// version of save procedure
 	const int version = m_fileHandler.ReadAttribute(root, StrConst::H5AttrSaveVersion);
+	if (version > static_cast<int>(m_saveVersion))
+	{
+		m_fileHandler.Close();
+		return false;
+	}
+
+	// flat layout of filtered data is used since version 7
+	m_fileHandler.SetFlatRowsLayout(version >= 7);
 
 	bool success = true;
 
@@ -75,3 +109,15 @@ bool CSaveLoadManager::LoadFromFile(const std::filesystem::path& _fileName)
 
 	return success;
 }
+
+SH5StorageSettings CSaveLoadManager::StorageSettings(const CParametersHolder& _parameters)
+{
+	SH5StorageSettings res;
+	res.compression = _parameters.fileCompression;
+	res.shuffle     = _parameters.fileShuffleFlag;
+	res.checksum    = _parameters.fileChecksumFlag;
+	res.chunkSize   = _parameters.fileChunkSize;
+	res.cacheSize   = _parameters.fileCacheSize;
+	res.extendible  = _parameters.fileIncrementalFlag;
+	return res;
+}
@@ -6,6 +6,7 @@
 #include "H5Handler.h"
 
 class CFlowsheet;
+class CParametersHolder;
 struct SSaveLoadData
 {
 	CFlowsheet* flowsheet{};                        /// Pointer to global flowsheet.
@@ -16,11 +17,12 @@ struct SSaveLoadData
  */
 class CSaveLoadManager
 {
-	static constexpr unsigned m_saveVersion{ 6 }; /// Current version of the saving procedure.
+	static constexpr unsigned m_saveVersion{ 7 }; /// Current version of the saving procedure.
 
 	SSaveLoadData m_data{};
 
 	CH5Handler m_fileHandler{}; /// Handler of data file in HDF5 format.
+	bool m_lazyLoading{ false }; /// Whether distributed data should be loaded from file only on demand.
 
 public:
 	CSaveLoadManager() = default;
@@ -33,6 +35,13 @@ public:
 	 */
 	[[nodiscard]] std::filesystem::path GetFileName() const;
 
+	/**
+	 * Sets whether to load distributed data of streams and holdups from file only when they are accessed.
+	 * \details The loaded file is kept open by the flowsheet until it is overwritten or the flowsheet is cleared.
+	 * \param _flag Lazy loading flag.
+	 */
+	void SetLazyLoading(bool _flag);
+
 	/**
 	 * Saves all data into the HDF5 file.
 	 * \param _fileName Full path to the file.
@@ -41,9 +50,17 @@ public:
 	bool SaveToFile(const std::filesystem::path& _fileName);
 	/**
 	 * Loads all data from the HDF5 file.
+	 * \details Files saved with a newer version of the saving procedure are not loaded.
 	 * \param _fileName Full path to the file.
 	 * \return Operation success flag.
 	 */
 	bool LoadFromFile(const std::filesystem::path& _fileName);
+
+	/**
+	 * Returns settings of the storage layout of numeric datasets defined in flowsheet parameters.
+	 * \param _parameters Flowsheet parameters.
+	 * \return Storage settings.
+	 */
+	[[nodiscard]] static SH5StorageSettings StorageSettings(const CParametersHolder& _parameters);
 };
 
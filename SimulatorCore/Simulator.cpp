@@ -12,6 +12,7 @@
 #include "DyssolStringConstants.h"
 #include "ContainerFunctions.h"
 #include "DyssolUtilities.h"
+#include <chrono>
 
 CSimulator::CSimulator()
 {
@@ -50,6 +51,19 @@ CSimulator::SPartitionStatus CSimulator::GetCurrentPartitionStatus() const
 	return m_partitionsStatus[m_iCurrentPartition];
 }
 
+size_t CSimulator::GetIterationsNumber() const
+{
+	size_t res = 0;
+	for (const auto& status : m_partitionsStatus)
+		res += status.iIterationsTotal;
+	return res;
+}
+
+const std::map<std::string, double>& CSimulator::GetUnitsTime() const
+{
+	return m_unitsTime;
+}
+
 void CSimulator::Simulate()
 {
 	m_nCurrentStatus = ESimulatorState::RUNNING;
@@ -64,9 +78,13 @@ void CSimulator::Simulate()
 
 	// Clear initialization flags
 	m_vInitialized.clear();
+	m_unitsTime.clear();
 	for (const auto& partition : m_pSequence->Partitions())
 		for (const auto& model : partition.models)
+		{
 			m_vInitialized[model->GetKey()] = false;
+			m_unitsTime[model->GetKey()] = 0.0;
+		}
 
 	// run logger updater
 	m_logUpdater.Run();
@@ -90,6 +108,8 @@ void CSimulator::Simulate()
 		// Finalize all units within partition
 		for (auto& model : partitions[iPart].models)
 		{
+			for (const auto& [solver, s] : model->GetModel()->GetSolversStatistics())
+				m_log.WriteInfo(StrConst::Sim_InfoSolverStatistics(model->GetName(), solver, s.calls, s.steps, s.residualEvaluations, s.jacobianEvaluations, s.nonlinearFailures, s.errorTestFailures, s.solverTime, s.residualTime));
 			m_log.WriteInfo(StrConst::Sim_InfoUnitFinalization(model->GetName(), model->GetModel()->GetUnitName()));
 			model->GetModel()->DoFinalizeUnit();
 		}
@@ -209,6 +229,7 @@ void CSimulator::SimulateUnitsWithRecycles(size_t _iPartition, const CCalculatio
 
 		partVars.iTWIterationFull++;
 		partVars.iTWIterationCurr++;
+		partVars.iIterationsTotal++;
 
 		// check convergence
 		if (!CheckConvergence(vRecycles, partVars.vRecyclesPrev, partVars.dTWStart, partVars.dTWEnd))
@@ -343,6 +364,7 @@ void CSimulator::SimulateUnit(CUnitContainer& _unit, double _t1, double _t2 /*=
 	auto* model = _unit.GetModel();
 
 	m_logUpdater.SetModel(model);
+	const auto tStart = std::chrono::steady_clock::now();
 
 	// simulate
 	try {
@@ -355,6 +377,7 @@ void CSimulator::SimulateUnit(CUnitContainer& _unit, double _t1, double _t2 /*=
 		RaiseError(e.what());
 	}
 
+	m_unitsTime[_unit.GetKey()] += std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
 	m_logUpdater.ReleaseModel();
 
 	// check for errors
@@ -369,12 +392,14 @@ void CSimulator::InitializeUnit(CUnitContainer& _unit, double _t)
 	// write log
 	m_log.WriteInfo(StrConst::Sim_InfoUnitInitialization(m_unitName, model->GetUnitName()));
 	//CLogUpdater logUpdater{ &m_log, model };
+	const auto tStart = std::chrono::steady_clock::now();
 	try {
 		model->DoInitializeUnit();
 	}
 	catch (const std::logic_error& e) {
 		RaiseError(e.what());
 	}
+	m_unitsTime[_unit.GetKey()] += std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
 	//logUpdater.Release();
 
 	if (model->HasError())
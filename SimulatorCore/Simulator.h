@@ -35,6 +35,7 @@ private:
 		unsigned iTWIterationFull{ 0 };		// Iteration number within a current time window [m_dTWStart .. ]. Does not reset if the size of current TW is reduced.
 		unsigned iTWIterationCurr{ 0 };		// Iteration number within a current time window [m_dTWStart .. m_dTWEnd]. Reset if the size of current TW is reduced.
 		unsigned iWindowNumber{ 0 };		// Current time window within a partition.
+		unsigned iIterationsTotal{ 0 };		// Number of iterations in all time windows of a partition.
 		bool bTearStreamsFromInit{ false };
 
 		std::vector<CStream*> vRecyclesPrev{};			// previous state of recycles
@@ -54,6 +55,7 @@ private:
 	std::vector<SPartitionStatus> m_partitionsStatus{};
 	size_t m_iCurrentPartition{};
 	std::string m_unitName;				// Name of the currently calculated unit.
+	std::map<std::string, double> m_unitsTime;	// Wall-clock time spent in initialization and simulation of each unit during the last simulation [s], by unit keys.
 
 	//// parameters of convergence methods
 	bool m_bSteffensenTrigger;
@@ -77,6 +79,10 @@ public:
 
 	// Returns information about currently calculated partition.
 	SPartitionStatus GetCurrentPartitionStatus() const;
+	// Returns the number of iterations over tear streams in all partitions during the last simulation.
+	size_t GetIterationsNumber() const;
+	// Returns wall-clock time spent in initialization and simulation of each unit during the last simulation [s], by unit keys.
+	const std::map<std::string, double>& GetUnitsTime() const;
 
 	/// Perform simulation.
 	void Simulate();
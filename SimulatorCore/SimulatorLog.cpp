@@ -1,7 +1,6 @@
 /* Copyright (c) 2020, Dyssol Development Team. All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
 
 #include "SimulatorLog.h"
-#include <iostream>
 
 CSimulatorLog::CSimulatorLog()
 {
@@ -24,6 +23,11 @@ void CSimulatorLog::Clear()
 	m_iReadPos = m_iWritePos = 0;
 }
 
+void CSimulatorLog::SetConsole(std::ostream& _console)
+{
+	m_console = &_console;
+}
+
 void CSimulatorLog::Write(const std::string& _text, ELogColor _color, bool _console)
 {
 	const size_t iPos = m_iWritePos % MAX_LOG_SIZE; // up to MAX_LOG_SIZE and then again cyclic from 0
@@ -32,7 +36,7 @@ void CSimulatorLog::Write(const std::string& _text, ELogColor _color, bool _cons
 
 	m_iWritePos++;
 	if(_console)
-		std::cout << _text << std::endl;
+		*m_console << _text << std::endl;
 }
 
 void CSimulatorLog::WriteInfo(const std::string& _text, bool _console /*= false*/)
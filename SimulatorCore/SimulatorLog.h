@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <iostream>
 #include <string>
 #include <vector>
 
@@ -29,6 +30,7 @@ private:
 	std::vector<SColorLog> m_log;
 	size_t m_iReadPos;
 	size_t m_iWritePos;
+	std::ostream* m_console{ &std::cout };
 
 public:
 	CSimulatorLog();
@@ -37,6 +39,9 @@ public:
 	// Removes all messages and resets read and write positions.
 	void Clear();
 
+	// Sets the stream, to which messages are additionally written if requested. std::cout by default.
+	void SetConsole(std::ostream& _console);
+
 	// Writes a message with the specified color to the current write position and advances this position. If _console is set, the message will be additionally written into std::out.
 	void Write(const std::string& _text, ELogColor _color, bool _console);
 	// Writes an info message with the pre-defined color to the current write position and advances this position. If _console is set, the message will be additionally written into std::out.
@@ -35,9 +35,10 @@ CUnitContainer::CUnitContainer(const CUnitContainer& _other)
 {
 	if (_other.m_model)
 	{
+		// a new instance keeps its own structure, to which the model may hold pointers
 		SetModel(_other.m_model->GetUniqueID());
 		if (m_model)
-			*m_model = *_other.m_model;
+			m_model->CopyUserData(*_other.m_model);
 	}
 }
 
@@ -131,6 +132,20 @@ void CUnitContainer::SetMaterialsDatabase(const CMaterialsDatabase* _materialsDB
 	m_model->SetMaterialsDatabase(m_materialsDB);
 }
 
+void CUnitContainer::SetPointers(const CMaterialsDatabase* _materialsDB, const CMultidimensionalGrid* _grid, const std::vector<SOverallDescriptor>* _overall,
+	const std::vector<SPhaseDescriptor>* _phases, const SCacheSettings* _cache, const SToleranceSettings* _tolerance, const SThermodynamicsSettings* _thermodynamics)
+{
+	m_materialsDB    = _materialsDB;
+	m_grid           = _grid;
+	m_overall        = _overall;
+	m_phases         = _phases;
+	m_cache          = _cache;
+	m_tolerance      = _tolerance;
+	m_thermodynamics = _thermodynamics;
+	if (!m_model) return;
+	m_model->ConfigureUnitStructures(m_materialsDB, *m_grid, m_overall, m_phases, m_cache, m_tolerance, m_thermodynamics);
+}
+
 std::string CUnitContainer::InitializeExternalSolvers() const
 {
 	ClearExternalSolvers();
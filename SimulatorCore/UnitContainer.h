@@ -78,6 +78,9 @@ public:
 
 	// Sets pointer to a global materials database.
 	void SetMaterialsDatabase(const CMaterialsDatabase* _materialsDB);
+	// Sets pointers to flowsheet structural data and settings, e.g. after the unit has been copied to another flowsheet.
+	void SetPointers(const CMaterialsDatabase* _materialsDB, const CMultidimensionalGrid* _grid, const std::vector<SOverallDescriptor>* _overall,
+		const std::vector<SPhaseDescriptor>* _phases, const SCacheSettings* _cache, const SToleranceSettings* _tolerance, const SThermodynamicsSettings* _thermodynamics);
 
 	// Initializes all solvers chosen in unit parameters by loading them from corresponding dynamic libraries. Returns an empty string on success, otherwise returns an error description.
 	std::string InitializeExternalSolvers() const;
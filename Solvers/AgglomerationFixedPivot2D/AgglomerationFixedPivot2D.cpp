@@ -0,0 +1,228 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#define DLL_EXPORT
+#include "AgglomerationFixedPivot2D.h"
+#include "DyssolDefines.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+
+extern "C" DECLDIR CAgglomerationSolver* CREATE_SOLVER_FUN_AGG1()
+{
+	return new CAgglomerationFixedPivot2D();
+}
+
+void CAgglomerationFixedPivot2D::CreateBasicInfo()
+{
+	SetName("Fixed Pivot 2D");
+	SetAuthorName("DyssolTEC GmbH");
+	SetUniqueID("AD8C4FA7CF9244D594FED2810040E4B6");
+	SetVersion(1);
+	SetHelpLink("003_models/solver_fixedpivot2d.html");
+}
+
+void CAgglomerationFixedPivot2D::Initialize()
+{
+	// size classes: pivots in mean volumes
+	n = m_grid.size() - 1;
+	d_vect_t pivots(n);
+	for (size_t i = 0; i < n; ++i)
+		pivots[i] = MATH_PI / 6. * (std::pow(m_grid[i], 3) + std::pow(m_grid[i + 1], 3)) / 2.;
+
+	// secondary property: equidistant grid, one class for one-dimensional distributions
+	m = m_grid2.empty() ? 1 : m_grid2.size() - 1;
+	offset = 0.0;
+	if (!m_grid2.empty())
+	{
+		const double width = (m_grid2.back() - m_grid2.front()) / static_cast<double>(m);
+		for (size_t k = 0; k < m; ++k)
+			if (std::abs(m_grid2[k + 1] - m_grid2[k] - width) > 1e-6 * width)
+				RaiseError("Grid of the secondary property must be equidistant.");
+		offset = (m_grid2[0] + m_grid2[1]) / 2. / width;
+	}
+
+	// all pairs of size classes with their targets between two pivots;
+	// pairs forming agglomerates larger than the last pivot are skipped, since they cannot be split preserving number and volume
+	pairs.clear();
+	byTarget.assign(n, {});
+	for (size_t j = 0; j < n; ++j)
+		for (size_t i = 0; i <= j; ++i)
+		{
+			const double v = pivots[i] + pivots[j];
+			if (v > pivots[n - 1]) continue;
+			SPair p;
+			p.i = i;
+			p.j = j;
+			p.beta = Kernel(pivots[i], pivots[j]) * (i == j ? 0.5 : 1.0);
+			p.target = std::lower_bound(pivots.begin(), pivots.end(), v) - pivots.begin() - 1;
+			p.share = (pivots[p.target + 1] - v) / (pivots[p.target + 1] - pivots[p.target]);
+			p.weight = pivots[i] / v;
+			byTarget[p.target].push_back(pairs.size());
+			byTarget[p.target + 1].push_back(pairs.size());
+			pairs.push_back(p);
+		}
+
+	// FFT of the length sufficient for linear convolution, one configuration for each thread since they hold buffers
+	length = 2 * m;
+	bins = length / 2 + 1;
+	ClearFFT();
+	for (size_t t = 0; t < getThreadPool().GetThreadsNumber(); ++t)
+	{
+		fftF.push_back(kiss_fftr_alloc(static_cast<int>(length), 0, nullptr, nullptr));
+		fftB.push_back(kiss_fftr_alloc(static_cast<int>(length), 1, nullptr, nullptr));
+	}
+	spectra.assign(m_mixing == EMixing::ADDITIVE ? n : 0, c_vect_t(bins));
+	products.assign(pairs.size(), c_vect_t(bins));
+}
+
+void CAgglomerationFixedPivot2D::Calculate(const d_vect_t& _n, d_vect_t& _rateB, d_vect_t& _rateD)
+{
+	_rateB.assign(_n.size(), 0.0);
+	_rateD.assign(_n.size(), 0.0);
+	if (_n.empty()) return;
+
+	if (m != 1)
+		RaiseError("A one-dimensional distribution is given, but the solver was initialized with a secondary grid.");
+	d_matr_t n2(n, d_vect_t(1)), rateB, rateD;
+	for (size_t i = 0; i < n; ++i)
+		n2[i][0] = _n[i];
+	Calculate(n2, rateB, rateD);
+	for (size_t i = 0; i < n; ++i)
+	{
+		_rateB[i] = rateB[i][0];
+		_rateD[i] = rateD[i][0];
+	}
+}
+
+void CAgglomerationFixedPivot2D::Calculate(const d_matr_t& _n, d_matr_t& _rateB, d_matr_t& _rateD)
+{
+	_rateB.assign(_n.size(), d_vect_t(m, 0.0));
+	_rateD.assign(_n.size(), d_vect_t(m, 0.0));
+	if (_n.empty()) return;
+	if (_n.size() != n || _n.front().size() != m)
+		RaiseError("Size of the distribution does not match the grids.");
+
+	// death: the kernel depends only on sizes, so only total numbers in size classes are needed
+	d_vect_t total(n, 0.0);
+	for (size_t i = 0; i < n; ++i)
+		for (size_t k = 0; k < m; ++k)
+			total[i] += _n[i][k];
+	d_vect_t death(n, 0.0);
+	for (const auto& p : pairs)
+	{
+		const double val = p.beta * total[p.i] * total[p.j];
+		death[p.i] += val;
+		death[p.j] += val;
+	}
+	for (size_t i = 0; i < n; ++i)
+		if (total[i] > 0.0)
+			for (size_t k = 0; k < m; ++k)
+				_rateD[i][k] = m_beta0 * death[i] * _n[i][k] / total[i];
+
+	// birth: secondary properties of agglomerates are convolutions of distributions of agglomerating classes, summed up in frequency domain for each target size class
+	CalculateProducts(_n);
+	const size_t threads = fftB.size();
+	ParallelFor(threads, [&](size_t _thread)
+	{
+		c_vect_t sum(bins);
+		d_vect_t conv(length);
+		for (size_t t = _thread; t < n; t += threads)
+		{
+			if (byTarget[t].empty()) continue;
+			std::fill(sum.begin(), sum.end(), std::complex<double>{});
+			for (const size_t iPair : byTarget[t])
+			{
+				const SPair& p = pairs[iPair];
+				const double factor = p.beta * (p.target == t ? p.share : 1.0 - p.share);
+				if (factor == 0.0 || total[p.i] == 0.0 || total[p.j] == 0.0) continue;
+				for (size_t b = 0; b < bins; ++b)
+					sum[b] += factor * products[iPair][b];
+			}
+			kiss_fftri(fftB[_thread], reinterpret_cast<const kiss_fft_cpx*>(sum.data()), conv.data());
+
+			// map positions of the convolution to classes of the secondary property, values beyond the grid are assigned to the last class
+			for (size_t c = 0; c < length; ++c)
+			{
+				const double val = m_beta0 * conv[c] / static_cast<double>(length);
+				if (val == 0.0) continue;
+				const double pos = m_mixing == EMixing::ADDITIVE ? static_cast<double>(c) + offset : static_cast<double>(c);
+				const size_t lo = static_cast<size_t>(pos);
+				const double frac = pos - static_cast<double>(lo);
+				_rateB[t][std::min(lo, m - 1)] += val * (1 - frac);
+				if (frac > 0.0)
+					_rateB[t][std::min(lo + 1, m - 1)] += val * frac;
+			}
+		}
+	});
+}
+
+void CAgglomerationFixedPivot2D::Finalize()
+{
+	ClearFFT();
+}
+
+void CAgglomerationFixedPivot2D::CalculateProducts(const d_matr_t& _n)
+{
+	const size_t threads = fftF.size();
+
+	if (m_mixing == EMixing::ADDITIVE)
+	{
+		// secondary properties are summed up: each distribution is transformed only once
+		ParallelFor(threads, [&](size_t _thread)
+		{
+			d_vect_t buffer(length);
+			for (size_t i = _thread; i < n; i += threads)
+				Transform(_thread, _n[i], 1.0, buffer, spectra[i]);
+		});
+		ParallelFor(pairs.size(), [&](size_t iPair)
+		{
+			const SPair& p = pairs[iPair];
+			for (size_t b = 0; b < bins; ++b)
+				products[iPair][b] = spectra[p.i][b] * spectra[p.j][b];
+		});
+	}
+	else
+	{
+		// secondary properties are averaged: positions are scaled with volume fractions of particles in each pair
+		ParallelFor(threads, [&](size_t _thread)
+		{
+			d_vect_t buffer(length);
+			c_vect_t spectrum(bins);
+			for (size_t iPair = _thread; iPair < pairs.size(); iPair += threads)
+			{
+				const SPair& p = pairs[iPair];
+				Transform(_thread, _n[p.i], p.weight, buffer, spectrum);
+				Transform(_thread, _n[p.j], 1.0 - p.weight, buffer, products[iPair]);
+				for (size_t b = 0; b < bins; ++b)
+					products[iPair][b] *= spectrum[b];
+			}
+		});
+	}
+}
+
+void CAgglomerationFixedPivot2D::Transform(size_t _thread, const d_vect_t& _row, double _scale, d_vect_t& _buffer, c_vect_t& _spectrum) const
+{
+	// projection of scaled positions onto the grid, preserving number and mean value
+	std::fill(_buffer.begin(), _buffer.end(), 0.0);
+	for (size_t k = 0; k < m; ++k)
+	{
+		const double pos = _scale * static_cast<double>(k);
+		const size_t lo = static_cast<size_t>(pos);
+		const double frac = pos - static_cast<double>(lo);
+		_buffer[lo] += _row[k] * (1 - frac);
+		if (frac > 0.0)
+			_buffer[lo + 1] += _row[k] * frac;
+	}
+	kiss_fftr(fftF[_thread], _buffer.data(), reinterpret_cast<kiss_fft_cpx*>(_spectrum.data()));
+}
+
+void CAgglomerationFixedPivot2D::ClearFFT()
+{
+	for (auto& cfg : fftF)
+		kiss_fftr_free(cfg);
+	for (auto& cfg : fftB)
+		kiss_fftr_free(cfg);
+	fftF.clear();
+	fftB.clear();
+}
@@ -0,0 +1,60 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+
+#include "AgglomerationSolver.h"
+#include "kiss_fftr.h"
+#include <complex>
+
+/**
+ * Fixed pivot agglomeration solver for distributions over size and a secondary property.
+ * Sizes of agglomerates are assigned to the neighboring pivots with the fixed pivot technique.
+ * Secondary properties of agglomerates are convolutions of the distributions of both size classes, calculated with FFT.
+ * Complexity for n size classes and m classes of the secondary property:
+ * O(n^2 m + n m log m) for additive mixing, since each size class is transformed once and pair spectra are summed per target class;
+ * O(n^2 m log m) for volume-average mixing, since distributions are scaled and transformed for each pair.
+ * All pairs of size classes are visited to support general kernels, so the cost stays quadratic in n.
+ */
+class CAgglomerationFixedPivot2D : public CAgglomerationSolver
+{
+	using c_vect_t = std::vector<std::complex<double>>;
+
+	// Pair of agglomerating size classes.
+	struct SPair
+	{
+		size_t i{};				// Smaller size class.
+		size_t j{};				// Larger size class.
+		double beta{};			// Kernel, including the factor for pairs of the same class.
+		size_t target{};		// Lower size class, to which the agglomerate is assigned.
+		double share{};			// Share of the agglomerate assigned to the lower size class; the rest goes to the next class.
+		double weight{};		// Volume fraction of the smaller particle in the agglomerate.
+	};
+
+	size_t n{};								// Number of size classes.
+	size_t m{};								// Number of classes of the secondary property.
+	size_t length{};						// Length of FFT, sufficient for linear convolution.
+	size_t bins{};							// Number of frequency bins of FFT.
+	double offset{};						// Position of the sum of two secondary properties relative to the sum of their indices (for additive mixing).
+	std::vector<SPair> pairs;				// All pairs of agglomerating size classes.
+	std::vector<std::vector<size_t>> byTarget;	// Indices of pairs with agglomerates assigned to each size class, either as lower or upper class.
+	std::vector<c_vect_t> spectra;			// Spectra of distributions of the secondary property for each size class, for additive mixing.
+	std::vector<c_vect_t> products;			// Spectra of secondary properties of agglomerates for each pair.
+	std::vector<kiss_fftr_cfg> fftF;		// FFT configurations in forward direction, one for each thread.
+	std::vector<kiss_fftr_cfg> fftB;		// FFT configurations in backward direction, one for each thread.
+
+public:
+	void CreateBasicInfo() override;
+	void Initialize() override;
+	void Calculate(const d_vect_t& _n, d_vect_t& _rateB, d_vect_t& _rateD) override;
+	void Calculate(const d_matr_t& _n, d_matr_t& _rateB, d_matr_t& _rateD) override;
+	void Finalize() override;
+
+private:
+	// Calculates spectra of secondary properties of agglomerates of all pairs.
+	void CalculateProducts(const d_matr_t& _n);
+	// Projects distribution of the secondary property _row with positions scaled by _scale onto the grid and transforms it into the spectrum _spectrum.
+	void Transform(size_t _thread, const d_vect_t& _row, double _scale, d_vect_t& _buffer, c_vect_t& _spectrum) const;
+	// Frees FFT configurations.
+	void ClearFFT();
+};
@@ -0,0 +1,88 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#define DLL_EXPORT
+#include "BreakageCellAverage.h"
+#include "ThreadPool.h"
+#include <algorithm>
+
+extern "C" DECLDIR CBreakageSolver* CREATE_SOLVER_FUN_BRK1()
+{
+	return new CBreakageCellAverage();
+}
+
+void CBreakageCellAverage::CreateBasicInfo()
+{
+	SetName("Cell Average");
+	SetAuthorName("DyssolTEC GmbH");
+	SetUniqueID("DBE5DC331B384154B0A590D4F29C87D1");
+	SetVersion(1);
+	SetHelpLink("003_models/solver_breakage_cellaverage.html");
+}
+
+void CBreakageCellAverage::Initialize()
+{
+	n = m_pivots.size();
+
+	selection.resize(n);
+	numbers.assign(TriangularSize(n), 0.0);
+	volumes.assign(TriangularSize(n), 0.0);
+	ParallelFor(n, [&](size_t k)
+	{
+		selection[k] = Selection(m_pivots[k]);
+		// fragments of a particle are not larger than the particle itself; fragments below the grid are assigned to the first class
+		for (size_t i = 0; i <= k; ++i)
+		{
+			const double beg = i == 0 ? 0.0 : m_volumes[i];
+			const double end = std::min(m_volumes[i + 1], m_pivots[k]);
+			numbers[TriangularIndex(k, i)] = BreakageIntegral(beg, end, m_pivots[k], 0);
+			volumes[TriangularIndex(k, i)] = BreakageIntegral(beg, end, m_pivots[k], 1);
+		}
+	});
+}
+
+void CBreakageCellAverage::Calculate(const d_vect_t& _n, d_vect_t& _rateB, d_vect_t& _rateD)
+{
+	CheckDistribution(_n);
+	_rateB.assign(_n.size(), 0.0);
+	_rateD.assign(_n.size(), 0.0);
+
+	// number and volume of fragments born in each cell
+	birthN.assign(n, 0.0);
+	birthV.assign(n, 0.0);
+	for (size_t k = 0; k < n; ++k)
+	{
+		const double rate = selection[k] * _n[k];
+		if (rate == 0.0) continue;
+		_rateD[k] = rate;
+		const double* rowN = &numbers[TriangularIndex(k, 0)];
+		const double* rowV = &volumes[TriangularIndex(k, 0)];
+		for (size_t i = 0; i <= k; ++i)
+		{
+			birthN[i] += rowN[i] * rate;
+			birthV[i] += rowV[i] * rate;
+		}
+	}
+
+	// redistribution of births to the neighboring pivots according to the average volume of fragments in the cell
+	const d_vect_t& x = m_pivots;
+	for (size_t i = 0; i < n; ++i)
+	{
+		if (birthN[i] <= 0.0) continue;
+		const double average = birthV[i] / birthN[i];
+		if (average >= x[i] && i + 1 < n)
+		{
+			const double share = (average - x[i]) / (x[i + 1] - x[i]);
+			_rateB[i]     += birthN[i] * (1 - share);
+			_rateB[i + 1] += birthN[i] * share;
+		}
+		else if (average < x[i] && i > 0)
+		{
+			const double share = (x[i] - average) / (x[i] - x[i - 1]);
+			_rateB[i]     += birthN[i] * (1 - share);
+			_rateB[i - 1] += birthN[i] * share;
+		}
+		else // at the boundaries of the grid, only mass is preserved
+			_rateB[i] += birthV[i] / x[i];
+	}
+}
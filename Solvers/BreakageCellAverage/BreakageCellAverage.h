@@ -0,0 +1,21 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+
+#include "BreakageSolver.h"
+
+class CBreakageCellAverage : public CBreakageSolver
+{
+	size_t n{};				// Number of size classes.
+	d_vect_t selection;		// Selection function in pivots.
+	d_vect_t numbers;		// Numbers of fragments in each class from breakage of one particle of each class, lower triangular [parent][fragment].
+	d_vect_t volumes;		// Volumes of fragments in each class from breakage of one particle of each class, lower triangular [parent][fragment].
+	d_vect_t birthN;		// Number birth rates in classes before redistribution.
+	d_vect_t birthV;		// Volume birth rates in classes before redistribution.
+
+public:
+	void CreateBasicInfo() override;
+	void Initialize() override;
+	void Calculate(const d_vect_t& _n, d_vect_t& _rateB, d_vect_t& _rateD) override;
+};
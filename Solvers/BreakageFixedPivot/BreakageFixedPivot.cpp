@@ -0,0 +1,42 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#define DLL_EXPORT
+#include "BreakageFixedPivot.h"
+
+extern "C" DECLDIR CBreakageSolver* CREATE_SOLVER_FUN_BRK1()
+{
+	return new CBreakageFixedPivot();
+}
+
+void CBreakageFixedPivot::CreateBasicInfo()
+{
+	SetName("Fixed Pivot");
+	SetAuthorName("DyssolTEC GmbH");
+	SetUniqueID("9052EED486BF4219BE2C9FD3D0CCC605");
+	SetVersion(1);
+	SetHelpLink("003_models/solver_breakage_fixedpivot.html");
+}
+
+void CBreakageFixedPivot::Initialize()
+{
+	n = m_pivots.size();
+	FixedPivotFragments(selection, fragments);
+}
+
+void CBreakageFixedPivot::Calculate(const d_vect_t& _n, d_vect_t& _rateB, d_vect_t& _rateD)
+{
+	CheckDistribution(_n);
+	_rateB.assign(_n.size(), 0.0);
+	_rateD.assign(_n.size(), 0.0);
+
+	for (size_t k = 0; k < n; ++k)
+	{
+		const double rate = selection[k] * _n[k];
+		if (rate == 0.0) continue;
+		_rateD[k] = rate;
+		const double* row = &fragments[TriangularIndex(k, 0)];
+		for (size_t i = 0; i <= k; ++i)
+			_rateB[i] += row[i] * rate;
+	}
+}
@@ -0,0 +1,18 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+
+#include "BreakageSolver.h"
+
+class CBreakageFixedPivot : public CBreakageSolver
+{
+	size_t n{};				// Number of size classes.
+	d_vect_t selection;		// Selection function in pivots.
+	d_vect_t fragments;		// Numbers of fragments assigned to each pivot from breakage of one particle of each class, lower triangular [parent][fragment].
+
+public:
+	void CreateBasicInfo() override;
+	void Initialize() override;
+	void Calculate(const d_vect_t& _n, d_vect_t& _rateB, d_vect_t& _rateD) override;
+};
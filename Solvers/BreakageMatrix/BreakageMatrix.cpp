@@ -0,0 +1,70 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#define DLL_EXPORT
+#include "BreakageMatrix.h"
+#include "ThreadPool.h"
+
+extern "C" DECLDIR CBreakageSolver* CREATE_SOLVER_FUN_BRK1()
+{
+	return new CBreakageMatrix();
+}
+
+void CBreakageMatrix::CreateBasicInfo()
+{
+	SetName("Weighted Matrix");
+	SetAuthorName("DyssolTEC GmbH");
+	SetUniqueID("7D294531F1B84194B160E67D02DF3663");
+	SetVersion(1);
+	SetHelpLink("003_models/solver_breakage_matrix.html");
+}
+
+void CBreakageMatrix::Initialize()
+{
+	n = m_pivots.size();
+	const d_vect_t& x = m_pivots;
+
+	birth.assign(TriangularSize(n), 0.0);
+	death.assign(n, 0.0);
+	ParallelFor(n, [&](size_t k)
+	{
+		double* row = &birth[TriangularIndex(k, 0)];
+		// numbers of fragments in classes, the fragments in the own class are only smaller than the parent particle
+		for (size_t i = 0; i < k; ++i)
+			row[i] = BreakageIntegral(m_volumes[i], m_volumes[i + 1], x[k], 0);
+		row[k] = BreakageIntegral(m_volumes[k], x[k], x[k], 0);
+		// total number of fragments
+		const double nu = BreakageIntegral(0.0, x[k], x[k], 0);
+
+		// weights to preserve both number and mass of particles
+		double sumB = 0.0;
+		for (size_t i = 0; i < k; ++i)
+			sumB += (x[k] - x[i]) * row[i];
+		const double weightB = sumB != 0.0 ? x[k] * (nu - 1) / sumB : 0.0;
+		double sumD = 0.0;
+		for (size_t i = 0; i <= k; ++i)
+			sumD += x[i] * row[i];
+		const double weightD = weightB / x[k] * sumD;
+
+		const double s = Selection(x[k]);
+		for (size_t i = 0; i <= k; ++i)
+			row[i] *= weightB * s;
+		death[k] = weightD * s;
+	});
+}
+
+void CBreakageMatrix::Calculate(const d_vect_t& _n, d_vect_t& _rateB, d_vect_t& _rateD)
+{
+	CheckDistribution(_n);
+	_rateB.assign(_n.size(), 0.0);
+	_rateD.assign(_n.size(), 0.0);
+
+	for (size_t k = 0; k < n; ++k)
+	{
+		if (_n[k] == 0.0) continue;
+		_rateD[k] = death[k] * _n[k];
+		const double* row = &birth[TriangularIndex(k, 0)];
+		for (size_t i = 0; i <= k; ++i)
+			_rateB[i] += row[i] * _n[k];
+	}
+}
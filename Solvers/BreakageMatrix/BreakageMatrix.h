@@ -0,0 +1,18 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+
+#include "BreakageSolver.h"
+
+class CBreakageMatrix : public CBreakageSolver
+{
+	size_t n{};				// Number of size classes.
+	d_vect_t birth;			// Precalculated birth matrix including selection function, lower triangular [parent][fragment].
+	d_vect_t death;			// Precalculated death coefficients including selection function.
+
+public:
+	void CreateBasicInfo() override;
+	void Initialize() override;
+	void Calculate(const d_vect_t& _n, d_vect_t& _rateB, d_vect_t& _rateD) override;
+};
@@ -0,0 +1,307 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#define DLL_EXPORT
+#include "PBMFiniteVolume.h"
+#include "AgglomerationSolver.h"
+#include "BreakageSolver.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+extern "C" DECLDIR CPBMSolver* CREATE_SOLVER_FUN_PBM1()
+{
+	return new CPBMFiniteVolume();
+}
+
+namespace
+{
+	// Breakage solver with the fixed pivot technique for the breakage functions set directly to the PBM solver.
+	class CFixedPivotFragments : public CBreakageSolver
+	{
+	public:
+		std::vector<double> selection;	// Selection function in pivots.
+		std::vector<double> fragments;	// Numbers of fragments assigned to each pivot from breakage of one particle of each class, lower triangular [parent][fragment].
+
+		using CBreakageSolver::Initialize;
+		void CreateBasicInfo() override {}
+		void Initialize() override { FixedPivotFragments(selection, fragments); }
+	};
+
+	// Solves the tridiagonal system with the Thomas algorithm. _lower[0] and _upper[n-1] are not used. The solution is written to _rhs.
+	void SolveTridiagonal(const std::vector<double>& _lower, std::vector<double> _diag, const std::vector<double>& _upper, std::vector<double>& _rhs)
+	{
+		const size_t n = _rhs.size();
+		for (size_t i = 1; i < n; ++i)
+		{
+			const double m = _lower[i] / _diag[i - 1];
+			_diag[i] -= m * _upper[i - 1];
+			_rhs[i] -= m * _rhs[i - 1];
+		}
+		_rhs[n - 1] /= _diag[n - 1];
+		for (size_t i = n - 1; i-- > 0;)
+			_rhs[i] = (_rhs[i] - _upper[i] * _rhs[i + 1]) / _diag[i];
+	}
+}
+
+void CPBMFiniteVolume::CreateBasicInfo()
+{
+	SetName("Finite Volume");
+	SetAuthorName("DyssolTEC GmbH");
+	SetUniqueID("AE0CF0D4B30A4995A361C9EF81EF9CD7");
+	SetVersion(1);
+	SetHelpLink("003_models/solver_pbmfinitevolume.html");
+}
+
+void CPBMFiniteVolume::Initialize()
+{
+	n = m_grid.size() - 1;
+	width.resize(n);
+	for (size_t i = 0; i < n; ++i)
+		width[i] = m_grid[i + 1] - m_grid[i];
+	growth.assign(n + 1, 0.0);
+	deathAgg.assign(n, 0.0);
+	deathBrk.assign(n, 0.0);
+	step = 0.0;
+	stepStored = 0.0;
+
+	CalculateFragments();
+}
+
+void CPBMFiniteVolume::Calculate(double _timeBeg, double _timeEnd, d_vect_t& _n)
+{
+	if (_n.size() != n)
+		RaiseError("Size of the distribution does not match the PSD grid.");
+	if (_timeEnd <= _timeBeg) return;
+
+	// growth rates on the inner boundaries of classes, no fluxes through the outer boundaries of the grid
+	for (size_t j = 1; j < n; ++j)
+		growth[j] = m_growth ? m_growth(m_grid[j]) : 0.0;
+
+	constexpr size_t maxSteps = 100000;	// maximum number of time steps
+	constexpr size_t maxIters = 4;		// maximum number of Newton iterations per time step
+	const double interval = _timeEnd - _timeBeg;
+
+	double time = _timeBeg;
+	double h = step > 0.0 ? std::min(step, interval) : interval * 1e-3;	// current time step
+	double hPrev = 0.0;	// last accepted time step
+	d_vect_t prev(n), rates(n), pred(n), next(n), delta(n), weights(n);
+	d_vect_t lower(n), diag(n), upper(n), a(n), b(n), c(n);
+	bool isNew = true;	// whether the current point has changed since the last evaluation of rates
+	for (size_t iStep = 0; time < _timeEnd;)
+	{
+		if (++iStep > maxSteps)
+			RaiseError("Maximum number of time steps exceeded.");
+
+		// avoid too short steps at the end of the interval
+		const double hFull = h;
+		const bool isTruncated = _timeEnd - time - h < 0.1 * h;
+		if (isTruncated)
+			h = _timeEnd - time;
+
+		if (isNew)
+		{
+			double total = 0.0;
+			for (const double v : _n)
+				total += std::abs(v);
+			const double atol = std::max(m_atol * total, std::numeric_limits<double>::min());
+			for (size_t i = 0; i < n; ++i)
+				weights[i] = 1.0 / (m_rtol * std::abs(_n[i]) + atol);
+			Rates(_n, rates);
+			Jacobian(_n, lower, diag, upper);
+			isNew = false;
+		}
+
+		// predictor: extrapolation of the last step or explicit Euler for the first step
+		for (size_t i = 0; i < n; ++i)
+			pred[i] = hPrev > 0.0 ? _n[i] + h / hPrev * (_n[i] - prev[i]) : _n[i] + h * rates[i];
+
+		// corrector: implicit Euler solved with simplified Newton iterations with the approximate Jacobian
+		for (size_t i = 0; i < n; ++i)
+		{
+			a[i] = -h * lower[i];
+			b[i] = 1.0 - h * diag[i];
+			c[i] = -h * upper[i];
+			next[i] = std::max(pred[i], 0.0);
+		}
+		bool isConverged = false;
+		for (size_t iter = 0; iter < maxIters && !isConverged; ++iter)
+		{
+			Rates(next, delta);
+			for (size_t i = 0; i < n; ++i)
+				delta[i] = _n[i] + h * delta[i] - next[i];
+			SolveTridiagonal(a, b, c, delta);
+			for (size_t i = 0; i < n; ++i)
+				next[i] += delta[i];
+			isConverged = Norm(delta, weights) <= 0.1;
+		}
+		if (!isConverged)
+		{
+			h *= 0.25;
+			if (h < interval * 1e-12)
+				RaiseError("Time step became too small.");
+			continue;
+		}
+
+		// local error estimate from the difference between corrector and predictor
+		for (size_t i = 0; i < n; ++i)
+			delta[i] = next[i] - pred[i];
+		const double error = h / (h + (hPrev > 0.0 ? hPrev : h)) * Norm(delta, weights);
+		if (error > 1.0)
+		{
+			h *= std::max(0.2, 0.9 / std::sqrt(error));
+			continue;
+		}
+
+		// accept the step
+		prev.swap(_n);
+		for (size_t i = 0; i < n; ++i)
+			_n[i] = std::max(next[i], 0.0);
+		time += h;
+		hPrev = h;
+		h = isTruncated ? hFull : h * std::min(2.0, 0.9 / std::sqrt(std::max(error, 1e-4)));
+		isNew = true;
+	}
+
+	step = h;
+}
+
+void CPBMFiniteVolume::SaveState()
+{
+	stepStored = step;
+}
+
+void CPBMFiniteVolume::LoadState()
+{
+	step = stepStored;
+}
+
+void CPBMFiniteVolume::Rates(const d_vect_t& _n, d_vect_t& _rates)
+{
+	_rates.assign(n, 0.0);
+
+	// growth: fluxes through the inner boundaries of classes, upwind with van Leer limiter on number densities
+	for (size_t j = 1; j < n; ++j)
+	{
+		const double g = growth[j];
+		if (g == 0.0) continue;
+		const bool isPositive = g > 0.0;
+		const size_t u = isPositive ? j - 1 : j;	// upwind class
+		const size_t d = isPositive ? j : j - 1;	// downwind class
+		double face = _n[u] / width[u];
+		if (isPositive ? u > 0 : u + 1 < n)
+		{
+			const size_t uu = isPositive ? u - 1 : u + 1;	// second upwind class
+			const double slopeU = _n[u] / width[u] - _n[uu] / width[uu];
+			const double slopeD = _n[d] / width[d] - _n[u] / width[u];
+			if (slopeU * slopeD > 0.0)
+				face += slopeU * slopeD / (slopeU + slopeD);
+		}
+		const double flux = g * face;
+		_rates[j - 1] -= flux;
+		_rates[j] += flux;
+	}
+
+	// agglomeration
+	if (m_agglomeration)
+	{
+		d_vect_t birth;
+		m_agglomeration->Calculate(_n, birth, deathAgg);
+		for (size_t i = 0; i < n; ++i)
+			_rates[i] += birth[i] - deathAgg[i];
+	}
+
+	// breakage
+	if (m_breakage)
+	{
+		d_vect_t birth;
+		m_breakage->Calculate(_n, birth, deathBrk);
+		for (size_t i = 0; i < n; ++i)
+			_rates[i] += birth[i] - deathBrk[i];
+	}
+	else if (!selection.empty())
+		for (size_t k = 0; k < n; ++k)
+		{
+			const double rate = selection[k] * _n[k];
+			if (rate == 0.0) continue;
+			_rates[k] -= rate;
+			for (size_t i = 0; i <= k; ++i)
+				_rates[i] += fragments[k][i] * rate;
+		}
+
+	// inflow and outflow
+	for (size_t i = 0; i < n; ++i)
+		_rates[i] += (m_inflow.empty() ? 0.0 : m_inflow[i]) - Outflow(i) * _n[i];
+}
+
+void CPBMFiniteVolume::Jacobian(const d_vect_t& _n, d_vect_t& _lower, d_vect_t& _diag, d_vect_t& _upper) const
+{
+	_lower.assign(n, 0.0);
+	_diag.assign(n, 0.0);
+	_upper.assign(n, 0.0);
+
+	// growth with first-order upwind fluxes
+	for (size_t j = 1; j < n; ++j)
+	{
+		const double g = growth[j];
+		if (g > 0.0)
+		{
+			_diag[j - 1] -= g / width[j - 1];
+			_lower[j]    += g / width[j - 1];
+		}
+		else if (g < 0.0)
+		{
+			_diag[j]      += g / width[j];
+			_upper[j - 1] -= g / width[j];
+		}
+	}
+
+	// agglomeration, only the death of particles in the class itself
+	if (m_agglomeration)
+		for (size_t i = 0; i < n; ++i)
+			if (_n[i] > 0.0)
+				_diag[i] -= deathAgg[i] / _n[i];
+
+	// breakage: with a solver, only the death of particles in the class itself; otherwise into the same and the neighboring smaller class
+	if (m_breakage)
+		for (size_t i = 0; i < n; ++i)
+			if (_n[i] > 0.0)
+				_diag[i] -= deathBrk[i] / _n[i];
+	if (!m_breakage && !selection.empty())
+		for (size_t k = 0; k < n; ++k)
+		{
+			_diag[k] -= selection[k] * (1.0 - fragments[k][k]);
+			if (k > 0)
+				_upper[k - 1] += selection[k] * fragments[k][k - 1];
+		}
+
+	// outflow
+	for (size_t i = 0; i < n; ++i)
+		_diag[i] -= Outflow(i);
+}
+
+void CPBMFiniteVolume::CalculateFragments()
+{
+	selection.clear();
+	fragments.clear();
+	if (!m_selection || !m_fragments) return;
+
+	// the same pivots and fragments as in the fixed pivot breakage solver
+	CFixedPivotFragments solver;
+	solver.Initialize(m_grid, 1.0, m_selection, m_fragments);
+	selection = std::move(solver.selection);
+	fragments.resize(n);
+	for (size_t k = 0; k < n; ++k)
+	{
+		const double* row = &solver.fragments[k * (k + 1) / 2];
+		fragments[k].assign(row, row + k + 1);
+	}
+}
+
+double CPBMFiniteVolume::Norm(const d_vect_t& _v, const d_vect_t& _weights)
+{
+	double res = 0.0;
+	for (size_t i = 0; i < _v.size(); ++i)
+		res += std::pow(_v[i] * _weights[i], 2);
+	return std::sqrt(res / static_cast<double>(_v.size()));
+}
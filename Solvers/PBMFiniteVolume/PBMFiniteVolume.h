@@ -0,0 +1,36 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+
+#include "PBMSolver.h"
+
+class CPBMFiniteVolume : public CPBMSolver
+{
+	size_t n{};					// Number of size classes.
+	d_vect_t width;				// Widths of size classes.
+	d_vect_t growth;			// Growth rates on the boundaries of size classes.
+	d_vect_t selection;			// Breakage rates of size classes.
+	d_matr_t fragments;			// Numbers of fragments assigned to each size class from breakage of one particle of the size class: [parent][fragment].
+	d_vect_t deathAgg;			// Death rates due to agglomeration from the last calculation of rates.
+	d_vect_t deathBrk;			// Death rates due to breakage from the last calculation of rates.
+	double step{};				// Time step to start the next integration with.
+	double stepStored{};		// Stored time step.
+
+public:
+	void CreateBasicInfo() override;
+	void Initialize() override;
+	void Calculate(double _timeBeg, double _timeEnd, d_vect_t& _n) override;
+	void SaveState() override;
+	void LoadState() override;
+
+private:
+	// Calculates rates of change of numbers of particles in all classes.
+	void Rates(const d_vect_t& _n, d_vect_t& _rates);
+	// Calculates the tridiagonal approximation of the Jacobian of rates, neglecting flux limiters and birth terms.
+	void Jacobian(const d_vect_t& _n, d_vect_t& _lower, d_vect_t& _diag, d_vect_t& _upper) const;
+	// Calculates the numbers of fragments of each parent class assigned to the pivots with the fixed pivot technique of the breakage solvers.
+	void CalculateFragments();
+	// Returns weighted root mean square norm of the vector.
+	static double Norm(const d_vect_t& _v, const d_vect_t& _weights);
+};
@@ -83,6 +83,7 @@ void CAgglomerator::Initialize(double _time)
 		m_solver.SetMaxStep(maxStep);
 	if (!m_solver.SetModel(&m_model))
 		RaiseError(m_solver.GetError());
+	m_solver.SetStatisticsHandler(RegisterSolver("DAE"));
 
 	/// Initialize agglomeration calculator ///
 	m_aggSolver = GetSolverAgglomeration("Solver");
@@ -32,6 +32,7 @@ void CBunker::CreateStructure()
 	m_upTargetMass = AddConstRealParameter("Target mass"       , 100000, "kg"  , "Target mass of bunker."                                         , 0.0);
 	m_upRTol       = AddConstRealParameter("Relative tolerance", 0.0   , "-"   , "Solver relative tolerance. Set to 0 to use flowsheet-wide value", 0.0);
 	m_upATol       = AddConstRealParameter("Absolute tolerance", 0.0   , "-"   , "Solver absolute tolerance. Set to 0 to use flowsheet-wide value", 0.0);
+	m_upOutputStep = AddConstRealParameter("Output step"       , 0.0   , "s"   , "Step of output time points. Set to 0 to output each solver step", 0.0);
 
 	// group unit parameters
 	AddParametersToGroup("Model", "Constant", { m_upMassFlow->GetName() });
@@ -114,6 +115,12 @@ void CBunker::Initialize(double _time)
 	/// Set model to the solver ///
 	if (!m_solver.SetModel(&m_model))
 		RaiseError(m_solver.GetError());
+	m_solver.SetStatisticsHandler(RegisterSolver("DAE"));
+
+	/// Set output time points ///
+	const auto outputStep = m_upOutputStep->GetValue();
+	m_solver.SetOutputMode(outputStep != 0.0 ? EDAEOutputMode::GRID : EDAEOutputMode::EACH_STEP);
+	m_solver.SetOutputStep(outputStep);
 }
 
 void CBunker::Simulate(double _timeBeg, double _timeEnd)
@@ -134,8 +141,16 @@ void CBunker::Simulate(double _timeBeg, double _timeEnd)
 	}
 
 	/// Run solver ///
-	// iterate over all input time point to properly react on all signal changes
 	const auto allTP = GetAllTimePointsClosed(_timeBeg, _timeEnd);
+	if (m_solver.GetOutputMode() == EDAEOutputMode::GRID)
+	{
+		// stop at all input time points to properly react on all signal changes, output only on the grid
+		m_solver.SetDiscontinuityTimes(allTP);
+		if (!m_solver.Calculate(_timeBeg, _timeEnd))
+			RaiseError(m_solver.GetError());
+		return;
+	}
+	// iterate over all input time point to properly react on all signal changes
 	for (size_t i = 0; i < allTP.size() - 1; ++i)
 	{
 		m_solver.SetMaxStep(0.25 * (allTP[i + 1] - allTP[i]));
@@ -46,6 +46,7 @@ public:
 	CConstRealUnitParameter* m_upTargetMass{}; // Unit parameter: target mass.
 	CConstRealUnitParameter* m_upRTol{};       // Unit parameter: Relative tolerance.
 	CConstRealUnitParameter* m_upATol{};       // Unit parameter: Absolute tolerance.
+	CConstRealUnitParameter* m_upOutputStep{}; // Unit parameter: Step of output time points.
 
 public:
 	void CreateBasicInfo() override;
@@ -102,6 +102,7 @@ void CSimpleGranulator::Initialize(double _time)
 	/// Set model to a solver ///
 	if (!m_solver.SetModel(&m_model))
 		RaiseError(m_solver.GetError());
+	m_solver.SetStatisticsHandler(RegisterSolver("DAE"));
 }
 
 void CSimpleGranulator::SaveState()
@@ -115,6 +115,7 @@ void CGranulatorSimpleBatch::Initialize(double _time)
 	/// Set model to a solver ///
 	if (!m_solver.SetModel(&m_model))
 		RaiseError(m_solver.GetError());
+	m_solver.SetStatisticsHandler(RegisterSolver("DAE"));
 }
 
 void CGranulatorSimpleBatch::SaveState()
@@ -0,0 +1,157 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#define DLL_EXPORT
+#include "PopulationBalance.h"
+#include <numeric>
+
+extern "C" DECLDIR CBaseUnit* DYSSOL_CREATE_MODEL_FUN()
+{
+	return new CPopulationBalance();
+}
+
+void CPopulationBalance::CreateBasicInfo()
+{
+	/// Basic unit's info ///
+	SetUnitName("Population balance");
+	SetAuthorName("DyssolTEC GmbH");
+	SetUniqueID("0B4D5D0E3E6A4F6C9B5C2F1D7A8E9C31");
+	SetHelpLink("003_models/unit_populationbalance.html");
+}
+
+void CPopulationBalance::CreateStructure()
+{
+	/// Add ports ///
+	AddPort("Input", EUnitPort::INPUT);
+	AddPort("Output", EUnitPort::OUTPUT);
+
+	/// Add unit parameters ///
+	AddSolverPBM("PBM solver", "Solver to integrate the population balance");
+	AddConstRealParameter("Residence time", 60, "s"  , "Residence time of particles in the apparatus"                  , 0);
+	AddConstRealParameter("Growth rate"   , 0 , "m/s", "Size independent growth rate of particle diameter"             , 0);
+	AddConstRealParameter("Agglomeration rate", 0, "-", "Size independent agglomeration rate. Set to 0 to disable agglomeration", 0);
+	AddSolverAgglomeration("Agglomeration solver", "Solver to calculate agglomeration rates");
+	AddComboParameter("Kernel", E2I(CAgglomerationSolver::EKernels::CONSTANT),
+		E2I({ CAgglomerationSolver::EKernels::CONSTANT, CAgglomerationSolver::EKernels::SUM, CAgglomerationSolver::EKernels::PRODUCT, CAgglomerationSolver::EKernels::BROWNIAN, CAgglomerationSolver::EKernels::SHEAR, CAgglomerationSolver::EKernels::PEGLOW, CAgglomerationSolver::EKernels::COAGULATION, CAgglomerationSolver::EKernels::GRAVITATIONAL, CAgglomerationSolver::EKernels::EKE, CAgglomerationSolver::EKernels::THOMPSON }),
+		{ "Constant","Sum","Product","Brownian","Shear","Peglow","Coagulation","Gravitational","Kinetic energy","Thompson" },
+		"Agglomeration kernel");
+	AddConstRealParameter("Breakage rate" , 0 , "1/s", "Size independent breakage rate. Set to 0 to disable breakage" , 0);
+	AddSolverBreakage("Breakage solver", "Solver to calculate breakage rates");
+	AddComboParameter("Selection", E2I(CBreakageSolver::ESelection::CONSTANT),
+		E2I({ CBreakageSolver::ESelection::CONSTANT, CBreakageSolver::ESelection::LINEAR, CBreakageSolver::ESelection::QUADRATIC, CBreakageSolver::ESelection::POWER, CBreakageSolver::ESelection::EXPONENTIAL, CBreakageSolver::ESelection::KING, CBreakageSolver::ESelection::AUSTIN }),
+		{ "Constant", "Linear", "Quadratic", "Power", "Exponential", "King", "Austin" },
+		"Breakage selection function");
+	AddConstRealParameter("Selection P1", 1, "-", "Parameter P1 of the selection function");
+	AddConstRealParameter("Selection P2", 1, "-", "Parameter P2 of the selection function");
+	AddConstRealParameter("Selection P3", 1, "-", "Parameter P3 of the selection function");
+	AddComboParameter("Breakage", E2I(CBreakageSolver::EBreakage::BINARY),
+		E2I({ CBreakageSolver::EBreakage::BINARY, CBreakageSolver::EBreakage::DIEMER, CBreakageSolver::EBreakage::VOGEL, CBreakageSolver::EBreakage::AUSTIN }),
+		{ "Binary", "Diemer", "Vogel", "Austin" },
+		"Breakage function");
+	AddConstRealParameter("Breakage P1", 1, "-", "Parameter P1 of the breakage function");
+	AddConstRealParameter("Breakage P2", 1, "-", "Parameter P2 of the breakage function");
+	AddConstRealParameter("Breakage P3", 1, "-", "Parameter P3 of the breakage function");
+	AddConstRealParameter("Relative tolerance", 0.0, "-", "Solver relative tolerance. Set to 0 to use flowsheet-wide value", 0.0);
+	AddConstRealParameter("Absolute tolerance", 0.0, "-", "Solver absolute tolerance. Set to 0 to use flowsheet-wide value", 0.0);
+
+	/// Group unit parameters ///
+	AddParametersToGroup("Selection", "Constant"   , { "Selection P1" });
+	AddParametersToGroup("Selection", "Power"      , { "Selection P1" });
+	AddParametersToGroup("Selection", "Exponential", { "Selection P1" });
+	AddParametersToGroup("Selection", "King"       , { "Selection P1", "Selection P2", "Selection P3" });
+	AddParametersToGroup("Selection", "Austin"     , { "Selection P1", "Selection P2" });
+	AddParametersToGroup("Breakage" , "Diemer"     , { "Breakage P1", "Breakage P2" });
+	AddParametersToGroup("Breakage" , "Vogel"      , { "Breakage P1", "Breakage P2" });
+	AddParametersToGroup("Breakage" , "Austin"     , { "Breakage P1", "Breakage P2", "Breakage P3" });
+}
+
+void CPopulationBalance::Initialize(double /*_time*/)
+{
+	/// Check flowsheet parameters ///
+	if (!IsPhaseDefined(EPhase::SOLID))		RaiseError("Solid phase has not been defined.");
+	if (!IsDistributionDefined(DISTR_SIZE))	RaiseError("Size distribution has not been defined.");
+
+	/// Get pointers to streams ///
+	m_inlet  = GetPortStream("Input");
+	m_outlet = GetPortStream("Output");
+
+	/// Get PSD grid parameters ///
+	m_grid = GetNumericGrid(DISTR_SIZE);
+	const std::vector<double> volumes = DiameterToVolume(m_grid);
+	m_volumes.resize(m_grid.size() - 1);
+	for (size_t i = 0; i < m_volumes.size(); ++i)
+		m_volumes[i] = (volumes[i] + volumes[i + 1]) / 2.;
+
+	/// Get unit parameters ///
+	m_time = GetConstRealParameterValue("Residence time");
+	const double growth = GetConstRealParameterValue("Growth rate");
+	const double agglomeration = GetConstRealParameterValue("Agglomeration rate");
+	const double breakage = GetConstRealParameterValue("Breakage rate");
+
+	/// Initialize agglomeration solver ///
+	m_agglomeration = nullptr;
+	if (agglomeration != 0.0)
+	{
+		m_agglomeration = GetSolverAgglomeration("Agglomeration solver");
+		if (!m_agglomeration)
+		{
+			RaiseError("Cannot load agglomeration solver.");
+			return;
+		}
+		m_agglomeration->Initialize(m_grid, agglomeration, V2E<CAgglomerationSolver::EKernels>(GetComboParameterValue("Kernel")));
+	}
+
+	/// Initialize breakage solver ///
+	m_breakage = nullptr;
+	if (breakage != 0.0)
+	{
+		m_breakage = GetSolverBreakage("Breakage solver");
+		if (!m_breakage)
+		{
+			RaiseError("Cannot load breakage solver.");
+			return;
+		}
+		m_breakage->Initialize(m_grid, breakage,
+			V2E<CBreakageSolver::ESelection>(GetComboParameterValue("Selection")), V2E<CBreakageSolver::EBreakage>(GetComboParameterValue("Breakage")),
+			{ GetConstRealParameterValue("Selection P1"), GetConstRealParameterValue("Selection P2"), GetConstRealParameterValue("Selection P3") },
+			{ GetConstRealParameterValue("Breakage P1"), GetConstRealParameterValue("Breakage P2"), GetConstRealParameterValue("Breakage P3") });
+	}
+
+	/// Initialize population balance solver ///
+	m_pbm = GetSolverPBM("PBM solver");
+	if (!m_pbm)
+	{
+		RaiseError("Cannot load PBM solver.");
+		return;
+	}
+	const auto rtol = GetConstRealParameterValue("Relative tolerance");
+	const auto atol = GetConstRealParameterValue("Absolute tolerance");
+	m_pbm->SetGrowthRate(growth != 0.0 ? [growth](double) { return growth; } : std::function<double(double)>{});
+	m_pbm->SetAgglomerationSolver(m_agglomeration);
+	m_pbm->SetBreakageSolver(m_breakage);
+	m_pbm->SetTolerances(rtol != 0.0 ? rtol : GetRelTolerance(), atol != 0.0 ? atol : GetAbsTolerance());
+	m_pbm->Initialize(m_grid);
+
+	/// Add state variables ///
+	AddStateVariable("Number ratio", 1);
+	AddStateVariable("Volume ratio", 1);
+}
+
+void CPopulationBalance::Simulate(double _time)
+{
+	/// Copy the time point from inlet to outlet ///
+	m_outlet->CopyFromStream(_time, m_inlet);
+
+	std::vector<double> n = m_inlet->GetPSD(_time, PSD_Number);
+	const double numberIn = VectorSum(n);
+	const double volumeIn = std::inner_product(n.begin(), n.end(), m_volumes.begin(), 0.0);
+	if (numberIn == 0.0) return;
+
+	/// Integrate population balance over the residence time ///
+	m_pbm->Calculate(0.0, m_time, n);
+	m_outlet->SetPSD(_time, PSD_Number, n);
+
+	/// Ratios of total numbers and volumes of particles in outlet and inlet ///
+	SetStateVariable("Number ratio", VectorSum(n) / numberIn, _time);
+	SetStateVariable("Volume ratio", std::inner_product(n.begin(), n.end(), m_volumes.begin(), 0.0) / volumeIn, _time);
+}
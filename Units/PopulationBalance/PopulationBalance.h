@@ -0,0 +1,24 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+
+#include "UnitDevelopmentDefines.h"
+
+class CPopulationBalance : public CSteadyStateUnit
+{
+	CMaterialStream* m_inlet{ nullptr };				// Pointer to inlet stream.
+	CMaterialStream* m_outlet{ nullptr };				// Pointer to outlet stream.
+	CPBMSolver* m_pbm{ nullptr };						// Population balance solver.
+	CAgglomerationSolver* m_agglomeration{ nullptr };	// Agglomeration solver.
+	CBreakageSolver* m_breakage{ nullptr };				// Breakage solver.
+	double m_time{};									// Residence time.
+	std::vector<double> m_grid;							// Diameter grid for PSD.
+	std::vector<double> m_volumes;						// Mean volumes of particles in each grid class.
+
+public:
+	void CreateBasicInfo() override;
+	void CreateStructure() override;
+	void Initialize(double _time) override;
+	void Simulate(double _time) override;
+};
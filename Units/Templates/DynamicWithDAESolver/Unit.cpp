@@ -56,6 +56,7 @@ void CUnit::Initialize(double _time)
 	/// Set model to the solver ///
 	if (!m_Solver.SetModel(&m_Model))
 		RaiseError(m_Solver.GetError());
+	m_Solver.SetStatisticsHandler(RegisterSolver("DAE"));
 
 
 }
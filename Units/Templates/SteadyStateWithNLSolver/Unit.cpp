@@ -2,6 +2,7 @@
 
 #define DLL_EXPORT
 #include "Unit.h"
+#include <numeric>
 
 extern "C" DECLDIR CBaseUnit* DYSSOL_CREATE_MODEL_FUN()
 {
@@ -49,6 +50,7 @@ void CUnit::Initialize(double _time)
 	/// Set model to the solver ///
 	if (!m_NLSolver.SetModel(&m_NLModel))
 		RaiseError(m_NLSolver.GetError());
+	m_NLSolver.SetStatisticsHandler(RegisterSolver("NL"));
 
 
 }
@@ -64,6 +66,13 @@ void CUnit::Simulate(double _time)
 	if (!m_NLSolver.Calculate(_time))
 		RaiseError(m_NLSolver.GetError());
 
+	/// Run solver for independent systems, one for each compound ///
+	m_compoundValues.assign(GetCompoundsNumber(), 0.0);
+	if (!m_NLSolver.CalculateBatch(GetCompoundsNumber()))
+		RaiseError(m_NLSolver.GetError());
+
+	/// Do something with results of all systems ///
+	SetStateVariable("VarName", std::accumulate(m_compoundValues.begin(), m_compoundValues.end(), 0.0), _time);
 
 }
 
@@ -116,3 +125,26 @@ void CMyNLModel::ResultsHandler(double _time, double* _vars, void* _unit)
 
 
 }
+
+void CMyNLModel::CalculateSystemFunctions(size_t _system, double* _vars, double* _func, void* _unit)
+{
+	// called in parallel for different systems: only read data of the unit here
+	const auto* unit = static_cast<CUnit*>(_unit);
+
+	/// Get value of variable ///
+	const double value0 = _vars[m_iVariable0];
+	const double value1 = _vars[m_iVariable1];
+
+	/// Calculate residual for the compound with index of the system ///
+	_func[m_iVariable0] =  - value0 - value1 - unit->GetCompoundProperty(unit->GetCompoundKey(_system), MOLAR_MASS);
+	_func[m_iVariable1] = std::pow(value0, 2) + std::pow(value1, 2) - 17;
+}
+
+void CMyNLModel::SystemResultsHandler(size_t _system, double* _vars, void* _unit)
+{
+	// called sequentially for all systems after all of them are solved
+	auto* unit = static_cast<CUnit*>(_unit);
+
+	/// Do something with results of each system ///
+	unit->m_compoundValues[_system] = std::fabs(_vars[m_iVariable0]) + std::fabs(_vars[m_iVariable1]);
+}
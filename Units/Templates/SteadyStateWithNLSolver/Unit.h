@@ -12,6 +12,8 @@ public:
 
 	void CalculateFunctions(double* _vars, double* _func, void* _unit) override;
 	void ResultsHandler(double _time, double* _vars, void* _unit) override;
+	void CalculateSystemFunctions(size_t _system, double* _vars, double* _func, void* _unit) override;
+	void SystemResultsHandler(size_t _system, double* _vars, void* _unit) override;
 };
 
 class CUnit : public CSteadyStateUnit
@@ -21,6 +23,9 @@ private:
 	CNLSolver m_NLSolver{};	// Solver of nonlinear system of equations
 
 public:
+	std::vector<double> m_compoundValues{};	// Results of systems solved for each compound
+
+
 	void CreateBasicInfo() override;
 	void CreateStructure() override;
 	void Initialize(double _time) override;
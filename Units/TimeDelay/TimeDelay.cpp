@@ -150,9 +150,22 @@ void CTimeDelay::InitializeNormBased(double _time)
 	const auto atol = GetConstRealParameterValue("Absolute tolerance");
 	m_DAEModel.SetTolerance(rtol != 0.0 ? rtol : GetRelTolerance(), atol != 0.0 ? atol : GetAbsTolerance());
 
+	/// Set sparsity pattern of the Jacobian: each residual depends only on its own variable ///
+	if (CDAESolver::IsUserJacobianSupported())
+	{
+		std::vector<std::vector<size_t>> pattern(m_DAEModel.GetVariablesNumber());
+		for (size_t i = 0; i < pattern.size(); ++i)
+			pattern[i] = { i };
+		m_DAEModel.SetJacobianPattern(pattern);
+	}
+
+	/// Set root function to stop the solver exactly when the delayed signal starts ///
+	m_DAEModel.SetRootsNumber(m_timeDelay > 0.0 ? 1 : 0);
+
 	/// Set model to the solver ///
 	if (!m_DAESolver.SetModel(&m_DAEModel))
 		RaiseError(m_DAESolver.GetError());
+	m_DAESolver.SetStatisticsHandler(RegisterSolver("DAE"));
 
 	/// Set this unit as user data of model ///
 	m_DAEModel.SetUserData(this);
@@ -190,6 +203,13 @@ void CMyDAEModel::ResultsHandler(double _time, double* _vars, double* _ders, voi
 	unit->m_outlet->SetMassFlow(_time, _vars[m_iMflow]);
 }
 
+void CMyDAEModel::CalculateRoots(double _time, double* _vars, double* _ders, double* _roots, void* _unit)
+{
+	const auto* unit = static_cast<CTimeDelay*>(_unit);
+	// residuals switch at the time delay
+	_roots[0] = _time - unit->m_timeDelay;
+}
+
 void CMyDAEModel::CalculateResiduals(double _time, double* _vars, double* _ders, double* _res, void* _unit)
 {
 	/// General information ///
@@ -17,6 +17,7 @@ public:
 
 public:
 	void CalculateResiduals(double _time, double* _vars, double* _ders, double* _res, void* _unit) override;
+	void CalculateRoots(double _time, double* _vars, double* _ders, double* _roots, void* _unit) override;
 	void ResultsHandler(double _time, double* _vars, double* _ders, void* _unit) override;
 };
 
@@ -38,13 +38,23 @@ constexpr bool     DEFAULT_CACHE_FLAG_HOLDUPS  = false; ///< Default value.
 constexpr bool     DEFAULT_CACHE_FLAG_INTERNAL = false; ///< Default value.
 constexpr uint32_t DEFAULT_CACHE_WINDOW      = 100;     ///< Default value.
 
+// File storage
+constexpr uint32_t DEFAULT_FILE_COMPRESSION    = 0;     ///< Default value.
+constexpr bool     DEFAULT_FILE_SHUFFLE_FLAG   = true;  ///< Default value.
+constexpr bool     DEFAULT_FILE_CHECKSUM_FLAG  = false; ///< Default value.
+constexpr uint32_t DEFAULT_FILE_CHUNK_SIZE     = 0;     ///< Default value.
+constexpr uint32_t DEFAULT_FILE_CACHE_SIZE     = 50;    ///< Default value.
+constexpr bool     DEFAULT_FILE_INCREMENTAL    = false; ///< Default value.
+
 // Initial minimal fraction
 constexpr double DEFAULT_MIN_FRACTION = 0; ///< Default value.
 
 // Enthalpy calculator
-constexpr double   DEFAULT_ENTHALPY_MIN_T     = 173;  ///< Default value.
-constexpr double   DEFAULT_ENTHALPY_MAX_T     = 1273; ///< Default value.
-constexpr uint32_t DEFAULT_ENTHALPY_INTERVALS = 100;  ///< Default value.
+constexpr double   DEFAULT_ENTHALPY_MIN_T            = 173;  ///< Default value.
+constexpr double   DEFAULT_ENTHALPY_MAX_T            = 1273; ///< Default value.
+constexpr uint32_t DEFAULT_ENTHALPY_INTERVALS        = 100;  ///< Default value.
+constexpr uint32_t DEFAULT_ENTHALPY_CACHE_SIZE       = 64;   ///< Default value.
+constexpr double   DEFAULT_ENTHALPY_CACHE_RESOLUTION = 1e-9; ///< Default value.
 
 
 /**
@@ -30,6 +30,7 @@ namespace StrConst
 	const char* const Dyssol_ConfigLastParamName	          = "lastFile";
 	const char* const Dyssol_ConfigRecentParamName	          = "recentFiles";
 	const char* const Dyssol_ConfigLoadLastFlag		          = "loadLast";
+	const char* const Dyssol_ConfigLazyLoadingFlag		      = "lazyLoading";
 	const char* const Dyssol_ConfigDMDBPath			          = "materialsDBPath";
 	const char* const Dyssol_ConfigCachePath		          = "cachePath";
 	const char* const Dyssol_CacheDirRelease		          = "/cache";
@@ -67,6 +68,18 @@ namespace StrConst
 //////////////////////////////////////////////////////////////////////////
 /// DyssolC
 //////////////////////////////////////////////////////////////////////////
+	inline std::string DyssolC_StartJob(size_t i) {
+		return " ===== Starting job: " + std::to_string(i) + " ===== "; }
+	inline std::string DyssolC_RunJobs(size_t n) {
+		return "Running jobs in parallel: \n\t" + std::to_string(n); }
+	inline std::string DyssolC_RunSweep(size_t n, size_t t) {
+		return "Running parameter sweep: \n\t" + std::to_string(n) + " runs, " + std::to_string(t) + " in parallel"; }
+	inline std::string DyssolC_StartBenchmarkRun(size_t i, size_t n) {
+		return " ##### Benchmark run " + std::to_string(i) + " of " + std::to_string(n) + " ##### "; }
+	inline std::string DyssolC_WriteBenchmark(const std::string& s) {
+		return "Writing benchmark report to: \n\t" + s; }
+	inline std::string DyssolC_StartSweepRun(size_t i, size_t n) {
+		return " ----- Sweep run " + std::to_string(i) + " of " + std::to_string(n) + " ----- "; }
 	inline std::string DyssolC_WriteSrc(const std::string& src, const std::string& dst) {
 		return dst + " is not specified. " + src + " will be used to store simulation results"; }
 	inline std::string DyssolC_LoadMDB(const std::string& s) {
@@ -77,6 +90,10 @@ namespace StrConst
 		return "Loading flowsheet file: \n\t" + s; }
 	inline std::string DyssolC_SaveFlowsheet(const std::string& s) {
 		return "Saving flowsheet to: \n\t" + s; }
+	inline std::string DyssolC_LoadFinished(const int64_t& time_s, const int64_t& time_ms, const uint64_t& size) {
+		return "Loading finished in " + std::to_string(time_s) + "." + std::to_string(time_ms) + " [s], file size " + std::to_string(size / 1024) + " [kB]"; }
+	inline std::string DyssolC_SaveFinished(const int64_t& time_s, const int64_t& time_ms, const uint64_t& size) {
+		return "Saving finished in " + std::to_string(time_s) + "." + std::to_string(time_ms) + " [s], file size " + std::to_string(size / 1024) + " [kB]"; }
 	inline std::string DyssolC_Initialize()	{
 		return "Initializing flowsheet"; }
 	inline std::string DyssolC_Start() {
@@ -87,6 +104,12 @@ namespace StrConst
 		return "Script job finished in " + std::to_string(time_s) + "." + std::to_string(time_ms) + " [s]"; }
 	inline std::string DyssolC_SimFinished(const int64_t& time_s, const int64_t& time_ms) {
 		return "Simulation finished in " + std::to_string(time_s) + "." + std::to_string(time_ms) + " [s]"; }
+	inline std::string DyssolC_WarmStart() {
+		return "Initializing tear streams with results of the previous simulation"; }
+	inline std::string DyssolC_WarmStartSkipped() {
+		return "Tear streams are not initialized: no previous simulation with the same tear streams"; }
+	inline std::string DyssolC_WarmStartIterations(size_t n, size_t r) {
+		return "Iterations over tear streams: \n\t" + std::to_string(n) + " (" + std::to_string(r) + " in the last simulation without initialization, comparable only if it had the same parameters)"; }
 	inline std::string DyssolC_WarningUnknown(const std::string& s) {
 		return "Warning while parsing script file: Unknown keyword " + StringFunctions::Quote(s); }
 	inline std::string DyssolC_ErrorNoScript() {
@@ -97,6 +120,8 @@ namespace StrConst
 		return "Error: Unable to load materials database file"; }
 	inline std::string DyssolC_ErrorLoad() {
 		return "Error: Unable to load flowsheet file"; }
+	inline std::string DyssolC_ErrorBenchmarkFile() {
+		return "Error: Unable to open file for benchmark report"; }
 	inline std::string DyssolC_ErrorExportFile() {
 		return "Error: Unable to open text file for export"; }
 	inline std::string DyssolC_ErrorNoUnit(const std::string& p, const std::string& n, size_t i) {
@@ -135,6 +160,10 @@ namespace StrConst
 		return "Error while applying " + p + ": \n\tCannot find a plot in unit " + StringFunctions::Quote(u) + " neither by its name " + StringFunctions::Quote(n) + " nor by its index " + std::to_string(i + 1); }
 	inline std::string DyssolC_ErrorNoCurve(const std::string& p, const std::string& u, const std::string& d, const std::string& n, size_t i) {
 		return "Error while applying " + p + ": \n\tCannot find a curve in plot " + StringFunctions::Quote(d) + " in unit " + StringFunctions::Quote(u) + " neither by its name " + StringFunctions::Quote(n) + " nor by its index " + std::to_string(i + 1); }
+	inline std::string DyssolC_ErrorSweepParameter(const std::string& p, const std::string& u, const std::string& n) {
+		return "Error while applying " + p + ": \n\tParameter " + StringFunctions::Quote(n) + " in unit " + StringFunctions::Quote(u) + " is not a constant numeric parameter"; }
+	inline std::string DyssolC_ErrorSweepNoRuns(const std::string& p) {
+		return "Error while applying " + p + ": \n\tNo runs are defined"; }
 	inline std::string DyssolC_ErrorInit(const std::string& s) {
 		return "Error during initialization: " + s; }
 	inline std::string DyssolC_ErrorSave() {
@@ -398,6 +427,9 @@ namespace StrConst
 		return std::string("Simulation of " + unit + " (" + model + "): [" + StringFunctions::Double2String(t1) + ", " + StringFunctions::Double2String(t2) + "]..."); }
 	inline std::string  Sim_InfoUnitFinalization(const std::string& unit, const std::string& model) {
 		return std::string("Finalization of " + unit + " (" + model + ")..."); }
+	inline std::string  Sim_InfoSolverStatistics(const std::string& unit, const std::string& solver, size_t calls, size_t steps, size_t resEvals, size_t jacEvals, size_t nlFails, size_t errFails, double time, double resTime) {
+		return std::string("Solver " + solver + " of " + unit + ": calls " + std::to_string(calls) + ", steps " + std::to_string(steps) + ", residuals " + std::to_string(resEvals) + ", Jacobians " + std::to_string(jacEvals)
+			+ ", nonlinear failures " + std::to_string(nlFails) + ", error test failures " + std::to_string(errFails) + ", time " + StringFunctions::Double2String(time) + " s (residuals " + StringFunctions::Double2String(resTime) + " s)."); }
 	inline std::string  Sim_WarningParamOutOfRange(const std::string& unit, const std::string& model, const std::string& param) {
 		return std::string("In unit '" + unit + "' (" + model + "), parameter '" + param + "': value is out of range."); }
 
@@ -512,6 +544,12 @@ namespace StrConst
 	const char* const FlPar_H5CacheFlagInternal       = "CacheFlagInternal";
 	const char* const FlPar_H5CacheWindow	          = "CacheWindow";
 	const char* const FlPar_H5FileSingleFlag	      = "FileSingleFlag";
+	const char* const FlPar_H5FileCompression         = "FileCompression";
+	const char* const FlPar_H5FileShuffleFlag         = "FileShuffleFlag";
+	const char* const FlPar_H5FileChecksumFlag        = "FileChecksumFlag";
+	const char* const FlPar_H5FileChunkSize           = "FileChunkSize";
+	const char* const FlPar_H5FileCacheSize           = "FileCacheSize";
+	const char* const FlPar_H5FileIncrementalFlag     = "FileIncrementalFlag";
 	const char* const FlPar_H5InitTearStreamsFlag	  = "InitTearStreamsFlag";
 	const char* const FlPar_H5EnthalpyMinT            = "EnthalpyMinTemperature";
 	const char* const FlPar_H5EnthalpyMaxT            = "EnthalpyMaxTemperature";
@@ -648,6 +686,13 @@ namespace StrConst
 #else
 	const char* const MM_LibraryFileExtension     = ".so";
 #endif
+#if _DEBUG
+	const char* const MM_CacheFileName            = "DyssolModels_debug.cache";
+#else
+	const char* const MM_CacheFileName            = "DyssolModels.cache";
+#endif
+	const char* const MM_CacheDirName             = "Dyssol";
+	const char* const MM_CacheSignature           = "DyssolModelsCache";
 
 
 //////////////////////////////////////////////////////////////////////////
@@ -732,7 +777,7 @@ namespace StrConst
 //////////////////////////////////////////////////////////////////////////
 	const char* const  MDT_DialogSaveName      = "Save database";
 	const char* const  MDT_DialogLoadName      = "Load database";
-	const char* const  MDT_DialogDMDBFilter    = "Materials database (*.dmdb);;All files (*.*);;";
+	const char* const  MDT_DialogDMDBFilter    = "Materials database (*.dmdb *.bdmdb);;All files (*.*);;";
 	const char* const  MDT_RemoveCompoundTitle = "Remove compound";
 	inline std::string MDT_RemoveCompoundConfirm(const std::string& s1) { return std::string("Do you really want to remove " + s1 + "?"); }
 	const char* const  MDT_RemoveCorrelationsTitle = "Remove correlations";
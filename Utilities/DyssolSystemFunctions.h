@@ -10,7 +10,10 @@
 #include "DyssolWindows.h"
 #include <tchar.h>
 #include <Psapi.h>
+#else
+#include <sys/resource.h>
 #endif
+#include <cstddef>
 
 namespace SystemFunctions
 {
@@ -58,4 +61,24 @@ namespace SystemFunctions
 		return processesCount;
 	}
 #endif
+
+	/// Returns the peak resident set size of the current process in bytes, or 0 if it cannot be determined.
+	inline size_t PeakMemoryUsage()
+	{
+#ifdef _MSC_VER
+		PROCESS_MEMORY_COUNTERS counters;
+		if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+			return 0;
+		return counters.PeakWorkingSetSize;
+#else
+		rusage usage{};
+		if (getrusage(RUSAGE_SELF, &usage) != 0)
+			return 0;
+#ifdef __APPLE__
+		return static_cast<size_t>(usage.ru_maxrss);		// in bytes
+#else
+		return static_cast<size_t>(usage.ru_maxrss) * 1024;	// in kilobytes
+#endif
+#endif
+	}
 }
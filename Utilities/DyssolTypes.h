@@ -8,6 +8,9 @@
 #include <string>
 #include <iostream>
 #include <utility>
+#include <memory>
+
+class CMixtureEnthalpyCache;
 
 /**
  * \brief Time dependent value.
@@ -108,6 +111,7 @@ struct SThermodynamicsSettings
 {
 	SInterval limits{ DEFAULT_ENTHALPY_MIN_T, DEFAULT_ENTHALPY_MAX_T };
 	size_t intervals{ DEFAULT_ENTHALPY_INTERVALS };
+	std::shared_ptr<CMixtureEnthalpyCache> cache{};	// Cache of mixture lookup tables shared between streams. May be empty.
 };
 
 /**
@@ -0,0 +1,118 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#include "MemoryMappedFile.h"
+#include <utility>
+#ifdef _MSC_VER
+#include "DyssolWindows.h"
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+CMemoryMappedFile::CMemoryMappedFile(const std::filesystem::path& _path)
+{
+	Open(_path);
+}
+
+CMemoryMappedFile::~CMemoryMappedFile()
+{
+	Close();
+}
+
+CMemoryMappedFile::CMemoryMappedFile(CMemoryMappedFile&& _other) noexcept
+{
+	*this = std::move(_other);
+}
+
+CMemoryMappedFile& CMemoryMappedFile::operator=(CMemoryMappedFile&& _other) noexcept
+{
+	if (this == &_other) return *this;
+	Close();
+	m_data = std::exchange(_other.m_data, nullptr);
+	m_size = std::exchange(_other.m_size, 0);
+#ifdef _MSC_VER
+	m_file    = std::exchange(_other.m_file, nullptr);
+	m_mapping = std::exchange(_other.m_mapping, nullptr);
+#endif
+	return *this;
+}
+
+bool CMemoryMappedFile::Open(const std::filesystem::path& _path)
+{
+	Close();
+#ifdef _MSC_VER
+	HANDLE file = CreateFileW(_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) return false;
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+	{
+		CloseHandle(file);
+		return false;
+	}
+	HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping)
+	{
+		CloseHandle(file);
+		return false;
+	}
+	const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!data)
+	{
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+	m_file = file;
+	m_mapping = mapping;
+	m_data = static_cast<const char*>(data);
+	m_size = static_cast<size_t>(size.QuadPart);
+#else
+	const int file = ::open(_path.c_str(), O_RDONLY);
+	if (file == -1) return false;
+	struct stat info{};
+	if (::fstat(file, &info) == -1 || info.st_size == 0)
+	{
+		::close(file);
+		return false;
+	}
+	void* data = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+	::close(file); // the mapping stays valid after closing the descriptor
+	if (data == MAP_FAILED) return false;
+	m_data = static_cast<const char*>(data);
+	m_size = static_cast<size_t>(info.st_size);
+#endif
+	return true;
+}
+
+void CMemoryMappedFile::Close()
+{
+#ifdef _MSC_VER
+	if (m_data)    UnmapViewOfFile(m_data);
+	if (m_mapping) CloseHandle(m_mapping);
+	if (m_file)    CloseHandle(m_file);
+	m_file = nullptr;
+	m_mapping = nullptr;
+#else
+	if (m_data) ::munmap(const_cast<char*>(m_data), m_size);
+#endif
+	m_data = nullptr;
+	m_size = 0;
+}
+
+bool CMemoryMappedFile::IsOpen() const
+{
+	return m_data != nullptr;
+}
+
+const char* CMemoryMappedFile::Data() const
+{
+	return m_data;
+}
+
+size_t CMemoryMappedFile::Size() const
+{
+	return m_size;
+}
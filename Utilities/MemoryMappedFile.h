@@ -0,0 +1,40 @@
+/* Copyright (c) 2025, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+
+#include "DyssolFilesystem.h"
+
+// Read-only view of the whole file mapped into memory.
+class CMemoryMappedFile
+{
+	const char* m_data{ nullptr };	// Pointer to the beginning of the mapped data.
+	size_t m_size{ 0 };				// Size of the mapped data in bytes.
+#ifdef _MSC_VER
+	void* m_file{ nullptr };		// Handle of the opened file.
+	void* m_mapping{ nullptr };		// Handle of the file mapping object.
+#endif
+
+public:
+	CMemoryMappedFile() = default;
+	// Opens and maps the file.
+	explicit CMemoryMappedFile(const std::filesystem::path& _path);
+	~CMemoryMappedFile();
+
+	CMemoryMappedFile(const CMemoryMappedFile& _other) = delete;
+	CMemoryMappedFile& operator=(const CMemoryMappedFile& _other) = delete;
+	CMemoryMappedFile(CMemoryMappedFile&& _other) noexcept;
+	CMemoryMappedFile& operator=(CMemoryMappedFile&& _other) noexcept;
+
+	// Opens and maps the file. Closes the previously opened file. Returns true on success.
+	bool Open(const std::filesystem::path& _path);
+	// Unmaps and closes the file.
+	void Close();
+
+	// Returns true if the file is mapped.
+	[[nodiscard]] bool IsOpen() const;
+	// Returns pointer to the beginning of the mapped data.
+	[[nodiscard]] const char* Data() const;
+	// Returns size of the mapped data in bytes.
+	[[nodiscard]] size_t Size() const;
+};
@@ -0,0 +1,12 @@
+STREAM_MASS "Out1" 0 7.5 60 5.625
+STREAM_MASS "Out2" 0 2.5 60 1.875
+STREAM_TEMPERATURE "Out1" 0 300 60 300
+STREAM_TEMPERATURE "Out2" 0 300 60 300
+STREAM_PRESSURE "Out1" 0 100000 60 100000
+STREAM_PRESSURE "Out2" 0 100000 60 100000
+STREAM_PHASES "Out1" 0 1 60 1
+STREAM_PHASES "Out2" 0 1 60 1
+STREAM_COMPOUNDS "Out1" 0 1 60 1
+STREAM_COMPOUNDS "Out2" 0 1 60 1
+STREAM_PSD "Out1" 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.27473e-06 1.99918e-06 3.10414e-06 4.77186e-06 7.26259e-06 1.09434e-05 1.63256e-05 2.41127e-05 3.52596e-05 5.10465e-05 7.31664e-05 0.000103828 0.000145873 0.000202905 0.000279426 0.000380976 0.000514264 0.000687277 0.000909356 0.00119122 0.00154493 0.00198374 0.00252182 0.00317397 0.003955 0.0048792 0.00595947 0.00720649 0.00862773 0.0102265 0.0120009 0.0139431 0.0160383 0.0182649 0.0205936 0.0229882 0.0254059 0.0277985 0.0301137 0.0322972 0.0342944 0.0360527 0.037524 0.0386668 0.0394479 0.0398444 0.0398444 0.0394479 0.0386668 0.037524 0.0360527 0.0342944 0.0322972 0.0301137 0.0277985 0.0254059 0.0229882 0.0205936 0.0182649 0.0160383 0.0139431 0.0120009 0.0102265 0.00862773 0.00720649 0.00595947 0.0048792 0.003955 0.00317397 0.00252182 0.00198374 0.00154493 0.00119122 0.000909356 0.000687277 0.000514264 0.000380976 0.000279426 0.000202905 0.000145873 0.000103828 7.31664e-05 5.10465e-05 3.52596e-05 2.41127e-05 1.63256e-05 1.09434e-05 7.26259e-06 4.77186e-06 3.10414e-06 1.99918e-06 1.27473e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 60 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.11687e-06 1.3917e-06 1.72984e-06 2.14476e-06 2.65257e-06 3.27241e-06 4.02702e-06 4.94327e-06 6.05284e-06 7.39295e-06 9.00723e-06 1.09466e-05 1.32703e-05 1.60471e-05 1.93565e-05 2.32901e-05 2.79531e-05 3.34659e-05 3.99659e-05 4.76093e-05 5.65727e-05 6.70559e-05 7.92833e-05 9.35062e-05 0.000110005 0.000129092 0.000151113 0.000176448 0.000205517 0.000238776 0.000276726 0.000319906 0.000368901 0.000424337 0.000486885 0.000557257 0.000636209 0.000724533 0.000823058 0.000932647 0.00105419 0.0011886 0.00133679 0.00149971 0.00167828 0.00187343 0.00208605 0.002317 0.00256709 0.00283707 0.00312762 0.00343931 0.00377263 0.00412791 0.00450538 0.00490508 0.00532691 0.00577058 0.00623558 0.00672124 0.00722662 0.00775061 0.00829184 0.00884871 0.00941941 0.0100019 0.0105938 0.0111928 0.0117961 0.0124009 0.0130042 0.0136027 0.0141933 0.0147726 0.0153371 0.0158834 0.016408 0.0169077 0.0173792 0.0178191 0.0182246 0.0185928 0.018921 0.0192069 0.0194485 0.019644 0.0197919 0.0198911 0.0199409 0.0199409 0.0198911 0.0197919 0.019644 0.0194485 0.0192069 0.018921 0.0185928 0.0182246 0.0178191 0.0173792 0.0169077 0.016408 0.0158834 0.0153371 0.0147726 0.0141933 0.0136027 0.0130042 0.0124009 0.0117961 0.0111928 0.0105938 0.0100019 0.00941941 0.00884871 0.00829184 0.00775061 0.00722662 0.00672124 0.00623558 0.00577058 0.00532691 0.00490508 0.00450538 0.00412791 0.00377263 0.00343931 0.00312762 0.00283707 0.00256709 0.002317 0.00208605 0.00187343 0.00167828 0.00149971 0.00133679 0.0011886 0.00105419 0.000932647 0.000823058 0.000724533 0.000636209 0.000557257 0.000486885 0.000424337 0.000368901 0.000319906 0.000276726 0.000238776 0.000205517 0.000176448 0.000151113 0.000129092 0.000110005 9.35062e-05 7.92833e-05 6.70559e-05 5.65727e-05 4.76093e-05 3.99659e-05 3.34659e-05 2.79531e-05 2.32901e-05 1.93565e-05 1.60471e-05 1.32703e-05 1.09466e-05 9.00723e-06 7.39295e-06 6.05284e-06 4.94327e-06 4.02702e-06 3.27241e-06 2.65257e-06 2.14476e-06 1.72984e-06 1.3917e-06 1.11687e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0
+STREAM_PSD "Out2" 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.27473e-06 1.99918e-06 3.10414e-06 4.77186e-06 7.26259e-06 1.09434e-05 1.63256e-05 2.41127e-05 3.52596e-05 5.10465e-05 7.31664e-05 0.000103828 0.000145873 0.000202905 0.000279426 0.000380976 0.000514264 0.000687277 0.000909356 0.00119122 0.00154493 0.00198374 0.00252182 0.00317397 0.003955 0.0048792 0.00595947 0.00720649 0.00862773 0.0102265 0.0120009 0.0139431 0.0160383 0.0182649 0.0205936 0.0229882 0.0254059 0.0277985 0.0301137 0.0322972 0.0342944 0.0360527 0.037524 0.0386668 0.0394479 0.0398444 0.0398444 0.0394479 0.0386668 0.037524 0.0360527 0.0342944 0.0322972 0.0301137 0.0277985 0.0254059 0.0229882 0.0205936 0.0182649 0.0160383 0.0139431 0.0120009 0.0102265 0.00862773 0.00720649 0.00595947 0.0048792 0.003955 0.00317397 0.00252182 0.00198374 0.00154493 0.00119122 0.000909356 0.000687277 0.000514264 0.000380976 0.000279426 0.000202905 0.000145873 0.000103828 7.31664e-05 5.10465e-05 3.52596e-05 2.41127e-05 1.63256e-05 1.09434e-05 7.26259e-06 4.77186e-06 3.10414e-06 1.99918e-06 1.27473e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 60 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.11687e-06 1.3917e-06 1.72984e-06 2.14476e-06 2.65257e-06 3.27241e-06 4.02702e-06 4.94327e-06 6.05284e-06 7.39295e-06 9.00723e-06 1.09466e-05 1.32703e-05 1.60471e-05 1.93565e-05 2.32901e-05 2.79531e-05 3.34659e-05 3.99659e-05 4.76093e-05 5.65727e-05 6.70559e-05 7.92833e-05 9.35062e-05 0.000110005 0.000129092 0.000151113 0.000176448 0.000205517 0.000238776 0.000276726 0.000319906 0.000368901 0.000424337 0.000486885 0.000557257 0.000636209 0.000724533 0.000823058 0.000932647 0.00105419 0.0011886 0.00133679 0.00149971 0.00167828 0.00187343 0.00208605 0.002317 0.00256709 0.00283707 0.00312762 0.00343931 0.00377263 0.00412791 0.00450538 0.00490508 0.00532691 0.00577058 0.00623558 0.00672124 0.00722662 0.00775061 0.00829184 0.00884871 0.00941941 0.0100019 0.0105938 0.0111928 0.0117961 0.0124009 0.0130042 0.0136027 0.0141933 0.0147726 0.0153371 0.0158834 0.016408 0.0169077 0.0173792 0.0178191 0.0182246 0.0185928 0.018921 0.0192069 0.0194485 0.019644 0.0197919 0.0198911 0.0199409 0.0199409 0.0198911 0.0197919 0.019644 0.0194485 0.0192069 0.018921 0.0185928 0.0182246 0.0178191 0.0173792 0.0169077 0.016408 0.0158834 0.0153371 0.0147726 0.0141933 0.0136027 0.0130042 0.0124009 0.0117961 0.0111928 0.0105938 0.0100019 0.00941941 0.00884871 0.00829184 0.00775061 0.00722662 0.00672124 0.00623558 0.00577058 0.00532691 0.00490508 0.00450538 0.00412791 0.00377263 0.00343931 0.00312762 0.00283707 0.00256709 0.002317 0.00208605 0.00187343 0.00167828 0.00149971 0.00133679 0.0011886 0.00105419 0.000932647 0.000823058 0.000724533 0.000636209 0.000557257 0.000486885 0.000424337 0.000368901 0.000319906 0.000276726 0.000238776 0.000205517 0.000176448 0.000151113 0.000129092 0.000110005 9.35062e-05 7.92833e-05 6.70559e-05 5.65727e-05 4.76093e-05 3.99659e-05 3.34659e-05 2.79531e-05 2.32901e-05 1.93565e-05 1.60471e-05 1.32703e-05 1.09466e-05 9.00723e-06 7.39295e-06 6.05284e-06 4.94327e-06 4.02702e-06 3.27241e-06 2.65257e-06 2.14476e-06 1.72984e-06 1.3917e-06 1.11687e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0
@@ -0,0 +1,4 @@
+STREAM_MASS "Recycle" 0 4 10 4 20 4 30 4 40 4 50 4 60 4
+STREAM_MASS "Out" 0 4 10 4 20 4 30 4 40 4 50 4 60 4
+STREAM_TEMPERATURE "Out" 0 300 10 300 20 300 30 300 40 300 50 300 60 300
+HOLDUP_MASS "Bunker" "Holdup" 0 1000 10 1060 20 1120 30 1180 40 1240 50 1300 60 1360
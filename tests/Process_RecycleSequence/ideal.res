@@ -0,0 +1,4 @@
+STREAM_MASS "Product" 0 10 1 10 2 10 3.2 10 4.64 10 6.368 10 8.4416 10 10.9299 10 13.9159 10 17.4991 10 21.7989 10 26.9587 10 33.1504 10 40.5805 10 49.4966 10 60 10
+STREAM_MASS "Recycle1" 0 5 1 5 2 5 3.2 5 4.64 5 6.368 5 8.4416 5 10.9299 5 13.9159 5 17.4991 5 21.7989 5 26.9587 5 33.1504 5 40.5805 5 49.4966 5 60 5
+STREAM_MASS "Recycle2" 0 5 1 5 2 5 3.2 5 4.64 5 6.368 5 8.4416 5 10.9299 5 13.9159 5 17.4991 5 21.7989 5 26.9587 5 33.1504 5 40.5805 5 49.4966 5 60 5
+STREAM_MASS "Mix" 0 20 1 20 2 20 3.2 20 4.64 20 6.368 20 8.4416 20 10.9299 20 13.9159 20 17.4991 20 21.7989 20 26.9587 20 33.1504 20 40.5805 20 49.4966 20 60 20
@@ -0,0 +1,6 @@
+STREAM_MASS "Product" 0 10 1 10 2.2 10 3.64 10 5.368 10 7.4416 10 9.92992 10 12.9159 10 16.4991 10 20.7989 10 25.9587 10 32.1504 10 39.5805 10 48.4966 10 59.1959 10 60 10
+STREAM_MASS "Recycle" 0 3.33333 1 3.33333 2.2 3.33333 3.64 3.33333 5.368 3.33333 7.4416 3.33333 9.92992 3.33333 12.9159 3.33333 16.4991 3.33333 20.7989 3.33333 25.9587 3.33333 32.1504 3.33333 39.5805 3.33333 48.4966 3.33333 59.1959 3.33333 60 3.33333
+STREAM_MASS "Mix" 0 13.3333 1 13.3333 2.2 13.3333 3.64 13.3333 5.368 13.3333 7.4416 13.3333 9.92992 13.3333 12.9159 13.3333 16.4991 13.3333 20.7989 13.3333 25.9587 13.3333 32.1504 13.3333 39.5805 13.3333 48.4966 13.3333 59.1959 13.3333 60 13.3333
+STREAM_TEMPERATURE "Product" 0 300 1 300 2.2 300 3.64 300 5.368 300 7.4416 300 9.92992 300 12.9159 300 16.4991 300 20.7989 300 25.9587 300 32.1504 300 39.5805 300 48.4966 300 59.1959 300 60 300
+STREAM_PRESSURE "Product" 0 100000 1 100000 2.2 100000 3.64 100000 5.368 100000 7.4416 100000 9.92992 100000 12.9159 100000 16.4991 100000 20.7989 100000 25.9587 100000 32.1504 100000 39.5805 100000 48.4966 100000 59.1959 100000 60 100000
+STREAM_PSD "Product" 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.27473e-06 1.99918e-06 3.10414e-06 4.77186e-06 7.26259e-06 1.09434e-05 1.63256e-05 2.41127e-05 3.52596e-05 5.10465e-05 7.31664e-05 0.000103828 0.000145873 0.000202905 0.000279426 0.000380976 0.000514264 0.000687277 0.000909356 0.00119122 0.00154493 0.00198374 0.00252182 0.00317397 0.003955 0.0048792 0.00595947 0.00720649 0.00862773 0.0102265 0.0120009 0.0139431 0.0160383 0.0182649 0.0205936 0.0229882 0.0254059 0.0277985 0.0301137 0.0322972 0.0342944 0.0360527 0.037524 0.0386668 0.0394479 0.0398444 0.0398444 0.0394479 0.0386668 0.037524 0.0360527 0.0342944 0.0322972 0.0301137 0.0277985 0.0254059 0.0229882 0.0205936 0.0182649 0.0160383 0.0139431 0.0120009 0.0102265 0.00862773 0.00720649 0.00595947 0.0048792 0.003955 0.00317397 0.00252182 0.00198374 0.00154493 0.00119122 0.000909356 0.000687277 0.000514264 0.000380976 0.000279426 0.000202905 0.000145873 0.000103828 7.31664e-05 5.10465e-05 3.52596e-05 2.41127e-05 1.63256e-05 1.09434e-05 7.26259e-06 4.77186e-06 3.10414e-06 1.99918e-06 1.27473e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.27473e-06 1.99918e-06 3.10414e-06 4.77186e-06 7.26259e-06 1.09434e-05 1.63256e-05 2.41127e-05 3.52596e-05 5.10465e-05 7.31664e-05 0.000103828 0.000145873 0.000202905 0.000279426 0.000380976 0.000514264 0.000687277 0.000909356 0.00119122 0.00154493 0.00198374 0.00252182 0.00317397 0.003955 0.0048792 0.00595947 0.00720649 0.00862773 0.0102265 0.0120009 0.0139431 0.0160383 0.0182649 0.0205936 0.0229882 0.0254059 0.0277985 0.0301137 0.0322972 0.0342944 0.0360527 0.037524 0.0386668 0.0394479 0.0398444 0.0398444 0.0394479 0.0386668 0.037524 0.0360527 0.0342944 0.0322972 0.0301137 0.0277985 0.0254059 0.0229882 0.0205936 0.0182649 0.0160383 0.0139431 0.0120009 0.0102265 0.00862773 0.00720649 0.00595947 0.0048792 0.003955 0.00317397 0.00252182 0.00198374 0.00154493 0.00119122 0.000909356 0.000687277 0.000514264 0.000380976 0.000279426 0.000202905 0.000145873 0.000103828 7.31664e-05 5.10465e-05 3.52596e-05 2.41127e-05 1.63256e-05 1.09434e-05 7.26259e-06 4.77186e-06 3.10414e-06 1.99918e-06 1.27473e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 2.2 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.27473e-06 1.99918e-06 3.10414e-06 4.77186e-06 7.26259e-06 1.09434e-05 1.63256e-05 2.41127e-05 3.52596e-05 5.10465e-05 7.31664e-05 0.000103828 0.000145873 0.000202905 0.000279426 0.000380976 0.000514264 0.000687277 0.000909356 0.00119122 0.00154493 0.00198374 0.00252182 0.00317397 0.003955 0.0048792 0.00595947 0.00720649 0.00862773 0.0102265 0.0120009 0.0139431 0.0160383 0.0182649 0.0205936 0.0229882 0.0254059 0.0277985 0.0301137 0.0322972 0.0342944 0.0360527 0.037524 0.0386668 0.0394479 0.0398444 0.0398444 0.0394479 0.0386668 0.037524 0.0360527 0.0342944 0.0322972 0.0301137 0.0277985 0.0254059 0.0229882 0.0205936 0.0182649 0.0160383 0.0139431 0.0120009 0.0102265 0.00862773 0.00720649 0.00595947 0.0048792 0.003955 0.00317397 0.00252182 0.00198374 0.00154493 0.00119122 0.000909356 0.000687277 0.000514264 0.000380976 0.000279426 0.000202905 0.000145873 0.000103828 7.31664e-05 5.10465e-05 3.52596e-05 2.41127e-05 1.63256e-05 1.09434e-05 7.26259e-06 4.77186e-06 3.10414e-06 1.99918e-06 1.27473e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 3.64 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.27473e-06 1.99918e-06 3.10414e-06 4.77186e-06 7.26259e-06 1.09434e-05 1.63256e-05 2.41127e-05 3.52596e-05 5.10465e-05 7.31664e-05 0.000103828 0.000145873 0.000202905 0.000279426 0.000380976 0.000514264 0.000687277 0.000909356 0.00119122 0.00154493 0.00198374 0.00252182 0.00317397 0.003955 0.0048792 0.00595947 0.00720649 0.00862773 0.0102265 0.0120009 0.0139431 0.0160383 0.0182649 0.0205936 0.0229882 0.0254059 0.0277985 0.0301137 0.0322972 0.0342944 0.0360527 0.037524 0.0386668 0.0394479 0.0398444 0.0398444 0.0394479 0.0386668 0.037524 0.0360527 0.0342944 0.0322972 0.0301137 0.0277985 0.0254059 0.0229882 0.0205936 0.0182649 0.0160383 0.0139431 0.0120009 0.0102265 0.00862773 0.00720649 0.00595947 0.0048792 0.003955 0.00317397 0.00252182 0.00198374 0.00154493 0.00119122 0.000909356 0.000687277 0.000514264 0.000380976 0.000279426 0.000202905 0.000145873 0.000103828 7.31664e-05 5.10465e-05 3.52596e-05 2.41127e-05 1.63256e-05 1.09434e-05 7.26259e-06 4.77186e-06 3.10414e-06 1.99918e-06 1.27473e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 5.368 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.27473e-06 1.99918e-06 3.10414e-06 4.77186e-06 7.26259e-06 1.09434e-05 1.63256e-05 2.41127e-05 3.52596e-05 5.10465e-05 7.31664e-05 0.000103828 0.000145873 0.000202905 0.000279426 0.000380976 0.000514264 0.000687277 0.000909356 0.00119122 0.00154493 0.00198374 0.00252182 0.00317397 0.003955 0.0048792 0.00595947 0.00720649 0.00862773 0.0102265 0.0120009 0.0139431 0.0160383 0.0182649 0.0205936 0.0229882 0.0254059 0.0277985 0.0301137 0.0322972 0.0342944 0.0360527 0.037524 0.0386668 0.0394479 0.0398444 0.0398444 0.0394479 0.0386668 0.037524 0.0360527 0.0342944 0.0322972 0.0301137 0.0277985 0.0254059 0.0229882 0.0205936 0.0182649 0.0160383 0.0139431 0.0120009 0.0102265 0.00862773 0.00720649 0.00595947 0.0048792 0.003955 0.00317397 0.00252182 0.00198374 0.00154493 0.00119122 0.000909356 0.000687277 0.000514264 0.000380976 0.000279426 0.000202905 0.000145873 0.000103828 7.31664e-05 5.10465e-05 3.52596e-05 2.41127e-05 1.63256e-05 1.09434e-05 7.26259e-06 4.77186e-06 3.10414e-06 1.99918e-06 1.27473e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 7.4416 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.27473e-06 1.99918e-06 3.10414e-06 4.77186e-06 7.26259e-06 1.09434e-05 1.63256e-05 2.41127e-05 3.52596e-05 5.10465e-05 7.31664e-05 0.000103828 0.000145873 0.000202905 0.000279426 0.000380976 0.000514264 0.000687277 0.000909356 0.00119122 0.00154493 0.00198374 0.00252182 0.00317397 0.003955 0.0048792 0.00595947 0.00720649 0.00862773 0.0102265 0.0120009 0.0139431 0.0160383 0.0182649 0.0205936 0.0229882 0.0254059 0.0277985 0.0301137 0.0322972 0.0342944 0.0360527 0.037524 0.0386668 0.0394479 0.0398444 0.0398444 0.0394479 0.0386668 0.037524 0.0360527 0.0342944 0.0322972 0.0301137 0.0277985 0.0254059 0.0229882 0.0205936 0.0182649 0.0160383 0.0139431 0.0120009 0.0102265 0.00862773 0.00720649 0.00595947 0.0048792 0.003955 0.00317397 0.00252182 0.00198374 0.00154493 0.00119122 0.000909356 0.000687277 0.000514264 0.000380976 0.000279426 0.000202905 0.000145873 0.000103828 7.31664e-05 5.10465e-05 3.52596e-05 2.41127e-05 1.63256e-05 1.09434e-05 7.26259e-06 4.77186e-06 3.10414e-06 1.99918e-06 1.27473e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 9.92992 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.27473e-06 1.99918e-06 3.10414e-06 4.77186e-06 7.26259e-06 1.09434e-05 1.63256e-05 2.41127e-05 3.52596e-05 5.10465e-05 7.31664e-05 0.000103828 0.000145873 0.000202905 0.000279426 0.000380976 0.000514264 0.000687277 0.000909356 0.00119122 0.00154493 0.00198374 0.00252182 0.00317397 0.003955 0.0048792 0.00595947 0.00720649 0.00862773 0.0102265 0.0120009 0.0139431 0.0160383 0.0182649 0.0205936 0.0229882 0.0254059 0.0277985 0.0301137 0.0322972 0.0342944 0.0360527 0.037524 0.0386668 0.0394479 0.0398444 0.0398444 0.0394479 0.0386668 0.037524 0.0360527 0.0342944 0.0322972 0.0301137 0.0277985 0.0254059 0.0229882 0.0205936 0.0182649 0.0160383 0.0139431 0.0120009 0.0102265 0.00862773 0.00720649 0.00595947 0.0048792 0.003955 0.00317397 0.00252182 0.00198374 0.00154493 0.00119122 0.000909356 0.000687277 0.000514264 0.000380976 0.000279426 0.000202905 0.000145873 0.000103828 7.31664e-05 5.10465e-05 3.52596e-05 2.41127e-05 1.63256e-05 1.09434e-05 7.26259e-06 4.77186e-06 3.10414e-06 1.99918e-06 1.27473e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 12.9159 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.27473e-06 1.99918e-06 3.10414e-06 4.77186e-06 7.26259e-06 1.09434e-05 1.63256e-05 2.41127e-05 3.52596e-05 5.10465e-05 7.31664e-05 0.000103828 0.000145873 0.000202905 0.000279426 0.000380976 0.000514264 0.000687277 0.000909356 0.00119122 0.00154493 0.00198374 0.00252182 0.00317397 0.003955 0.0048792 0.00595947 0.00720649 0.00862773 0.0102265 0.0120009 0.0139431 0.0160383 0.0182649 0.0205936 0.0229882 0.0254059 0.0277985 0.0301137 0.0322972 0.0342944 0.0360527 0.037524 0.0386668 0.0394479 0.0398444 0.0398444 0.0394479 0.0386668 0.037524 0.0360527 0.0342944 0.0322972 0.0301137 0.0277985 0.0254059 0.0229882 0.0205936 0.0182649 0.0160383 0.0139431 0.0120009 0.0102265 0.00862773 0.00720649 0.00595947 0.0048792 0.003955 0.00317397 0.00252182 0.00198374 0.00154493 0.00119122 0.000909356 0.000687277 0.000514264 0.000380976 0.000279426 0.000202905 0.000145873 0.000103828 7.31664e-05 5.10465e-05 3.52596e-05 2.41127e-05 1.63256e-05 1.09434e-05 7.26259e-06 4.77186e-06 3.10414e-06 1.99918e-06 1.27473e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 16.4991 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.27473e-06 1.99918e-06 3.10414e-06 4.77186e-06 7.26259e-06 1.09434e-05 1.63256e-05 2.41127e-05 3.52596e-05 5.10465e-05 7.31664e-05 0.000103828 0.000145873 0.000202905 0.000279426 0.000380976 0.000514264 0.000687277 0.000909356 0.00119122 0.00154493 0.00198374 0.00252182 0.00317397 0.003955 0.0048792 0.00595947 0.00720649 0.00862773 0.0102265 0.0120009 0.0139431 0.0160383 0.0182649 0.0205936 0.0229882 0.0254059 0.0277985 0.0301137 0.0322972 0.0342944 0.0360527 0.037524 0.0386668 0.0394479 0.0398444 0.0398444 0.0394479 0.0386668 0.037524 0.0360527 0.0342944 0.0322972 0.0301137 0.0277985 0.0254059 0.0229882 0.0205936 0.0182649 0.0160383 0.0139431 0.0120009 0.0102265 0.00862773 0.00720649 0.00595947 0.0048792 0.003955 0.00317397 0.00252182 0.00198374 0.00154493 0.00119122 0.000909356 0.000687277 0.000514264 0.000380976 0.000279426 0.000202905 0.000145873 0.000103828 7.31664e-05 5.10465e-05 3.52596e-05 2.41127e-05 1.63256e-05 1.09434e-05 7.26259e-06 4.77186e-06 3.10414e-06 1.99918e-06 1.27473e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 20.7989 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.27473e-06 1.99918e-06 3.10414e-06 4.77186e-06 7.26259e-06 1.09434e-05 1.63256e-05 2.41127e-05 3.52596e-05 5.10465e-05 7.31664e-05 0.000103828 0.000145873 0.000202905 0.000279426 0.000380976 0.000514264 0.000687277 0.000909356 0.00119122 0.00154493 0.00198374 0.00252182 0.00317397 0.003955 0.0048792 0.00595947 0.00720649 0.00862773 0.0102265 0.0120009 0.0139431 0.0160383 0.0182649 0.0205936 0.0229882 0.0254059 0.0277985 0.0301137 0.0322972 0.0342944 0.0360527 0.037524 0.0386668 0.0394479 0.0398444 0.0398444 0.0394479 0.0386668 0.037524 0.0360527 0.0342944 0.0322972 0.0301137 0.0277985 0.0254059 0.0229882 0.0205936 0.0182649 0.0160383 0.0139431 0.0120009 0.0102265 0.00862773 0.00720649 0.00595947 0.0048792 0.003955 0.00317397 0.00252182 0.00198374 0.00154493 0.00119122 0.000909356 0.000687277 0.000514264 0.000380976 0.000279426 0.000202905 0.000145873 0.000103828 7.31664e-05 5.10465e-05 3.52596e-05 2.41127e-05 1.63256e-05 1.09434e-05 7.26259e-06 4.77186e-06 3.10414e-06 1.99918e-06 1.27473e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 25.9587 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.27473e-06 1.99918e-06 3.10414e-06 4.77186e-06 7.26259e-06 1.09434e-05 1.63256e-05 2.41127e-05 3.52596e-05 5.10465e-05 7.31664e-05 0.000103828 0.000145873 0.000202905 0.000279426 0.000380976 0.000514264 0.000687277 0.000909356 0.00119122 0.00154493 0.00198374 0.00252182 0.00317397 0.003955 0.0048792 0.00595947 0.00720649 0.00862773 0.0102265 0.0120009 0.0139431 0.0160383 0.0182649 0.0205936 0.0229882 0.0254059 0.0277985 0.0301137 0.0322972 0.0342944 0.0360527 0.037524 0.0386668 0.0394479 0.0398444 0.0398444 0.0394479 0.0386668 0.037524 0.0360527 0.0342944 0.0322972 0.0301137 0.0277985 0.0254059 0.0229882 0.0205936 0.0182649 0.0160383 0.0139431 0.0120009 0.0102265 0.00862773 0.00720649 0.00595947 0.0048792 0.003955 0.00317397 0.00252182 0.00198374 0.00154493 0.00119122 0.000909356 0.000687277 0.000514264 0.000380976 0.000279426 0.000202905 0.000145873 0.000103828 7.31664e-05 5.10465e-05 3.52596e-05 2.41127e-05 1.63256e-05 1.09434e-05 7.26259e-06 4.77186e-06 3.10414e-06 1.99918e-06 1.27473e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 32.1504 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.27473e-06 1.99918e-06 3.10414e-06 4.77186e-06 7.26259e-06 1.09434e-05 1.63256e-05 2.41127e-05 3.52596e-05 5.10465e-05 7.31664e-05 0.000103828 0.000145873 0.000202905 0.000279426 0.000380976 0.000514264 0.000687277 0.000909356 0.00119122 0.00154493 0.00198374 0.00252182 0.00317397 0.003955 0.0048792 0.00595947 0.00720649 0.00862773 0.0102265 0.0120009 0.0139431 0.0160383 0.0182649 0.0205936 0.0229882 0.0254059 0.0277985 0.0301137 0.0322972 0.0342944 0.0360527 0.037524 0.0386668 0.0394479 0.0398444 0.0398444 0.0394479 0.0386668 0.037524 0.0360527 0.0342944 0.0322972 0.0301137 0.0277985 0.0254059 0.0229882 0.0205936 0.0182649 0.0160383 0.0139431 0.0120009 0.0102265 0.00862773 0.00720649 0.00595947 0.0048792 0.003955 0.00317397 0.00252182 0.00198374 0.00154493 0.00119122 0.000909356 0.000687277 0.000514264 0.000380976 0.000279426 0.000202905 0.000145873 0.000103828 7.31664e-05 5.10465e-05 3.52596e-05 2.41127e-05 1.63256e-05 1.09434e-05 7.26259e-06 4.77186e-06 3.10414e-06 1.99918e-06 1.27473e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 39.5805 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.27473e-06 1.99918e-06 3.10414e-06 4.77186e-06 7.26259e-06 1.09434e-05 1.63256e-05 2.41127e-05 3.52596e-05 5.10465e-05 7.31664e-05 0.000103828 0.000145873 0.000202905 0.000279426 0.000380976 0.000514264 0.000687277 0.000909356 0.00119122 0.00154493 0.00198374 0.00252182 0.00317397 0.003955 0.0048792 0.00595947 0.00720649 0.00862773 0.0102265 0.0120009 0.0139431 0.0160383 0.0182649 0.0205936 0.0229882 0.0254059 0.0277985 0.0301137 0.0322972 0.0342944 0.0360527 0.037524 0.0386668 0.0394479 0.0398444 0.0398444 0.0394479 0.0386668 0.037524 0.0360527 0.0342944 0.0322972 0.0301137 0.0277985 0.0254059 0.0229882 0.0205936 0.0182649 0.0160383 0.0139431 0.0120009 0.0102265 0.00862773 0.00720649 0.00595947 0.0048792 0.003955 0.00317397 0.00252182 0.00198374 0.00154493 0.00119122 0.000909356 0.000687277 0.000514264 0.000380976 0.000279426 0.000202905 0.000145873 0.000103828 7.31664e-05 5.10465e-05 3.52596e-05 2.41127e-05 1.63256e-05 1.09434e-05 7.26259e-06 4.77186e-06 3.10414e-06 1.99918e-06 1.27473e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 48.4966 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.27473e-06 1.99918e-06 3.10414e-06 4.77186e-06 7.26259e-06 1.09434e-05 1.63256e-05 2.41127e-05 3.52596e-05 5.10465e-05 7.31664e-05 0.000103828 0.000145873 0.000202905 0.000279426 0.000380976 0.000514264 0.000687277 0.000909356 0.00119122 0.00154493 0.00198374 0.00252182 0.00317397 0.003955 0.0048792 0.00595947 0.00720649 0.00862773 0.0102265 0.0120009 0.0139431 0.0160383 0.0182649 0.0205936 0.0229882 0.0254059 0.0277985 0.0301137 0.0322972 0.0342944 0.0360527 0.037524 0.0386668 0.0394479 0.0398444 0.0398444 0.0394479 0.0386668 0.037524 0.0360527 0.0342944 0.0322972 0.0301137 0.0277985 0.0254059 0.0229882 0.0205936 0.0182649 0.0160383 0.0139431 0.0120009 0.0102265 0.00862773 0.00720649 0.00595947 0.0048792 0.003955 0.00317397 0.00252182 0.00198374 0.00154493 0.00119122 0.000909356 0.000687277 0.000514264 0.000380976 0.000279426 0.000202905 0.000145873 0.000103828 7.31664e-05 5.10465e-05 3.52596e-05 2.41127e-05 1.63256e-05 1.09434e-05 7.26259e-06 4.77186e-06 3.10414e-06 1.99918e-06 1.27473e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 59.1959 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.27473e-06 1.99918e-06 3.10414e-06 4.77186e-06 7.26259e-06 1.09434e-05 1.63256e-05 2.41127e-05 3.52596e-05 5.10465e-05 7.31664e-05 0.000103828 0.000145873 0.000202905 0.000279426 0.000380976 0.000514264 0.000687277 0.000909356 0.00119122 0.00154493 0.00198374 0.00252182 0.00317397 0.003955 0.0048792 0.00595947 0.00720649 0.00862773 0.0102265 0.0120009 0.0139431 0.0160383 0.0182649 0.0205936 0.0229882 0.0254059 0.0277985 0.0301137 0.0322972 0.0342944 0.0360527 0.037524 0.0386668 0.0394479 0.0398444 0.0398444 0.0394479 0.0386668 0.037524 0.0360527 0.0342944 0.0322972 0.0301137 0.0277985 0.0254059 0.0229882 0.0205936 0.0182649 0.0160383 0.0139431 0.0120009 0.0102265 0.00862773 0.00720649 0.00595947 0.0048792 0.003955 0.00317397 0.00252182 0.00198374 0.00154493 0.00119122 0.000909356 0.000687277 0.000514264 0.000380976 0.000279426 0.000202905 0.000145873 0.000103828 7.31664e-05 5.10465e-05 3.52596e-05 2.41127e-05 1.63256e-05 1.09434e-05 7.26259e-06 4.77186e-06 3.10414e-06 1.99918e-06 1.27473e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 60 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.27473e-06 1.99918e-06 3.10414e-06 4.77186e-06 7.26259e-06 1.09434e-05 1.63256e-05 2.41127e-05 3.52596e-05 5.10465e-05 7.31664e-05 0.000103828 0.000145873 0.000202905 0.000279426 0.000380976 0.000514264 0.000687277 0.000909356 0.00119122 0.00154493 0.00198374 0.00252182 0.00317397 0.003955 0.0048792 0.00595947 0.00720649 0.00862773 0.0102265 0.0120009 0.0139431 0.0160383 0.0182649 0.0205936 0.0229882 0.0254059 0.0277985 0.0301137 0.0322972 0.0342944 0.0360527 0.037524 0.0386668 0.0394479 0.0398444 0.0398444 0.0394479 0.0386668 0.037524 0.0360527 0.0342944 0.0322972 0.0301137 0.0277985 0.0254059 0.0229882 0.0205936 0.0182649 0.0160383 0.0139431 0.0120009 0.0102265 0.00862773 0.00720649 0.00595947 0.0048792 0.003955 0.00317397 0.00252182 0.00198374 0.00154493 0.00119122 0.000909356 0.000687277 0.000514264 0.000380976 0.000279426 0.000202905 0.000145873 0.000103828 7.31664e-05 5.10465e-05 3.52596e-05 2.41127e-05 1.63256e-05 1.09434e-05 7.26259e-06 4.77186e-06 3.10414e-06 1.99918e-06 1.27473e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0
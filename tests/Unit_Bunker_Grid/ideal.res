@@ -0,0 +1,2 @@
+STREAM_MASS "Out" 0 10 10 10 20 10 30 10 35 10 40 10 45 10 50 10 60 10 70 10 80 10 90 10 100 10
+HOLDUP_MASS "Bunker" "Holdup" 0 1000 10 1100 20 1200 30 1300 35 1350 40 1412.5 45 1500 50 1600 60 1800 70 2000 80 2200 90 2400 100 2600
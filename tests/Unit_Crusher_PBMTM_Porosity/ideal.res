@@ -0,0 +1,6 @@
+STREAM_MASS "Out" 0 20 200 20
+STREAM_PSD "Out" 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.04504e-06 1.2486e-06 1.4915e-06 1.78115e-06 2.1263e-06 2.53723e-06 3.02604e-06 3.60688e-06 4.29632e-06 5.11368e-06 6.08144e-06 7.22572e-06 8.57675e-06 1.01694e-05 1.2044e-05 1.42467e-05 1.68305e-05 1.98557e-05 2.33912e-05 2.75151e-05 3.2316e-05 3.78936e-05 4.43601e-05 5.18413e-05 6.04776e-05 7.04254e-05 8.18582e-05 9.49677e-05 0.000109965 0.000127081 0.000146569 0.000168704 0.000193785 0.000222132 0.000254092 0.000290033 0.000330349 0.000375455 0.00042579 0.000481811 0.000543997 0.000612842 0.000688853 0.000772547 0.00086445 0.000965088 0.00107498 0.00119465 0.00132459 0.00146527 0.00161716 0.00178065 0.00195613 0.00214391 0.00234425 0.00255735 0.00278331 0.00302217 0.00327388 0.00353828 0.00381511 0.00410402 0.00440453 0.00471604 0.00503786 0.00536915 0.00570899 0.00605631 0.00640996 0.00676867 0.00713109 0.00749577 0.00786119 0.00822577 0.00858788 0.00894585 0.00929798 0.0096426 0.00997801 0.0103026 0.0106147 0.0109129 0.0111956 0.0114615 0.0117094 0.0119382 0.0121468 0.0123346 0.0125007 0.0126446 0.0127662 0.0128651 0.0129414 0.0129953 0.013027 0.0130372 0.0130264 0.0129955 0.0129453 0.0128769 0.0127914 0.01269 0.012574 0.0124448 0.0123036 0.0121519 0.0119911 0.0118225 0.0116475 0.0114673 0.0112832 0.0110965 0.0109081 0.0107191 0.0105305 0.0103429 0.0101573 0.00997413 0.009794 0.00961731 0.00944439 0.00927547 0.00911069 0.00895012 0.00879373 0.00864143 0.00849309 0.00834849 0.00820739 0.0080695 0.00793451 0.00780208 0.00767186 0.00754349 0.00741662 0.00729089 0.00716597 0.00704153 0.00691727 0.00679292 0.00666822 0.00654295 0.00641693 0.00628999 0.00616202 0.00603292 0.00590263 0.00577114 0.00563844 0.00550457 0.00536959 0.00523359 0.00509667 0.00495896 0.00482063 0.00468182 0.00454272 0.00440352 0.00426442 0.00412562 0.00398732 0.00384975 0.0037131 0.00357759 0.00344342 0.0033108 0.0031799 0.00305093 0.00292405 0.00279943 0.00267723 0.00255758 0.00244063 0.00232648 0.00221524 0.00210701 0.00200187 0.00189989 0.00180111 0.00170559 0.00161336 0.00152442 0.0014388 0.00135648 0.00127746 0.00120171 0.0011292 0.00105989 0.000993725 0.000930662 0.000870634 0.000813575 0.000759411 0.000708067 0.000659462 0.000613511 0.000570129 0.000529226 0.000490713 0.000454497 0.000420486 0.000388589 0.000358713 0.000330765 0.000304657 0.000280298 0.0002576 0.000236477 0.000216846 0.000198623 0.000181729 0.000166088 0.000151624 0.000138267 0.000125946 0.000114595 0.000104152 9.45552e-05 8.57475e-05 7.76738e-05 7.02821e-05 6.35233e-05 5.73507e-05 5.17203e-05 4.6591e-05 4.19237e-05 3.76821e-05 3.3832e-05 3.03415e-05 2.7181e-05 200 0 0 0 0 0 0 1.08431e-06 1.59695e-06 2.23998e-06 3.02532e-06 3.96449e-06 5.06862e-06 6.34859e-06 7.81495e-06 9.47804e-06 1.1348e-05 1.34346e-05 1.57477e-05 1.82967e-05 2.10911e-05 2.414e-05 2.74526e-05 3.10378e-05 3.49044e-05 3.90611e-05 4.35166e-05 4.82793e-05 5.33576e-05 5.87598e-05 6.44942e-05 7.05688e-05 7.69917e-05 8.37708e-05 9.09141e-05 9.84294e-05 0.000106324 0.000114607 0.000123284 0.000132364 0.000141854 0.000151761 0.000162093 0.000172858 0.000184062 0.000195712 0.000207816 0.000220381 0.000233414 0.000246922 0.000260913 0.000275392 0.000290366 0.000305844 0.000321831 0.000338334 0.00035536 0.000372916 0.000391008 0.000409643 0.000428827 0.000448568 0.000468871 0.000489743 0.000511191 0.00053322 0.000555838 0.000579051 0.000602864 0.000627285 0.000652319 0.000677974 0.000704254 0.000731166 0.000758716 0.000786912 0.000815757 0.00084526 0.000875425 0.000906259 0.000937768 0.000969958 0.00100283 0.0010364 0.00107067 0.00110565 0.00114133 0.00117774 0.00121487 0.00125272 0.00129132 0.00133066 0.00137074 0.00141159 0.00145319 0.00149557 0.00153873 0.00158268 0.00162742 0.00167296 0.00171932 0.0017665 0.00181452 0.00186339 0.00191311 0.00196372 0.00201521 0.0020676 0.00212093 0.0021752 0.00223043 0.00228667 0.00234392 0.00240222 0.00246161 0.00252211 0.00258377 0.00264664 0.00271075 0.00277616 0.00284292 0.00291109 0.00298073 0.00305191 0.0031247 0.00319917 0.0032754 0.00335348 0.00343347 0.00351548 0.00359959 0.00368588 0.00377444 0.00386536 0.00395872 0.00405459 0.00415306 0.00425418 0.00435802 0.0044646 0.00457398 0.00468616 0.00480113 0.00491889 0.00503938 0.00516253 0.00528826 0.00541644 0.00554692 0.00567953 0.00581403 0.0059502 0.00608775 0.00622637 0.00636571 0.0065054 0.00664503 0.00678416 0.00692234 0.00705909 0.00719391 0.00732628 0.00745569 0.00758161 0.00770354 0.00782096 0.00793339 0.00804038 0.00814149 0.00823635 0.00832463 0.00840606 0.00848043 0.00854762 0.00860758 0.00866036 0.00870609 0.00874501 0.00877747 0.00880389 0.00882484 0.00884094 0.00885294 0.00886167 0.00886805 0.00887305 0.00887771 0.0088831 0.00889031 0.00890043 0.00891452 0.0089336 0.00895859 0.00899034 0.00902953 0.0090767 0.00913222 0.00919622 0.00926863 0.00934912 0.00943711 0.00953174 0.0096319 0.00973621 0.00984304 0.00995051 0.0100566 0.0101589 0.0102552 0.0103429 0.0104195 0.0104825 0.0105293 0.0105575 0.010565 0.0105497 0.0105098 0.010444 0.010351 0.0102302 0.0100812 0.00990401 0.00969915 0.00946746 0.00921021 0.008929 0.00862578 0.0083028 0.00796255 0.00760772 0.00724114 0.00686574 0.00648448 0.00610032 0.00571614 0.0053347 0.00495861 0.00459029 0.00423193 0.00388548 0.00355261 0.00323475 0.00293301 0.00264826 0.00238107 0.00213179 0.00190051 0.00168711 0.00149129 0.00131255 0.00115029 0.00100376 0.000872123 0.000754484 0.000649894 0.000557382 0.000475968 0.000404684 0.000342582 0.000288749 0.000242317 0.000202465 0.000168431 0.000139506 0.000115044 9.44564e-05 7.72142e-05 6.28433e-05 5.09231e-05 4.10833e-05 3.29996e-05 2.63902e-05 2.10121e-05 1.66565e-05 1.31459e-05 1.03296e-05 8.08104e-06 6.29415e-06 4.88084e-06 3.76823e-06 2.89645e-06 2.21657e-06 1.6888e-06 1.28103e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0
+STREAM_DISTRIBUTIONS "Out" 0 0.5 0.5 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.04504e-06 1.2486e-06 1.4915e-06 1.78115e-06 2.1263e-06 2.53723e-06 3.02604e-06 3.60688e-06 4.29632e-06 5.11368e-06 6.08144e-06 7.22572e-06 8.57675e-06 1.01694e-05 1.2044e-05 1.42467e-05 1.68305e-05 1.98557e-05 2.33912e-05 2.75151e-05 3.2316e-05 3.78936e-05 4.43601e-05 5.18413e-05 6.04776e-05 7.04254e-05 8.18582e-05 9.49677e-05 0.000109965 0.000127081 0.000146569 0.000168704 0.000193785 0.000222132 0.000254092 0.000290033 0.000330349 0.000375455 0.00042579 0.000481811 0.000543997 0.000612842 0.000688853 0.000772547 0.00086445 0.000965088 0.00107498 0.00119465 0.00132459 0.00146527 0.00161716 0.00178065 0.00195613 0.00214391 0.00234425 0.00255735 0.00278331 0.00302217 0.00327388 0.00353828 0.00381511 0.00410402 0.00440453 0.00471604 0.00503786 0.00536915 0.00570899 0.00605631 0.00640996 0.00676867 0.00713109 0.00749577 0.00786119 0.00822577 0.00858788 0.00894585 0.00929798 0.0096426 0.00997801 0.0103026 0.0106147 0.0109129 0.0111956 0.0114615 0.0117094 0.0119382 0.0121468 0.0123346 0.0125007 0.0126446 0.0127662 0.0128651 0.0129414 0.0129953 0.013027 0.0130372 0.0130264 0.0129955 0.0129453 0.0128769 0.0127914 0.01269 0.012574 0.0124448 0.0123036 0.0121519 0.0119911 0.0118225 0.0116475 0.0114673 0.0112832 0.0110965 0.0109081 0.0107191 0.0105305 0.0103429 0.0101573 0.00997413 0.009794 0.00961731 0.00944439 0.00927547 0.00911069 0.00895012 0.00879373 0.00864143 0.00849309 0.00834849 0.00820739 0.0080695 0.00793451 0.00780208 0.00767186 0.00754349 0.00741662 0.00729089 0.00716597 0.00704153 0.00691727 0.00679292 0.00666822 0.00654295 0.00641693 0.00628999 0.00616202 0.00603292 0.00590263 0.00577114 0.00563844 0.00550457 0.00536959 0.00523359 0.00509667 0.00495896 0.00482063 0.00468182 0.00454272 0.00440352 0.00426442 0.00412562 0.00398732 0.00384975 0.0037131 0.00357759 0.00344342 0.0033108 0.0031799 0.00305093 0.00292405 0.00279943 0.00267723 0.00255758 0.00244063 0.00232648 0.00221524 0.00210701 0.00200187 0.00189989 0.00180111 0.00170559 0.00161336 0.00152442 0.0014388 0.00135648 0.00127746 0.00120171 0.0011292 0.00105989 0.000993725 0.000930662 0.000870634 0.000813575 0.000759411 0.000708067 0.000659462 0.000613511 0.000570129 0.000529226 0.000490713 0.000454497 0.000420486 0.000388589 0.000358713 0.000330765 0.000304657 0.000280298 0.0002576 0.000236477 0.000216846 0.000198623 0.000181729 0.000166088 0.000151624 0.000138267 0.000125946 0.000114595 0.000104152 9.45552e-05 8.57475e-05 7.76738e-05 7.02821e-05 6.35233e-05 5.73507e-05 5.17203e-05 4.6591e-05 4.19237e-05 3.76821e-05 3.3832e-05 3.03415e-05 2.7181e-05 0.4 0.3 0.2 0.1 200 0.599997 0.400003 0 0 0 0 0 0 1.08431e-06 1.59695e-06 2.23998e-06 3.02532e-06 3.96449e-06 5.06862e-06 6.34859e-06 7.81495e-06 9.47804e-06 1.1348e-05 1.34346e-05 1.57477e-05 1.82967e-05 2.10911e-05 2.414e-05 2.74526e-05 3.10378e-05 3.49044e-05 3.90611e-05 4.35166e-05 4.82793e-05 5.33576e-05 5.87598e-05 6.44942e-05 7.05688e-05 7.69917e-05 8.37708e-05 9.09141e-05 9.84294e-05 0.000106324 0.000114607 0.000123284 0.000132364 0.000141854 0.000151761 0.000162093 0.000172858 0.000184062 0.000195712 0.000207816 0.000220381 0.000233414 0.000246922 0.000260913 0.000275392 0.000290366 0.000305844 0.000321831 0.000338334 0.00035536 0.000372916 0.000391008 0.000409643 0.000428827 0.000448568 0.000468871 0.000489743 0.000511191 0.00053322 0.000555838 0.000579051 0.000602864 0.000627285 0.000652319 0.000677974 0.000704254 0.000731166 0.000758716 0.000786912 0.000815757 0.00084526 0.000875425 0.000906259 0.000937768 0.000969958 0.00100283 0.0010364 0.00107067 0.00110565 0.00114133 0.00117774 0.00121487 0.00125272 0.00129132 0.00133066 0.00137074 0.00141159 0.00145319 0.00149557 0.00153873 0.00158268 0.00162742 0.00167296 0.00171932 0.0017665 0.00181452 0.00186339 0.00191311 0.00196372 0.00201521 0.0020676 0.00212093 0.0021752 0.00223043 0.00228667 0.00234392 0.00240222 0.00246161 0.00252211 0.00258377 0.00264664 0.00271075 0.00277616 0.00284292 0.00291109 0.00298073 0.00305191 0.0031247 0.00319917 0.0032754 0.00335348 0.00343347 0.00351548 0.00359959 0.00368588 0.00377444 0.00386536 0.00395872 0.00405459 0.00415306 0.00425418 0.00435802 0.0044646 0.00457398 0.00468616 0.00480113 0.00491889 0.00503938 0.00516253 0.00528826 0.00541644 0.00554692 0.00567953 0.00581403 0.0059502 0.00608775 0.00622637 0.00636571 0.0065054 0.00664503 0.00678416 0.00692234 0.00705909 0.00719391 0.00732628 0.00745569 0.00758161 0.00770354 0.00782096 0.00793339 0.00804038 0.00814149 0.00823635 0.00832463 0.00840606 0.00848043 0.00854762 0.00860758 0.00866036 0.00870609 0.00874501 0.00877747 0.00880389 0.00882484 0.00884094 0.00885294 0.00886167 0.00886805 0.00887305 0.00887771 0.0088831 0.00889031 0.00890043 0.00891452 0.0089336 0.00895859 0.00899034 0.00902953 0.0090767 0.00913222 0.00919622 0.00926863 0.00934912 0.00943711 0.00953174 0.0096319 0.00973621 0.00984304 0.00995051 0.0100566 0.0101589 0.0102552 0.0103429 0.0104195 0.0104825 0.0105293 0.0105575 0.010565 0.0105497 0.0105098 0.010444 0.010351 0.0102302 0.0100812 0.00990401 0.00969915 0.00946746 0.00921021 0.008929 0.00862578 0.0083028 0.00796255 0.00760772 0.00724114 0.00686574 0.00648448 0.00610032 0.00571614 0.0053347 0.00495861 0.00459029 0.00423193 0.00388548 0.00355261 0.00323475 0.00293301 0.00264826 0.00238107 0.00213179 0.00190051 0.00168711 0.00149129 0.00131255 0.00115029 0.00100376 0.000872123 0.000754484 0.000649894 0.000557382 0.000475968 0.000404684 0.000342582 0.000288749 0.000242317 0.000202465 0.000168431 0.000139506 0.000115044 9.44564e-05 7.72142e-05 6.28433e-05 5.09231e-05 4.10833e-05 3.29996e-05 2.63902e-05 2.10121e-05 1.66565e-05 1.31459e-05 1.03296e-05 8.08104e-06 6.29415e-06 4.88084e-06 3.76823e-06 2.89645e-06 2.21657e-06 1.6888e-06 1.28103e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0.100001 0.2 0.3 0.399999
+HOLDUP_MASS "Crusher" "Holdup" 0 300 200 300
+HOLDUP_PSD "Crusher" "Holdup" 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.04504e-06 1.2486e-06 1.4915e-06 1.78115e-06 2.1263e-06 2.53723e-06 3.02604e-06 3.60688e-06 4.29632e-06 5.11368e-06 6.08144e-06 7.22572e-06 8.57675e-06 1.01694e-05 1.2044e-05 1.42467e-05 1.68305e-05 1.98557e-05 2.33912e-05 2.75151e-05 3.2316e-05 3.78936e-05 4.43601e-05 5.18413e-05 6.04776e-05 7.04254e-05 8.18582e-05 9.49677e-05 0.000109965 0.000127081 0.000146569 0.000168704 0.000193785 0.000222132 0.000254092 0.000290033 0.000330349 0.000375455 0.00042579 0.000481811 0.000543997 0.000612842 0.000688853 0.000772547 0.00086445 0.000965088 0.00107498 0.00119465 0.00132459 0.00146527 0.00161716 0.00178065 0.00195613 0.00214391 0.00234425 0.00255735 0.00278331 0.00302217 0.00327388 0.00353828 0.00381511 0.00410402 0.00440453 0.00471604 0.00503786 0.00536915 0.00570899 0.00605631 0.00640996 0.00676867 0.00713109 0.00749577 0.00786119 0.00822577 0.00858788 0.00894585 0.00929798 0.0096426 0.00997801 0.0103026 0.0106147 0.0109129 0.0111956 0.0114615 0.0117094 0.0119382 0.0121468 0.0123346 0.0125007 0.0126446 0.0127662 0.0128651 0.0129414 0.0129953 0.013027 0.0130372 0.0130264 0.0129955 0.0129453 0.0128769 0.0127914 0.01269 0.012574 0.0124448 0.0123036 0.0121519 0.0119911 0.0118225 0.0116475 0.0114673 0.0112832 0.0110965 0.0109081 0.0107191 0.0105305 0.0103429 0.0101573 0.00997413 0.009794 0.00961731 0.00944439 0.00927547 0.00911069 0.00895012 0.00879373 0.00864143 0.00849309 0.00834849 0.00820739 0.0080695 0.00793451 0.00780208 0.00767186 0.00754349 0.00741662 0.00729089 0.00716597 0.00704153 0.00691727 0.00679292 0.00666822 0.00654295 0.00641693 0.00628999 0.00616202 0.00603292 0.00590263 0.00577114 0.00563844 0.00550457 0.00536959 0.00523359 0.00509667 0.00495896 0.00482063 0.00468182 0.00454272 0.00440352 0.00426442 0.00412562 0.00398732 0.00384975 0.0037131 0.00357759 0.00344342 0.0033108 0.0031799 0.00305093 0.00292405 0.00279943 0.00267723 0.00255758 0.00244063 0.00232648 0.00221524 0.00210701 0.00200187 0.00189989 0.00180111 0.00170559 0.00161336 0.00152442 0.0014388 0.00135648 0.00127746 0.00120171 0.0011292 0.00105989 0.000993725 0.000930662 0.000870634 0.000813575 0.000759411 0.000708067 0.000659462 0.000613511 0.000570129 0.000529226 0.000490713 0.000454497 0.000420486 0.000388589 0.000358713 0.000330765 0.000304657 0.000280298 0.0002576 0.000236477 0.000216846 0.000198623 0.000181729 0.000166088 0.000151624 0.000138267 0.000125946 0.000114595 0.000104152 9.45552e-05 8.57475e-05 7.76738e-05 7.02821e-05 6.35233e-05 5.73507e-05 5.17203e-05 4.6591e-05 4.19237e-05 3.76821e-05 3.3832e-05 3.03415e-05 2.7181e-05 200 0 0 0 0 0 0 1.08431e-06 1.59695e-06 2.23998e-06 3.02532e-06 3.96449e-06 5.06862e-06 6.34859e-06 7.81495e-06 9.47804e-06 1.1348e-05 1.34346e-05 1.57477e-05 1.82967e-05 2.10911e-05 2.414e-05 2.74526e-05 3.10378e-05 3.49044e-05 3.90611e-05 4.35166e-05 4.82793e-05 5.33576e-05 5.87598e-05 6.44942e-05 7.05688e-05 7.69917e-05 8.37708e-05 9.09141e-05 9.84294e-05 0.000106324 0.000114607 0.000123284 0.000132364 0.000141854 0.000151761 0.000162093 0.000172858 0.000184062 0.000195712 0.000207816 0.000220381 0.000233414 0.000246922 0.000260913 0.000275392 0.000290366 0.000305844 0.000321831 0.000338334 0.00035536 0.000372916 0.000391008 0.000409643 0.000428827 0.000448568 0.000468871 0.000489743 0.000511191 0.00053322 0.000555838 0.000579051 0.000602864 0.000627285 0.000652319 0.000677974 0.000704254 0.000731166 0.000758716 0.000786912 0.000815757 0.00084526 0.000875425 0.000906259 0.000937768 0.000969958 0.00100283 0.0010364 0.00107067 0.00110565 0.00114133 0.00117774 0.00121487 0.00125272 0.00129132 0.00133066 0.00137074 0.00141159 0.00145319 0.00149557 0.00153873 0.00158268 0.00162742 0.00167296 0.00171932 0.0017665 0.00181452 0.00186339 0.00191311 0.00196372 0.00201521 0.0020676 0.00212093 0.0021752 0.00223043 0.00228667 0.00234392 0.00240222 0.00246161 0.00252211 0.00258377 0.00264664 0.00271075 0.00277616 0.00284292 0.00291109 0.00298073 0.00305191 0.0031247 0.00319917 0.0032754 0.00335348 0.00343347 0.00351548 0.00359959 0.00368588 0.00377444 0.00386536 0.00395872 0.00405459 0.00415306 0.00425418 0.00435802 0.0044646 0.00457398 0.00468616 0.00480113 0.00491889 0.00503938 0.00516253 0.00528826 0.00541644 0.00554692 0.00567953 0.00581403 0.0059502 0.00608775 0.00622637 0.00636571 0.0065054 0.00664503 0.00678416 0.00692234 0.00705909 0.00719391 0.00732628 0.00745569 0.00758161 0.00770354 0.00782096 0.00793339 0.00804038 0.00814149 0.00823635 0.00832463 0.00840606 0.00848043 0.00854762 0.00860758 0.00866036 0.00870609 0.00874501 0.00877747 0.00880389 0.00882484 0.00884094 0.00885294 0.00886167 0.00886805 0.00887305 0.00887771 0.0088831 0.00889031 0.00890043 0.00891452 0.0089336 0.00895859 0.00899034 0.00902953 0.0090767 0.00913222 0.00919622 0.00926863 0.00934912 0.00943711 0.00953174 0.0096319 0.00973621 0.00984304 0.00995051 0.0100566 0.0101589 0.0102552 0.0103429 0.0104195 0.0104825 0.0105293 0.0105575 0.010565 0.0105497 0.0105098 0.010444 0.010351 0.0102302 0.0100812 0.00990401 0.00969915 0.00946746 0.00921021 0.008929 0.00862578 0.0083028 0.00796255 0.00760772 0.00724114 0.00686574 0.00648448 0.00610032 0.00571614 0.0053347 0.00495861 0.00459029 0.00423193 0.00388548 0.00355261 0.00323475 0.00293301 0.00264826 0.00238107 0.00213179 0.00190051 0.00168711 0.00149129 0.00131255 0.00115029 0.00100376 0.000872123 0.000754484 0.000649894 0.000557382 0.000475968 0.000404684 0.000342582 0.000288749 0.000242317 0.000202465 0.000168431 0.000139506 0.000115044 9.44564e-05 7.72142e-05 6.28433e-05 5.09231e-05 4.10833e-05 3.29996e-05 2.63902e-05 2.10121e-05 1.66565e-05 1.31459e-05 1.03296e-05 8.08104e-06 6.29415e-06 4.88084e-06 3.76823e-06 2.89645e-06 2.21657e-06 1.6888e-06 1.28103e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0
+HOLDUP_DISTRIBUTIONS "Crusher" "Holdup" 0 0.5 0.5 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.04504e-06 1.2486e-06 1.4915e-06 1.78115e-06 2.1263e-06 2.53723e-06 3.02604e-06 3.60688e-06 4.29632e-06 5.11368e-06 6.08144e-06 7.22572e-06 8.57675e-06 1.01694e-05 1.2044e-05 1.42467e-05 1.68305e-05 1.98557e-05 2.33912e-05 2.75151e-05 3.2316e-05 3.78936e-05 4.43601e-05 5.18413e-05 6.04776e-05 7.04254e-05 8.18582e-05 9.49677e-05 0.000109965 0.000127081 0.000146569 0.000168704 0.000193785 0.000222132 0.000254092 0.000290033 0.000330349 0.000375455 0.00042579 0.000481811 0.000543997 0.000612842 0.000688853 0.000772547 0.00086445 0.000965088 0.00107498 0.00119465 0.00132459 0.00146527 0.00161716 0.00178065 0.00195613 0.00214391 0.00234425 0.00255735 0.00278331 0.00302217 0.00327388 0.00353828 0.00381511 0.00410402 0.00440453 0.00471604 0.00503786 0.00536915 0.00570899 0.00605631 0.00640996 0.00676867 0.00713109 0.00749577 0.00786119 0.00822577 0.00858788 0.00894585 0.00929798 0.0096426 0.00997801 0.0103026 0.0106147 0.0109129 0.0111956 0.0114615 0.0117094 0.0119382 0.0121468 0.0123346 0.0125007 0.0126446 0.0127662 0.0128651 0.0129414 0.0129953 0.013027 0.0130372 0.0130264 0.0129955 0.0129453 0.0128769 0.0127914 0.01269 0.012574 0.0124448 0.0123036 0.0121519 0.0119911 0.0118225 0.0116475 0.0114673 0.0112832 0.0110965 0.0109081 0.0107191 0.0105305 0.0103429 0.0101573 0.00997413 0.009794 0.00961731 0.00944439 0.00927547 0.00911069 0.00895012 0.00879373 0.00864143 0.00849309 0.00834849 0.00820739 0.0080695 0.00793451 0.00780208 0.00767186 0.00754349 0.00741662 0.00729089 0.00716597 0.00704153 0.00691727 0.00679292 0.00666822 0.00654295 0.00641693 0.00628999 0.00616202 0.00603292 0.00590263 0.00577114 0.00563844 0.00550457 0.00536959 0.00523359 0.00509667 0.00495896 0.00482063 0.00468182 0.00454272 0.00440352 0.00426442 0.00412562 0.00398732 0.00384975 0.0037131 0.00357759 0.00344342 0.0033108 0.0031799 0.00305093 0.00292405 0.00279943 0.00267723 0.00255758 0.00244063 0.00232648 0.00221524 0.00210701 0.00200187 0.00189989 0.00180111 0.00170559 0.00161336 0.00152442 0.0014388 0.00135648 0.00127746 0.00120171 0.0011292 0.00105989 0.000993725 0.000930662 0.000870634 0.000813575 0.000759411 0.000708067 0.000659462 0.000613511 0.000570129 0.000529226 0.000490713 0.000454497 0.000420486 0.000388589 0.000358713 0.000330765 0.000304657 0.000280298 0.0002576 0.000236477 0.000216846 0.000198623 0.000181729 0.000166088 0.000151624 0.000138267 0.000125946 0.000114595 0.000104152 9.45552e-05 8.57475e-05 7.76738e-05 7.02821e-05 6.35233e-05 5.73507e-05 5.17203e-05 4.6591e-05 4.19237e-05 3.76821e-05 3.3832e-05 3.03415e-05 2.7181e-05 0.4 0.3 0.2 0.1 200 0.599997 0.400003 0 0 0 0 0 0 1.08431e-06 1.59695e-06 2.23998e-06 3.02532e-06 3.96449e-06 5.06862e-06 6.34859e-06 7.81495e-06 9.47804e-06 1.1348e-05 1.34346e-05 1.57477e-05 1.82967e-05 2.10911e-05 2.414e-05 2.74526e-05 3.10378e-05 3.49044e-05 3.90611e-05 4.35166e-05 4.82793e-05 5.33576e-05 5.87598e-05 6.44942e-05 7.05688e-05 7.69917e-05 8.37708e-05 9.09141e-05 9.84294e-05 0.000106324 0.000114607 0.000123284 0.000132364 0.000141854 0.000151761 0.000162093 0.000172858 0.000184062 0.000195712 0.000207816 0.000220381 0.000233414 0.000246922 0.000260913 0.000275392 0.000290366 0.000305844 0.000321831 0.000338334 0.00035536 0.000372916 0.000391008 0.000409643 0.000428827 0.000448568 0.000468871 0.000489743 0.000511191 0.00053322 0.000555838 0.000579051 0.000602864 0.000627285 0.000652319 0.000677974 0.000704254 0.000731166 0.000758716 0.000786912 0.000815757 0.00084526 0.000875425 0.000906259 0.000937768 0.000969958 0.00100283 0.0010364 0.00107067 0.00110565 0.00114133 0.00117774 0.00121487 0.00125272 0.00129132 0.00133066 0.00137074 0.00141159 0.00145319 0.00149557 0.00153873 0.00158268 0.00162742 0.00167296 0.00171932 0.0017665 0.00181452 0.00186339 0.00191311 0.00196372 0.00201521 0.0020676 0.00212093 0.0021752 0.00223043 0.00228667 0.00234392 0.00240222 0.00246161 0.00252211 0.00258377 0.00264664 0.00271075 0.00277616 0.00284292 0.00291109 0.00298073 0.00305191 0.0031247 0.00319917 0.0032754 0.00335348 0.00343347 0.00351548 0.00359959 0.00368588 0.00377444 0.00386536 0.00395872 0.00405459 0.00415306 0.00425418 0.00435802 0.0044646 0.00457398 0.00468616 0.00480113 0.00491889 0.00503938 0.00516253 0.00528826 0.00541644 0.00554692 0.00567953 0.00581403 0.0059502 0.00608775 0.00622637 0.00636571 0.0065054 0.00664503 0.00678416 0.00692234 0.00705909 0.00719391 0.00732628 0.00745569 0.00758161 0.00770354 0.00782096 0.00793339 0.00804038 0.00814149 0.00823635 0.00832463 0.00840606 0.00848043 0.00854762 0.00860758 0.00866036 0.00870609 0.00874501 0.00877747 0.00880389 0.00882484 0.00884094 0.00885294 0.00886167 0.00886805 0.00887305 0.00887771 0.0088831 0.00889031 0.00890043 0.00891452 0.0089336 0.00895859 0.00899034 0.00902953 0.0090767 0.00913222 0.00919622 0.00926863 0.00934912 0.00943711 0.00953174 0.0096319 0.00973621 0.00984304 0.00995051 0.0100566 0.0101589 0.0102552 0.0103429 0.0104195 0.0104825 0.0105293 0.0105575 0.010565 0.0105497 0.0105098 0.010444 0.010351 0.0102302 0.0100812 0.00990401 0.00969915 0.00946746 0.00921021 0.008929 0.00862578 0.0083028 0.00796255 0.00760772 0.00724114 0.00686574 0.00648448 0.00610032 0.00571614 0.0053347 0.00495861 0.00459029 0.00423193 0.00388548 0.00355261 0.00323475 0.00293301 0.00264826 0.00238107 0.00213179 0.00190051 0.00168711 0.00149129 0.00131255 0.00115029 0.00100376 0.000872123 0.000754484 0.000649894 0.000557382 0.000475968 0.000404684 0.000342582 0.000288749 0.000242317 0.000202465 0.000168431 0.000139506 0.000115044 9.44564e-05 7.72142e-05 6.28433e-05 5.09231e-05 4.10833e-05 3.29996e-05 2.63902e-05 2.10121e-05 1.66565e-05 1.31459e-05 1.03296e-05 8.08104e-06 6.29415e-06 4.88084e-06 3.76823e-06 2.89645e-06 2.21657e-06 1.6888e-06 1.28103e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0.100001 0.2 0.3 0.399999
@@ -0,0 +1,4 @@
+STREAM_MASS "Out" 0 10 60 10
+STREAM_PSD "Out" 0 0 0 0 0 0 0 0 0 0 0 0 0 2.47461e-06 7.16054e-06 1.94645e-05 4.97046e-05 0.000119237 0.000268715 0.000568904 0.00113156 0.00211446 0.00371281 0.00612587 0.00950238 0.0138631 0.0190308 0.0246625 0.0301282 0.0350405 0.0387488 0.0412592 0.0430484 0.0433731 0.0446696 0.0445067 0.0454196 0.0460231 0.0450475 0.0456444 0.0431896 0.0418958 0.0398288 0.0366799 0.0349615 0.0311366 0.0287062 0.0254679 0.0224619 0.0199508 0.016761 0.0147613 0.0120356 0.0102486 0.00834638 0.00671856 0.00549851 0.0042221 0.0033786 0.00255291 0.0019559 0.00147301 0.00107303 0.000792054 0.000564839 0.000400783 0.000281027 0.000192462 0.000131068 8.7274e-05 5.74742e-05 3.74556e-05 2.36882e-05 1.50726e-05 9.20914e-06 5.66132e-06 3.38054e-06 1.98921e-06 1.16773e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 60 0 0 0 0 0 0 0 0 0 0 0 0 2.47461e-06 7.16054e-06 1.94645e-05 4.97046e-05 0.000119237 0.000268715 0.000568904 0.00113156 0.00211446 0.00371281 0.00612587 0.00950238 0.0138631 0.0190308 0.0246625 0.0301282 0.0350405 0.0387488 0.0412592 0.0430484 0.0433731 0.0446696 0.0445067 0.0454196 0.0460231 0.0450475 0.0456444 0.0431896 0.0418958 0.0398288 0.0366799 0.0349615 0.0311366 0.0287062 0.0254679 0.0224619 0.0199508 0.016761 0.0147613 0.0120356 0.0102486 0.00834638 0.00671856 0.00549851 0.0042221 0.0033786 0.00255291 0.0019559 0.00147301 0.00107303 0.000792054 0.000564839 0.000400783 0.000281027 0.000192462 0.000131068 8.7274e-05 5.74742e-05 3.74556e-05 2.36882e-05 1.50726e-05 9.20914e-06 5.66132e-06 3.38054e-06 1.98921e-06 1.16773e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0
+UNIT_STATE_VAR "Number ratio" 0 0.596303 60 0.596303
+UNIT_STATE_VAR "Volume ratio" 0 1 60 1
@@ -0,0 +1,4 @@
+STREAM_MASS "Out" 0 10 60 10
+STREAM_PSD "Out" 0 0 0 1.46104e-06 6.42298e-06 1.93013e-05 4.62822e-05 9.55703e-05 0.000177447 0.000304308 0.000490698 0.000753378 0.00111151 0.00158713 0.00220636 0.003002 0.00401859 0.00532134 0.00700957 0.00923339 0.0122082 0.0162155 0.0215745 0.0285681 0.0373218 0.0476542 0.0589525 0.0701384 0.0797846 0.0863883 0.0887403 0.0862693 0.0792288 0.0686483 0.0560627 0.0431221 0.0312228 0.0212721 0.0136326 0.00821614 0.00465582 0.00248026 0.00124199 0.000584545 0.00025856 0.000107478 4.19831e-05 1.541e-05 5.3148e-06 1.72233e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 60 0 0 1.46104e-06 6.42299e-06 1.93013e-05 4.62822e-05 9.55704e-05 0.000177447 0.000304308 0.000490698 0.000753378 0.00111151 0.00158713 0.00220636 0.003002 0.00401859 0.00532134 0.00700957 0.00923339 0.0122082 0.0162155 0.0215745 0.0285681 0.0373218 0.0476542 0.0589525 0.0701384 0.0797846 0.0863883 0.0887403 0.0862693 0.0792288 0.0686483 0.0560627 0.0431221 0.0312228 0.0212721 0.0136326 0.00821615 0.00465582 0.00248026 0.00124199 0.000584545 0.00025856 0.000107478 4.19831e-05 1.541e-05 5.3148e-06 1.72233e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0
+UNIT_STATE_VAR "Number ratio" 0 1.35 60 1.35
+UNIT_STATE_VAR "Volume ratio" 0 1 60 1
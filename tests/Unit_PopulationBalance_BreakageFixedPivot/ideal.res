@@ -0,0 +1,4 @@
+STREAM_MASS "Out" 0 10 60 10
+STREAM_PSD "Out" 0 0 0 1.52165e-06 6.54574e-06 1.95032e-05 4.65732e-05 9.59507e-05 0.000177905 0.000304815 0.000491207 0.000753816 0.00111177 0.00158705 0.00220571 0.00300039 0.0040154 0.00531562 0.00699989 0.00921776 0.0121841 0.0161804 0.0215263 0.0285065 0.0372487 0.047575 0.0588757 0.0700744 0.0797434 0.0863771 0.0887612 0.086319 0.0792992 0.0687288 0.0561427 0.0431935 0.0312809 0.0213156 0.0136626 0.00823539 0.0046673 0.00248665 0.00124531 0.000586153 0.000259289 0.000107788 4.2106e-05 1.54557e-05 5.33077e-06 1.72756e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 60 0 0 1.52165e-06 6.54576e-06 1.95032e-05 4.65733e-05 9.59508e-05 0.000177905 0.000304815 0.000491207 0.000753817 0.00111177 0.00158705 0.00220571 0.00300039 0.0040154 0.00531562 0.00699989 0.00921776 0.0121841 0.0161804 0.0215263 0.0285065 0.0372487 0.047575 0.0588757 0.0700744 0.0797434 0.0863771 0.0887612 0.086319 0.0792992 0.0687288 0.0561427 0.0431935 0.0312809 0.0213156 0.0136626 0.00823539 0.0046673 0.00248665 0.00124531 0.000586153 0.000259289 0.000107788 4.21061e-05 1.54557e-05 5.33077e-06 1.72756e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0
+UNIT_STATE_VAR "Number ratio" 0 1.34993 60 1.34993
+UNIT_STATE_VAR "Volume ratio" 0 1 60 1
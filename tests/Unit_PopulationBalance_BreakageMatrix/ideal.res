@@ -0,0 +1,4 @@
+STREAM_MASS "Out" 0 10 60 10
+STREAM_PSD "Out" 0 0 0 1.48322e-06 6.47682e-06 1.94087e-05 4.64736e-05 9.58868e-05 0.000177941 0.000305045 0.000491756 0.000754844 0.00111347 0.00158967 0.0022095 0.00300564 0.00402242 0.00532466 0.00701111 0.00923117 0.0121995 0.0161971 0.0215433 0.0285224 0.0372619 0.0475839 0.0588789 0.0700713 0.0797341 0.0863626 0.0887433 0.0862995 0.0792802 0.0687117 0.0561286 0.0431827 0.0312731 0.0213103 0.0136593 0.00823347 0.00466624 0.0024861 0.00124504 0.000586032 0.000259237 0.000107767 4.20982e-05 1.54529e-05 5.32984e-06 1.72726e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 60 0 0 1.48323e-06 6.47683e-06 1.94087e-05 4.64737e-05 9.58868e-05 0.000177941 0.000305046 0.000491756 0.000754844 0.00111347 0.00158967 0.0022095 0.00300564 0.00402242 0.00532466 0.00701111 0.00923117 0.0121995 0.0161971 0.0215433 0.0285224 0.0372619 0.0475839 0.0588789 0.0700713 0.0797341 0.0863626 0.0887433 0.0862995 0.0792802 0.0687117 0.0561286 0.0431827 0.0312731 0.0213103 0.0136593 0.00823347 0.00466624 0.0024861 0.00124504 0.000586032 0.000259237 0.000107767 4.20982e-05 1.54529e-05 5.32984e-06 1.72726e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0
+UNIT_STATE_VAR "Number ratio" 0 1.35 60 1.35
+UNIT_STATE_VAR "Volume ratio" 0 1 60 1
@@ -0,0 +1,4 @@
+STREAM_MASS "Out" 0 10 60 10
+STREAM_PSD "Out" 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 2.3246e-06 6.13133e-06 1.554e-05 3.77956e-05 8.81079e-05 0.000196663 0.000419899 0.000856866 0.00167005 0.00310659 0.0055089 0.00929678 0.0149172 0.0228062 0.0334033 0.0469865 0.0624942 0.0755512 0.0830346 0.0887609 0.0931192 0.0939861 0.0894636 0.0790841 0.0643899 0.0482725 0.0335032 0.0216629 0.0130811 0.00735326 0.00382144 0.00182306 0.000794669 0.000315974 0.000114579 3.78673e-05 1.13836e-05 3.10496e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 60 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 2.3246e-06 6.13133e-06 1.554e-05 3.77956e-05 8.81079e-05 0.000196663 0.000419899 0.000856866 0.00167005 0.00310659 0.0055089 0.00929678 0.0149172 0.0228062 0.0334033 0.0469865 0.0624942 0.0755512 0.0830346 0.0887609 0.0931192 0.0939861 0.0894636 0.0790841 0.0643899 0.0482725 0.0335032 0.0216629 0.0130811 0.00735326 0.00382144 0.00182306 0.000794669 0.000315974 0.000114579 3.78673e-05 1.13836e-05 3.10496e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0
+UNIT_STATE_VAR "Number ratio" 0 1 60 1
+UNIT_STATE_VAR "Volume ratio" 0 3.46188 60 3.46188
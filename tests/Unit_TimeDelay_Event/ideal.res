@@ -0,0 +1,2 @@
+STREAM_MASS "Out" 0 0 4 0 5 0 10 9.93262 50 10
+STREAM_TEMPERATURE "Out" 0 300 4 300 5 300 10 300 50 300
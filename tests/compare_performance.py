@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025, DyssolTEC GmbH.
+# All rights reserved. This file is part of Dyssol. See LICENSE file for license information.
+
+#
+# This script compares a benchmark report of DyssolC with a stored baseline and returns an error if the simulation became slower than allowed.
+# If the baseline does not exist, it is created from the report.
+
+import argparse
+import json
+import os.path
+import sys
+
+
+def summarize(report):
+    """Returns the values of the report, which are compared with the baseline."""
+    units = {}
+    for run in report["runs"]:
+        for j, job in enumerate(run["jobs"]):
+            for s, simulation in enumerate(job["simulations"]):
+                for unit in simulation["units"]:
+                    key = f"{j + 1}/{s + 1}/{unit['name']}"
+                    units[key] = min(units.get(key, unit["time"]), unit["time"])
+    first = report["runs"][0] if report["runs"] else {"jobs": []}
+    return {
+        "wall_time": report["wall_time"]["min"],
+        "peak_rss": report["peak_rss"],
+        "iterations": sum(simulation["iterations"] for job in first["jobs"] for simulation in job["simulations"]),
+        "units": units,
+    }
+
+
+if __name__ == "__main__":
+
+    parser = argparse.ArgumentParser(
+        description='compares a benchmark report of DyssolC with a stored baseline and returns an error if the simulation became slower than allowed.')
+    parser.add_argument('report', action="store",
+                        help='benchmark report file')
+    parser.add_argument('baseline', action="store",
+                        help='baseline file, created from the report if it does not exist')
+    parser.add_argument('-t', '--time-threshold', action="store", default=1.5, dest="time_threshold",
+                        help='maximum allowed ratio of wall time and iterations to the baseline')
+    parser.add_argument('-m', '--memory-threshold', action="store", default=1.5, dest="memory_threshold",
+                        help='maximum allowed ratio of peak memory usage to the baseline')
+    parser.add_argument('-u', '--update', action="store_true", dest="update",
+                        help='replace the baseline with the report')
+
+    results = parser.parse_args()
+
+    reportfile = results.report
+    baselinefile = results.baseline
+    timeThreshold = float(results.time_threshold)
+    memoryThreshold = float(results.memory_threshold)
+
+    if (not(os.path.isfile(reportfile))):
+        sys.exit(f"Report file {reportfile} does not exist")
+
+    with open(reportfile) as r:
+        report = json.load(r)
+
+    if (not report["success"] or not report["runs"]):
+        sys.exit(f"Benchmark in {reportfile} finished with errors")
+
+    measured = summarize(report)
+
+    if (results.update or not(os.path.isfile(baselinefile))):
+        if (os.path.dirname(baselinefile)):
+            os.makedirs(os.path.dirname(baselinefile), exist_ok=True)
+        with open(baselinefile, "w") as b:
+            json.dump(measured, b, indent=2)
+        print(f"Baseline {baselinefile} is stored: wall time {measured['wall_time']:.3f} [s], peak memory {measured['peak_rss'] // 1024} [kB], iterations {measured['iterations']}")
+        sys.exit(0)
+
+    with open(baselinefile) as b:
+        baseline = json.load(b)
+
+    print(f"Used thresholds are {timeThreshold} for time and {memoryThreshold} for memory")
+
+    errors = []
+    for name, threshold in (("wall_time", timeThreshold), ("iterations", timeThreshold), ("peak_rss", memoryThreshold)):
+        if (baseline[name] > 0 and measured[name] / baseline[name] > threshold):
+            errors.append(f"{name} increased from {baseline[name]} to {measured[name]} ({measured[name] / baseline[name]:.2f} times, allowed {threshold})")
+        else:
+            print(f"{name}: {measured[name]} (baseline {baseline[name]})")
+
+    if (errors):
+        # list units with the largest slowdown to help finding the cause
+        slowdowns = sorted(((measured["units"][k] - v, k) for k, v in baseline["units"].items() if k in measured["units"] and measured["units"][k] > v), reverse=True)
+        for delta, key in slowdowns[:5]:
+            errors.append(f"unit {key}: {baseline['units'][key]:.3f} -> {measured['units'][key]:.3f} [s]")
+        sys.exit("Performance regression:\n  " + "\n  ".join(errors))
+
+    print(f"Performance of {reportfile} is within thresholds of {baselinefile}")
+    sys.exit(0)